@@ -147,10 +147,6 @@ namespace EnumReflector
 			cpp_text.Append( END_OF_LINE );
 			cpp_text.Append( "#include \"IPShared/EnumConversion.h\"" );
 			cpp_text.Append( END_OF_LINE );
-			cpp_text.Append( END_OF_LINE );
-			cpp_text.Append( "using namespace IP::Enum;" );
-			cpp_text.Append( END_OF_LINE );
-			cpp_text.Append( END_OF_LINE );
 
 			List< CEnumRecord > project_enums = new List< CEnumRecord >();
 			CEnumReflector.EnumTracker.Build_Project_Enum_List( ID, project_enums );
@@ -158,47 +154,52 @@ namespace EnumReflector
 			HashSet< CEnumRecord > referenced_enums = new HashSet< CEnumRecord >();
 			CEnumReflector.EnumTracker.Build_Referenced_Enum_Set( project_enums, referenced_enums );
 
+			// Opaque declarations of unscoped enums without a fixed underlying type are an MSVC extension, so include the
+			// defining headers instead; header paths are relative to the solution directory, which every project includes
+			SortedSet< string > enum_headers = new SortedSet< string >( StringComparer.Ordinal );
 			foreach ( var enum_record in referenced_enums )
 			{
-				if ( enum_record.Namespace.Length > 0 )
-				{
-					cpp_text.Append( "namespace " );
-					cpp_text.Append( enum_record.Namespace );
-					cpp_text.Append( END_OF_LINE );
-					cpp_text.Append( "{" );
-					cpp_text.Append( END_OF_LINE );
-					cpp_text.Append( "\t" );
-				}
+				enum_headers.Add( Build_Solution_Relative_Include_Path( enum_record.FileNameWithPath ) );
+			}
 
-				cpp_text.Append( "enum " );
-				cpp_text.Append( enum_record.EnumName );
-				cpp_text.Append( ";" );
+			foreach ( var enum_header in enum_headers )
+			{
+				cpp_text.Append( "#include \"" );
+				cpp_text.Append( enum_header );
+				cpp_text.Append( "\"" );
 				cpp_text.Append( END_OF_LINE );
-
-				if ( enum_record.Namespace.Length > 0 )
-				{
-					cpp_text.Append( "}" );
-					cpp_text.Append( END_OF_LINE );
-				}
 			}
 
 			cpp_text.Append( END_OF_LINE );
+			cpp_text.Append( "using namespace IP::Enum;" );
+			cpp_text.Append( END_OF_LINE );
+			cpp_text.Append( END_OF_LINE );
+
+			foreach ( var enum_record in project_enums )
+			{
+				Add_Enum_Tables( cpp_text, enum_record, Build_Table_Entries( enum_record, project_enums ) );
+			}
+
 			cpp_text.Append( Build_Register_Function_Signature() );
 			cpp_text.Append( END_OF_LINE );
 			cpp_text.Append( "{" );
 			cpp_text.Append( END_OF_LINE );
 
-			List< CEnumRecord > base_enums = new List< CEnumRecord >();
-
 			foreach ( var enum_record in project_enums )
-			{				
+			{
 				Add_Enum_Conversions( cpp_text, enum_record );
+			}
 
+			// base enums that live in another project already have their tables; extend them at runtime
+			foreach ( var enum_record in project_enums )
+			{
 				CEnumRecord base_enum = enum_record.BaseEnum;
 				while ( base_enum != null )
 				{
-					Add_Secondary_Enum_Conversions( cpp_text, enum_record, base_enum );
-					Add_Secondary_Enum_Conversions( cpp_text, base_enum, enum_record );
+					if ( !project_enums.Contains( base_enum ) )
+					{
+						Add_Secondary_Enum_Conversions( cpp_text, enum_record, base_enum );
+					}
 
 					base_enum = base_enum.BaseEnum;
 				}
@@ -210,39 +211,133 @@ namespace EnumReflector
 			return cpp_text;
 		}
 
-		private void Add_Enum_Conversions( StringBuilder cpp_text, CEnumRecord enum_record )
+		// An enum converts its own entries plus those of every enum it extends and every enum in this project that extends it
+		private List< CEnumEntry > Build_Table_Entries( CEnumRecord enum_record, List< CEnumRecord > project_enums )
 		{
-			cpp_text.Append( "\tIP::Enum::CEnumConverter::Register_Enum< " );
-			cpp_text.Append( enum_record.FullName );
-			cpp_text.Append( " >( \"" );
-			cpp_text.Append( enum_record.FullName );
-			cpp_text.Append( "\", " );
-			if ( ( enum_record.Flags & EEnumFlags.IsBitfield ) != 0 )
+			List< CEnumEntry > entries = new List< CEnumEntry >();
+
+			Add_Named_Entries( entries, enum_record );
+
+			CEnumRecord base_enum = enum_record.BaseEnum;
+			while ( base_enum != null )
 			{
-				cpp_text.Append( "EConvertibleEnumProperties::CEP_BITFIELD" );
+				Add_Named_Entries( entries, base_enum );
+				base_enum = base_enum.BaseEnum;
 			}
-			else
+
+			foreach ( var other_record in project_enums )
 			{
-				cpp_text.Append( "EConvertibleEnumProperties::CEP_NONE" );
+				CEnumRecord other_base_enum = other_record.BaseEnum;
+				while ( other_base_enum != null )
+				{
+					if ( other_base_enum == enum_record )
+					{
+						Add_Named_Entries( entries, other_record );
+						break;
+					}
+
+					other_base_enum = other_base_enum.BaseEnum;
+				}
 			}
-			cpp_text.Append( " );" );
-			cpp_text.Append( END_OF_LINE );
 
+			return entries;
+		}
+
+		private void Add_Named_Entries( List< CEnumEntry > entries, CEnumRecord enum_record )
+		{
 			foreach ( var entry in enum_record.Get_Entries() )
 			{
 				if ( entry.EntryName.Length > 0 )
 				{
-					cpp_text.Append( "\tIP::Enum::CEnumConverter::Register_Enum_Entry( \"" );
-					cpp_text.Append( entry.EntryName );
-					cpp_text.Append( "\", static_cast< " );
-					cpp_text.Append( enum_record.FullName );
-					cpp_text.Append( " >( " );
-					cpp_text.Append( entry.Value );
-					cpp_text.Append( " ) );" );
-					cpp_text.Append( END_OF_LINE );
+					entries.Add( entry );
+				}
+			}
+		}
+
+		private void Add_Enum_Tables( StringBuilder cpp_text, CEnumRecord enum_record, List< CEnumEntry > entries )
+		{
+			string table_prefix = Build_Table_Prefix( enum_record );
+			bool is_bitfield = ( enum_record.Flags & EEnumFlags.IsBitfield ) != 0;
+
+			// the converter binary searches both orderings; names compare byte-wise in C++, hence the ordinal sort
+			var entries_by_name = entries.OrderBy( e => e.EntryName.ToUpperInvariant(), StringComparer.Ordinal ).ToList();
+			var entries_by_value = entries.OrderBy( e => e.Value ).ToList();
+			var bit_entries = is_bitfield ? entries_by_value.Where( e => e.Value != 0 && ( e.Value & ( e.Value - 1 ) ) == 0 ).ToList() : new List< CEnumEntry >();
+
+			ulong bitfield_mask = 0;
+			foreach ( var entry in bit_entries )
+			{
+				bitfield_mask |= entry.Value;
+			}
+
+			string by_name_array = Add_Enum_Table_Array( cpp_text, table_prefix + "_EntriesByName", entries_by_name );
+			string by_value_array = Add_Enum_Table_Array( cpp_text, table_prefix + "_EntriesByValue", entries_by_value );
+			string bit_array = Add_Enum_Table_Array( cpp_text, table_prefix + "_BitEntries", bit_entries );
+
+			cpp_text.Append( "static const IP::Enum::SEnumTable " );
+			cpp_text.Append( table_prefix );
+			cpp_text.Append( "_Table = { \"" );
+			cpp_text.Append( enum_record.FullName );
+			cpp_text.Append( "\", " );
+			cpp_text.Append( is_bitfield ? "EConvertibleEnumProperties::CEP_BITFIELD" : "EConvertibleEnumProperties::CEP_NONE" );
+			cpp_text.Append( ", " );
+			cpp_text.Append( by_name_array );
+			cpp_text.Append( ", " );
+			cpp_text.Append( by_value_array );
+			cpp_text.Append( ", " );
+			cpp_text.Append( entries.Count );
+			cpp_text.Append( ", " );
+			cpp_text.Append( bit_array );
+			cpp_text.Append( ", " );
+			cpp_text.Append( bit_entries.Count );
+			cpp_text.Append( ", 0x" );
+			cpp_text.Append( bitfield_mask.ToString( "X" ) );
+			cpp_text.Append( "ULL };" );
+			cpp_text.Append( END_OF_LINE );
+			cpp_text.Append( END_OF_LINE );
+		}
+
+		// C++ has no zero-length arrays, so an empty table is referenced as nullptr instead
+		private string Add_Enum_Table_Array( StringBuilder cpp_text, string array_name, List< CEnumEntry > entries )
+		{
+			if ( entries.Count == 0 )
+			{
+				return "nullptr";
+			}
+
+			cpp_text.Append( "static const IP::Enum::SEnumTableEntry " );
+			cpp_text.Append( array_name );
+			cpp_text.Append( "[] = {" );
+			cpp_text.Append( END_OF_LINE );
+
+			for ( int i = 0; i < entries.Count; i++ )
+			{
+				cpp_text.Append( "\t{ \"" );
+				cpp_text.Append( entries[ i ].EntryName.ToUpperInvariant() );
+				cpp_text.Append( "\", 0x" );
+				cpp_text.Append( entries[ i ].Value.ToString( "X" ) );
+				cpp_text.Append( "ULL }" );
+				if ( i + 1 < entries.Count )
+				{
+					cpp_text.Append( "," );
 				}
+				cpp_text.Append( END_OF_LINE );
 			}
 
+			cpp_text.Append( "};" );
+			cpp_text.Append( END_OF_LINE );
+			cpp_text.Append( END_OF_LINE );
+
+			return array_name;
+		}
+
+		private void Add_Enum_Conversions( StringBuilder cpp_text, CEnumRecord enum_record )
+		{
+			cpp_text.Append( "\tIP::Enum::CEnumConverter::Register_Enum_Table< " );
+			cpp_text.Append( enum_record.FullName );
+			cpp_text.Append( " >( " );
+			cpp_text.Append( Build_Table_Prefix( enum_record ) );
+			cpp_text.Append( "_Table );" );
 			cpp_text.Append( END_OF_LINE );
 		}
 
@@ -266,6 +361,11 @@ namespace EnumReflector
 			cpp_text.Append( END_OF_LINE );
 		}
 
+		private string Build_Table_Prefix( CEnumRecord enum_record )
+		{
+			return enum_record.FullName.Replace( "::", "_" );
+		}
+
 		private void Add_Top_Of_File_Comment( StringBuilder file_text, string file_name )
 		{
 			file_text.Append( "/**********************************************************************************************************************" );
@@ -332,6 +432,17 @@ namespace EnumReflector
 			}
 		}
 
+		private static string Build_Solution_Relative_Include_Path( string file_name_with_path )
+		{
+			string include_path = file_name_with_path;
+			if ( include_path.StartsWith( CEnumReflector.TopLevelDirectory ) )
+			{
+				include_path = include_path.Substring( CEnumReflector.TopLevelDirectory.Length );
+			}
+
+			return include_path.Replace( '\\', '/' );
+		}
+
 		private string Build_Registration_Directory_Path()
 		{
 			return CEnumReflector.TopLevelDirectory + NewProjectRecord.CaseName + Path.DirectorySeparatorChar + "GeneratedCode" + Path.DirectorySeparatorChar;
@@ -23,6 +23,7 @@
 #include "Interfaces/DatabaseTaskBaseInterface.h"
 #include "DatabaseCallContext.h"
 #include "DatabaseTaskBatchUtilities.h"
+#include "DatabaseTaskQueue.h"
 #include "IPShared/Logging/LogInterface.h"
 
 namespace IP
@@ -51,7 +52,7 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 
 		virtual ~TCompoundDatabaseTaskBatch()
 		{
-			FATAL_ASSERT( PendingTasks.empty() );
+			FATAL_ASSERT( PendingTasks.Empty() );
 
 			std::for_each( ChildCallContexts.begin(), ChildCallContexts.end(), []( ChildCallContextPair &pair ){ delete pair.second; } );
 
@@ -65,27 +66,29 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 		}
 
 		virtual void Add_Task( IDatabaseTask * /*task*/ ) { FATAL_ASSERT( false ); }
-		virtual void Add_Task( ICompoundDatabaseTask *task ) { PendingTasks.push_back( static_cast< ICompoundDatabaseTask* >( task ) ); }
+		virtual void Add_Task( ICompoundDatabaseTask *task ) { PendingTasks.Push_Back( task ); }
+
+		virtual void Enable_Result_Caching( CDatabaseResultCache * /*result_cache*/ ) { FATAL_ASSERT( false ); }
+		virtual bool Try_Complete_From_Result_Cache( IDatabaseTask * /*task*/, double /*current_time_seconds*/ ) { return false; }
+
+		// Deadlines are per-task and compound tasks commit as a unit, so child statements are not watched
+		virtual void Set_Statement_Watchdog( CDatabaseStatementWatchdog * /*watchdog*/ ) {}
 
 		virtual void Execute_Tasks( IDatabaseConnection *connection, DBTaskBaseListType &successful_tasks, DBTaskBaseListType &failed_tasks )
 		{
 			successful_tasks.clear();
 			failed_tasks.clear();
 
-			if ( PendingTasks.empty() )
+			if ( PendingTasks.Empty() )
 			{
 				return;
 			}
 
-			LOG( IP::Logging::ELogLevel::LL_LOW, "CompoundDatabaseTaskBatch " << TaskName.c_str() << " - TaskCount: " << PendingTasks.size() );
+			LOG( IP::Logging::ELogLevel::LL_LOW, "CompoundDatabaseTaskBatch " << TaskName.c_str() << " - TaskCount: " << PendingTasks.Size() );
 
-			while ( !PendingTasks.empty() )
+			while ( !PendingTasks.Empty() )
 			{
-				DBCompoundTaskListType sub_list;
-
-				auto splice_iter = PendingTasks.begin();
-				std::advance( splice_iter, std::min( static_cast< uint32_t >( PendingTasks.size() ), T::CompoundTaskBatchSize ) );
-				sub_list.splice( sub_list.end(), PendingTasks, PendingTasks.begin(), splice_iter );
+				DBCompoundTaskRangeType sub_list = PendingTasks.Pop_Front( T::CompoundTaskBatchSize );
 
 				Process_Parent_Task_List( connection, sub_list, successful_tasks, failed_tasks );
 			}
@@ -103,25 +106,27 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 
 	private:
 
-		void Process_Parent_Task_List( IDatabaseConnection *connection, DBCompoundTaskListType &sub_list, DBTaskBaseListType &successful_tasks, DBTaskBaseListType &failed_tasks )
+		void Process_Parent_Task_List( IDatabaseConnection *connection, DBCompoundTaskRangeType sub_list, DBTaskBaseListType &successful_tasks, DBTaskBaseListType &failed_tasks )
 		{
 			while ( !sub_list.empty() )
 			{
-				std::for_each( sub_list.cbegin(), sub_list.cend(), []( ICompoundDatabaseTask *task ) { task->Clear_Child_Tasks(); task->Seed_Child_Tasks(); } );
+				std::for_each( sub_list.begin(), sub_list.end(), []( ICompoundDatabaseTask *task ) { task->Clear_Child_Tasks(); task->Seed_Child_Tasks(); } );
 
 				EDatabaseTaskIDType bad_task = EDatabaseTaskIDType::INVALID;
 				EExecuteDBTaskListResult process_child_result = EExecuteDBTaskListResult::SUCCESS;
 
 				for ( auto tt_iter = ChildOrdering.cbegin(), end = ChildOrdering.cend(); tt_iter != end; ++tt_iter )
 				{
-					DBTaskListType child_list;
-					std::for_each( sub_list.cbegin(), sub_list.cend(), [ &tt_iter, &child_list ]( ICompoundDatabaseTask *task ) { task->Get_Child_Tasks_Of_Type( *tt_iter, child_list ); } );
+					DBTaskListType child_task_list;
+					std::for_each( sub_list.begin(), sub_list.end(), [ &tt_iter, &child_task_list ]( ICompoundDatabaseTask *task ) { task->Get_Child_Tasks_Of_Type( *tt_iter, child_task_list ); } );
 
-					if( child_list.empty() )
+					if( child_task_list.empty() )
 					{
 						continue;
 					}
 
+					DBTaskVectorType child_list( child_task_list.begin(), child_task_list.end() );
+
 					LOG( IP::Logging::ELogLevel::LL_LOW, "CompoundDatabaseTaskBatch " << TaskName.c_str() << ", ChildTask " << tt_iter->name() << " - TaskCount: " << child_list.size() );
 
 					auto context_iter = ChildCallContexts.find( *tt_iter );
@@ -145,7 +150,7 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 
 					// can't use splice due to type difference
 					std::for_each( sub_list.begin(), sub_list.end(), [ &successful_tasks ]( ICompoundDatabaseTask *task ){ successful_tasks.push_back( task ); } );
-					sub_list.clear();
+					sub_list = DBCompoundTaskRangeType();
 				}
 				else
 				{
@@ -153,8 +158,7 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 
 					if ( sub_list.size() == 1 )
 					{
-						failed_tasks.push_back( *( sub_list.begin() ) );
-						sub_list.clear();
+						failed_tasks.push_back( sub_list[ 0 ] );
 						return;
 					}
 
@@ -164,7 +168,7 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 						if ( find_iter != sub_list.end() )
 						{
 							failed_tasks.push_back( *find_iter );
-							sub_list.erase( find_iter );
+							sub_list.Remove( find_iter - sub_list.begin() );
 						}
 						else
 						{
@@ -174,11 +178,9 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 
 					if ( bad_task == EDatabaseTaskIDType::INVALID )
 					{
-						for ( auto iter = sub_list.begin(); iter != sub_list.end(); ++iter )
+						for ( size_t i = 0; i < sub_list.size(); ++i )
 						{
-							DBCompoundTaskListType new_sub_list;
-							new_sub_list.push_back( *iter );
-							Process_Parent_Task_List( connection, new_sub_list, successful_tasks, failed_tasks );
+							Process_Parent_Task_List( connection, sub_list.Sub_Range( i, 1 ), successful_tasks, failed_tasks );
 						}
 						
 						return;						
@@ -187,7 +189,7 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 			}
 		}
 
-		EExecuteDBTaskListResult Process_Child_Task_List( IDatabaseCallContext *call_context, IDatabaseConnection *connection, const DBTaskListType &child_list, EDatabaseTaskIDType &bad_task_id )
+		EExecuteDBTaskListResult Process_Child_Task_List( IDatabaseCallContext *call_context, IDatabaseConnection *connection, DBTaskVectorType &child_list, EDatabaseTaskIDType &bad_task_id )
 		{
 			if ( child_list.empty() )
 			{
@@ -196,7 +198,7 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 
 			if ( call_context->Get_Statement_Text().size() == 0 )
 			{
-				IDatabaseTask *first_task = *child_list.begin();
+				IDatabaseTask *first_task = child_list.front();
 				FATAL_ASSERT( connection->Validate_Input_Output_Signatures( first_task, call_context->Get_Param_Rows(), call_context->Get_Result_Rows() ) );
 
 				std::wstring statement_text;
@@ -216,26 +218,22 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 
 			FATAL_ASSERT( statement->Is_Ready_For_Use() );
 
-			DBTaskListType child_list_copy;
-			std::copy( child_list.begin(), child_list.end(), back_inserter(child_list_copy) );
-
-			while ( !child_list_copy.empty() )
+			DBTaskRangeType remaining( child_list.data(), child_list.data() + child_list.size() );
+			while ( !remaining.empty() )
 			{
-				DBTaskListType sub_list;
-
-				auto end_of_splice_iter = child_list_copy.begin();
-				std::advance( end_of_splice_iter, std::min( static_cast<uint32_t>(child_list_copy.size()), call_context->Get_Param_Row_Count() ) );
-				sub_list.splice( sub_list.end(), child_list_copy, child_list_copy.begin(), end_of_splice_iter );
+				size_t sub_list_size = std::min< size_t >( remaining.size(), call_context->Get_Param_Row_Count() );
+				DBTaskRangeType sub_list = remaining.Sub_Range( 0, sub_list_size );
+				remaining = remaining.Sub_Range( sub_list_size, remaining.size() - sub_list_size );
 
 				EExecuteDBTaskListResult result = EExecuteDBTaskListResult::SUCCESS;
-				DBTaskListType::const_iterator failure_iter = sub_list.end();
+				uint32_t failure_index = 0;
 				
-				Execute_Task_List( call_context, statement, sub_list, result, failure_iter );
+				Execute_Task_List( call_context, statement, sub_list, result, failure_index );
 				if ( result != EExecuteDBTaskListResult::SUCCESS )
 				{
 					if ( result == EExecuteDBTaskListResult::FAILED_SPECIFIC_TASK )
 					{
-						bad_task_id = ( *failure_iter )->Get_ID();
+						bad_task_id = sub_list[ failure_index ]->Get_ID();
 					}
 
 					return result;
@@ -256,7 +254,7 @@ class TCompoundDatabaseTaskBatch : public ICompoundDatabaseTaskBatch
 		ChildTypeVector ChildOrdering;
 		ChildCallContextTable ChildCallContexts;
 
-		DBCompoundTaskListType PendingTasks;
+		DBCompoundTaskQueueType PendingTasks;
 
 		std::string TaskName;
 };
@@ -0,0 +1,150 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "DatabaseBatchSizeController.h"
+
+namespace IP
+{
+namespace Db
+{
+
+static const double DEFAULT_TARGET_ROUND_TRIP_SECONDS = .05;
+static const double MIN_ROUND_TRIP_SECONDS = .000001;
+
+// Weight given to the newest sample in the running averages
+static const double SAMPLE_SMOOTHING = .25;
+
+// A larger batch must keep at least this fraction of the best observed throughput to be considered an improvement
+static const double THROUGHPUT_TOLERANCE = .95;
+
+// Decay applied to the best observed throughput on every backlogged sample so that stale peaks don't pin the size
+static const double BEST_THROUGHPUT_DECAY = .98;
+
+
+CDatabaseBatchSizeController::CDatabaseBatchSizeController( uint32_t max_batch_size ) :
+	CDatabaseBatchSizeController( max_batch_size, DEFAULT_TARGET_ROUND_TRIP_SECONDS )
+{
+}
+
+
+CDatabaseBatchSizeController::CDatabaseBatchSizeController( uint32_t max_batch_size, double target_round_trip_seconds ) :
+	MaxBatchSize( max_batch_size ),
+	EffectiveBatchSize( 1 ),
+	TargetRoundTripSeconds( target_round_trip_seconds ),
+	AverageRoundTripSeconds( 0.0 ),
+	AverageThroughput( 0.0 ),
+	BestThroughput( 0.0 ),
+	BestThroughputBatchSize( 1 ),
+	SampleCount( 0 )
+{
+	FATAL_ASSERT( MaxBatchSize > 0 );
+	FATAL_ASSERT( TargetRoundTripSeconds > 0.0 );
+}
+
+
+uint32_t CDatabaseBatchSizeController::Get_Batch_Size( uint32_t pending_task_count ) const
+{
+	return std::min( pending_task_count, EffectiveBatchSize );
+}
+
+
+void CDatabaseBatchSizeController::On_Batch_Executed( uint32_t batch_size, uint32_t pending_task_count, double round_trip_seconds )
+{
+	if ( batch_size == 0 )
+	{
+		return;
+	}
+
+	round_trip_seconds = std::max( round_trip_seconds, MIN_ROUND_TRIP_SECONDS );
+	double throughput = static_cast< double >( batch_size ) / round_trip_seconds;
+
+	if ( SampleCount == 0 )
+	{
+		AverageRoundTripSeconds = round_trip_seconds;
+		AverageThroughput = throughput;
+	}
+	else
+	{
+		AverageRoundTripSeconds += SAMPLE_SMOOTHING * ( round_trip_seconds - AverageRoundTripSeconds );
+		AverageThroughput += SAMPLE_SMOOTHING * ( throughput - AverageThroughput );
+	}
+
+	++SampleCount;
+
+	// pending_task_count includes the batch that was just executed
+	if ( pending_task_count > EffectiveBatchSize )
+	{
+		On_Backlogged_Batch( batch_size, throughput );
+	}
+	else
+	{
+		On_Unbacklogged_Batch( pending_task_count );
+	}
+}
+
+
+void CDatabaseBatchSizeController::On_Backlogged_Batch( uint32_t batch_size, double throughput )
+{
+	BestThroughput *= BEST_THROUGHPUT_DECAY;
+
+	// A short batch says nothing about whether the current size is paying for itself
+	if ( batch_size != EffectiveBatchSize )
+	{
+		return;
+	}
+
+	if ( throughput >= BestThroughput * THROUGHPUT_TOLERANCE )
+	{
+		if ( throughput > BestThroughput )
+		{
+			BestThroughput = throughput;
+			BestThroughputBatchSize = EffectiveBatchSize;
+		}
+
+		EffectiveBatchSize = std::min( MaxBatchSize, EffectiveBatchSize * 2 );
+	}
+	else
+	{
+		// Growing stopped helping; settle back on the best size seen so far
+		EffectiveBatchSize = BestThroughputBatchSize;
+	}
+}
+
+
+void CDatabaseBatchSizeController::On_Unbacklogged_Batch( uint32_t pending_task_count )
+{
+	if ( AverageRoundTripSeconds > TargetRoundTripSeconds )
+	{
+		EffectiveBatchSize = std::max< uint32_t >( 1, EffectiveBatchSize / 2 );
+	}
+	else if ( pending_task_count < EffectiveBatchSize )
+	{
+		// Drift toward the observed demand so that the next burst starts with a latency-friendly batch
+		EffectiveBatchSize -= ( EffectiveBatchSize - pending_task_count ) / 4;
+		EffectiveBatchSize = std::max< uint32_t >( 1, EffectiveBatchSize );
+	}
+
+	BestThroughputBatchSize = std::min( BestThroughputBatchSize, EffectiveBatchSize );
+}
+
+} // namespace Db
+} // namespace IP
@@ -0,0 +1,67 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+namespace IP
+{
+namespace Db
+{
+
+// Picks how many tasks of a single type to submit per statement execution, based on observed round-trip time and
+// throughput.  With nothing queued behind a batch it favors latency and keeps batches small; under a backlog it
+// grows batches toward the compile-time capacity of the task's call context for as long as throughput keeps improving.
+class CDatabaseBatchSizeController
+{
+	public:
+
+		CDatabaseBatchSizeController( uint32_t max_batch_size );
+		CDatabaseBatchSizeController( uint32_t max_batch_size, double target_round_trip_seconds );
+
+		uint32_t Get_Batch_Size( uint32_t pending_task_count ) const;
+		void On_Batch_Executed( uint32_t batch_size, uint32_t pending_task_count, double round_trip_seconds );
+
+		uint32_t Get_Max_Batch_Size( void ) const { return MaxBatchSize; }
+		uint32_t Get_Effective_Batch_Size( void ) const { return EffectiveBatchSize; }
+
+		double Get_Target_Round_Trip_Seconds( void ) const { return TargetRoundTripSeconds; }
+		double Get_Average_Round_Trip_Seconds( void ) const { return AverageRoundTripSeconds; }
+		double Get_Average_Throughput( void ) const { return AverageThroughput; }
+
+	private:
+
+		void On_Backlogged_Batch( uint32_t batch_size, double throughput );
+		void On_Unbacklogged_Batch( uint32_t pending_task_count );
+
+		uint32_t MaxBatchSize;
+		uint32_t EffectiveBatchSize;
+
+		double TargetRoundTripSeconds;
+		double AverageRoundTripSeconds;
+		double AverageThroughput;
+
+		double BestThroughput;
+		uint32_t BestThroughputBatchSize;
+
+		uint32_t SampleCount;
+};
+
+} // namespace Db
+} // namespace IP
@@ -41,7 +41,9 @@ class CDatabaseTaskBase : public IDatabaseTask
 		CDatabaseTaskBase::CDatabaseTaskBase( void ) :
 			BASECLASS(),
 			Parent( nullptr ),
-			ID( EDatabaseTaskIDType::INVALID )
+			ID( EDatabaseTaskIDType::INVALID ),
+			Result( EDatabaseTaskResult::PENDING ),
+			Deadline( 0.0 )
 		{}
 
 		virtual ~CDatabaseTaskBase() {}
@@ -49,16 +51,31 @@ class CDatabaseTaskBase : public IDatabaseTask
 		virtual EDatabaseTaskIDType Get_ID( void ) const { return ID; }
 		virtual void Set_ID( EDatabaseTaskIDType id ) { ID = id; }
 
+		virtual EDatabaseTaskCoalesceRule Get_Coalesce_Rule( void ) const { return EDatabaseTaskCoalesceRule::NONE; }
+		virtual uint64_t Get_Coalesce_Key( void ) const { return 0; }
+
+		virtual EDatabaseTaskResult Get_Result( void ) const { return Result; }
+		virtual void Set_Result( EDatabaseTaskResult result ) { Result = result; }
+
+		virtual double Get_Deadline( void ) const { return Deadline; }
+		virtual void Set_Deadline( double deadline ) { Deadline = deadline; }
+
 	protected:
 
 		virtual void Set_Parent( ICompoundDatabaseTask *parent );
 		virtual ICompoundDatabaseTask *Get_Parent( void ) const { return Parent; }
 
+		virtual void Merge_Superseded_Task( IDatabaseTask * /*older_task*/ ) { FATAL_ASSERT( false ); }
+
 	private:
 
 		ICompoundDatabaseTask *Parent;
 
 		EDatabaseTaskIDType ID;
+
+		EDatabaseTaskResult Result;
+
+		double Deadline;
 };
 
 template < typename I, uint32_t ISIZE >
@@ -168,6 +185,7 @@ class CCompoundDatabaseTaskBase : public ICompoundDatabaseTask
 		CCompoundDatabaseTaskBase( void ) :
 			BASECLASS(),
 			ID( EDatabaseTaskIDType::INVALID ),
+			Result( EDatabaseTaskResult::PENDING ),
 			Children(),
 			SuccessCallbacks()
 		{}
@@ -178,6 +196,9 @@ class CCompoundDatabaseTaskBase : public ICompoundDatabaseTask
 		virtual EDatabaseTaskIDType Get_ID( void ) const { return ID; }
 		virtual void Set_ID( EDatabaseTaskIDType id ) { ID = id; }
 
+		virtual EDatabaseTaskResult Get_Result( void ) const { return Result; }
+		virtual void Set_Result( EDatabaseTaskResult result ) { Result = result; }
+
 		// ICompoundDatabaseTask interface
 		virtual void Add_Child_Task( IDatabaseTask *task );
 		virtual void On_Child_Task_Success( const Loki::TypeInfo &child_type );
@@ -202,6 +223,8 @@ class CCompoundDatabaseTaskBase : public ICompoundDatabaseTask
 
 		EDatabaseTaskIDType ID;
 
+		EDatabaseTaskResult Result;
+
 		DBTaskListTableType Children;
 
 		ChildTypeCallbackTableType SuccessCallbacks;
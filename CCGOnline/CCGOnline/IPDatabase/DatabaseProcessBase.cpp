@@ -25,6 +25,8 @@
 #include "Interfaces/DatabaseConnectionInterface.h"
 #include "Interfaces/DatabaseEnvironmentInterface.h"
 #include "Interfaces/DatabaseTaskInterface.h"
+#include "DatabaseResultCache.h"
+#include "DatabaseStatementWatchdog.h"
 #include "IPShared/MessageHandling/ProcessMessageHandler.h"
 #include "DatabaseProcessMessages.h"
 
@@ -40,6 +42,10 @@ CDatabaseProcessBase::CDatabaseProcessBase( IDatabaseEnvironment *environment, c
 	Batches(),
 	BatchOrdering(),
 	PendingRequests(),
+	ResultCache( new CDatabaseResultCache ),
+	ResultCacheInvalidators(),
+	CachedSuccesses(),
+	Watchdog( new CDatabaseStatementWatchdog ),
 	NextID( static_cast< EDatabaseTaskIDType >( static_cast< uint32_t >( EDatabaseTaskIDType::INVALID ) + 1 ) ),
 	Environment( environment ),
 	ConnectionString( connection_string ),
@@ -61,6 +67,8 @@ void CDatabaseProcessBase::Initialize( EProcessID id )
 
 	Connection = Environment->Add_Connection( ConnectionString.c_str(), true );
 	FATAL_ASSERT( Connection != nullptr );
+
+	Watchdog->Start();
 }
 
 void CDatabaseProcessBase::Cleanup( void )
@@ -69,7 +77,11 @@ void CDatabaseProcessBase::Cleanup( void )
 
 	BASECLASS::Cleanup();
 
+	Watchdog->Stop();
+
 	PendingRequests.clear();
+	CachedSuccesses.clear();
+	ResultCache->Clear();
 
 	for ( auto iter = Batches.cbegin(); iter != Batches.end(); ++iter )
 	{
@@ -99,13 +111,23 @@ void CDatabaseProcessBase::Per_Frame_Logic_End( void )
 	DBTaskBaseListType successes;
 	DBTaskBaseListType failures;
 
+	// tasks answered from the result cache complete alongside everything that actually ran
+	successes.swap( CachedSuccesses );
+
 	for ( auto iter = BatchOrdering.cbegin(), end = BatchOrdering.cend(); iter != end; ++iter )
 	{
 		auto batch_task_iter = Batches.find( *iter );
 		FATAL_ASSERT( batch_task_iter != Batches.end() );
 
+		// batches are free to reset the lists they are given, so each one gets its own
+		DBTaskBaseListType batch_successes;
+		DBTaskBaseListType batch_failures;
+
 		IDatabaseTaskBatch *batch = batch_task_iter->second;
-		batch->Execute_Tasks( Connection, successes, failures );
+		batch->Execute_Tasks( Connection, batch_successes, batch_failures );
+
+		successes.splice( successes.end(), batch_successes );
+		failures.splice( failures.end(), batch_failures );
 	}
 
 	for ( auto success_iter = successes.cbegin(), end = successes.cend(); success_iter != end; ++success_iter )
@@ -114,13 +136,16 @@ void CDatabaseProcessBase::Per_Frame_Logic_End( void )
 		auto pending_request_iter = PendingRequests.find( task->Get_ID() );
 		FATAL_ASSERT( pending_request_iter != PendingRequests.end() );
 
+		Invalidate_Dependent_Results( task );
+		task->Set_Result( EDatabaseTaskResult::SUCCESS );
+
 		if ( ProcessTaskResultsLocally )
 		{
 			( *success_iter )->On_Task_Success();
 		}
 		else
 		{
-			std::unique_ptr< const Messaging::IProcessMessage > response( new  Messaging::CRunDatabaseTaskResponse( pending_request_iter->second.second, true ) );
+			std::unique_ptr< const Messaging::IProcessMessage > response( new  Messaging::CRunDatabaseTaskResponse( pending_request_iter->second.second, EDatabaseTaskResult::SUCCESS ) );
 			Send_Process_Message( pending_request_iter->second.first, response );
 		}
 
@@ -133,13 +158,19 @@ void CDatabaseProcessBase::Per_Frame_Logic_End( void )
 		auto pending_request_iter = PendingRequests.find( task->Get_ID() );
 		FATAL_ASSERT( pending_request_iter != PendingRequests.end() );
 
+		// deadline failures are already tagged by the batch; everything else is an execution failure
+		if ( task->Get_Result() == EDatabaseTaskResult::PENDING )
+		{
+			task->Set_Result( EDatabaseTaskResult::FAILED );
+		}
+
 		if ( ProcessTaskResultsLocally )
 		{
 			( *failure_iter )->On_Task_Failure();
 		}
 		else
 		{
-			std::unique_ptr< const  Messaging::IProcessMessage > response( new  Messaging::CRunDatabaseTaskResponse( pending_request_iter->second.second, false ) );
+			std::unique_ptr< const  Messaging::IProcessMessage > response( new  Messaging::CRunDatabaseTaskResponse( pending_request_iter->second.second, task->Get_Result() ) );
 			Send_Process_Message( pending_request_iter->second.first, response );
 		}
 
@@ -166,10 +197,46 @@ void CDatabaseProcessBase::Add_Batch( IDatabaseTaskBatch *batch )
 	Loki::TypeInfo type_info = batch->Get_Task_Type_Info();
 	FATAL_ASSERT( Batches.find( type_info ) == Batches.end() );
 
+	batch->Set_Statement_Watchdog( Watchdog.get() );
+
 	Batches.insert( BatchTableType::value_type( type_info, batch ) );
 	BatchOrdering.push_back( type_info );
 }
 
+void CDatabaseProcessBase::Enable_Result_Caching( const Loki::TypeInfo &task_type )
+{
+	auto iter = Batches.find( task_type );
+	FATAL_ASSERT( iter != Batches.end() );
+
+	iter->second->Enable_Result_Caching( ResultCache.get() );
+}
+
+void CDatabaseProcessBase::Add_Result_Cache_Invalidator( const Loki::TypeInfo &writer_type, const Loki::TypeInfo &cached_type )
+{
+	ResultCacheInvalidators[ writer_type ].push_back( cached_type );
+}
+
+void CDatabaseProcessBase::Invalidate_Cached_Results( const Loki::TypeInfo &task_type )
+{
+	ResultCache->Invalidate( task_type );
+}
+
+void CDatabaseProcessBase::Set_Result_Cache_Limits( size_t max_entries, double time_to_live_seconds )
+{
+	ResultCache->Set_Limits( max_entries, time_to_live_seconds );
+}
+
+void CDatabaseProcessBase::Invalidate_Dependent_Results( const IDatabaseTaskBase *task )
+{
+	auto iter = ResultCacheInvalidators.find( Loki::TypeInfo( typeid( *task ) ) );
+	if ( iter == ResultCacheInvalidators.end() )
+	{
+		return;
+	}
+
+	std::for_each( iter->second.cbegin(), iter->second.cend(), [ this ]( const Loki::TypeInfo &cached_type ){ ResultCache->Invalidate( cached_type ); } );
+}
+
 void CDatabaseProcessBase::Handle_Run_Database_Task_Request( EProcessID process_id, std::unique_ptr< const Messaging::CRunDatabaseTaskRequest > &message )
 {
 	IDatabaseTask *task = message->Get_Task();
@@ -180,7 +247,16 @@ void CDatabaseProcessBase::Handle_Run_Database_Task_Request( EProcessID process_
 
 	IP::Db::EDatabaseTaskIDType task_id = Allocate_Task_ID();
 	task->Set_ID( task_id );
-	iter->second->Add_Task( task );
+
+	IDatabaseTaskBatch *batch = iter->second;
+	if ( batch->Try_Complete_From_Result_Cache( task, Get_Current_Process_Time() ) )
+	{
+		CachedSuccesses.push_back( task );
+	}
+	else
+	{
+		batch->Add_Task( task );
+	}
 
 	PendingRequests.insert( PendingRequestTableType::value_type( task_id, PendingRequestPairType( process_id, std::move( message ) ) ) );
 }
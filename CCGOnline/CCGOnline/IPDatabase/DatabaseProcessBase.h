@@ -20,6 +20,7 @@
 #pragma once
 
 #include "IPShared/Concurrency/ThreadProcessBase.h"
+#include "IPDatabase/DatabaseTypes.h"
 
 namespace IP
 {
@@ -29,6 +30,8 @@ namespace Db
 class IDatabaseConnection;
 class IDatabaseEnvironment;
 class IDatabaseTaskBatch;
+class CDatabaseResultCache;
+class CDatabaseStatementWatchdog;
 
 enum class EDatabaseTaskIDType;
 
@@ -60,6 +63,8 @@ class CDatabaseProcessBase : public CThreadProcessBase
 		// IManagedProcess interface
 		virtual void Cleanup( void );
 
+		const IP::Db::CDatabaseResultCache &Get_Result_Cache( void ) const { return *ResultCache; }
+
 	protected:
 
 		// CProcessBase interface
@@ -71,23 +76,39 @@ class CDatabaseProcessBase : public CThreadProcessBase
 
 		void Add_Batch( IP::Db::IDatabaseTaskBatch *batch );
 
+		// Read-through caching of task results; only enable for task types that do not modify the database
+		void Enable_Result_Caching( const Loki::TypeInfo &task_type );
+		void Add_Result_Cache_Invalidator( const Loki::TypeInfo &writer_type, const Loki::TypeInfo &cached_type );
+		void Invalidate_Cached_Results( const Loki::TypeInfo &task_type );
+		void Set_Result_Cache_Limits( size_t max_entries, double time_to_live_seconds );
+
 	private:
 
 		void Handle_Run_Database_Task_Request( EProcessID process_id, std::unique_ptr< const Messaging::CRunDatabaseTaskRequest > &message );
 
 		IP::Db::EDatabaseTaskIDType Allocate_Task_ID( void );
 
+		void Invalidate_Dependent_Results( const IP::Db::IDatabaseTaskBase *task );
+
 		using BatchTableType = std::unordered_map< Loki::TypeInfo, IP::Db::IDatabaseTaskBatch *, STypeInfoContainerHelper >;
 		using BatchOrderingType = std::vector< Loki::TypeInfo >;
 
 		using PendingRequestPairType = std::pair< EProcessID, std::unique_ptr< const Messaging::CRunDatabaseTaskRequest > >;
 		using PendingRequestTableType = std::unordered_map< IP::Db::EDatabaseTaskIDType, PendingRequestPairType >;
 
+		using CacheInvalidatorTableType = std::unordered_map< Loki::TypeInfo, std::vector< Loki::TypeInfo >, STypeInfoContainerHelper >;
+
 		BatchTableType Batches;
 		BatchOrderingType BatchOrdering;
 
 		PendingRequestTableType PendingRequests;
 
+		std::unique_ptr< IP::Db::CDatabaseResultCache > ResultCache;
+		CacheInvalidatorTableType ResultCacheInvalidators;
+		DBTaskBaseListType CachedSuccesses;
+
+		std::unique_ptr< IP::Db::CDatabaseStatementWatchdog > Watchdog;
+
 		IP::Db::EDatabaseTaskIDType NextID;
 
 		IP::Db::IDatabaseEnvironment *Environment;
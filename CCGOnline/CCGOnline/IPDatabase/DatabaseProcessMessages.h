@@ -20,6 +20,7 @@
 #pragma once
 
 #include "IPShared/Concurrency/Messaging/ProcessMessage.h"
+#include "IPDatabase/Interfaces/DatabaseTaskBaseInterface.h"
 
 namespace IP
 {
@@ -61,20 +62,21 @@ class CRunDatabaseTaskResponse : public IProcessMessage
 
 		using BASECLASS = IProcessMessage;
 		
-		CRunDatabaseTaskResponse( std::unique_ptr< const CRunDatabaseTaskRequest > &request, bool success ) :
+		CRunDatabaseTaskResponse( std::unique_ptr< const CRunDatabaseTaskRequest > &request, IP::Db::EDatabaseTaskResult result ) :
 			Request( std::move( request ) ),
-			Success( success )
+			Result( result )
 		{}
 
 		virtual ~CRunDatabaseTaskResponse();
 
 		const std::unique_ptr< const CRunDatabaseTaskRequest > &Get_Request( void ) const { return Request; }
-		bool Was_Successful( void ) const { return Success; }
+		bool Was_Successful( void ) const { return Result == IP::Db::EDatabaseTaskResult::SUCCESS; }
+		IP::Db::EDatabaseTaskResult Get_Result( void ) const { return Result; }
 
 	private:
 
 		std::unique_ptr< const CRunDatabaseTaskRequest > Request;
-		bool Success;
+		IP::Db::EDatabaseTaskResult Result;
 };
 
 } // namespace Messaging
@@ -0,0 +1,170 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "DatabaseResultCache.h"
+
+namespace IP
+{
+namespace Db
+{
+
+static const size_t DEFAULT_MAX_ENTRIES = 4096;
+static const double DEFAULT_TIME_TO_LIVE_SECONDS = 30.0;
+
+
+CDatabaseResultCache::CDatabaseResultCache( void ) :
+	CDatabaseResultCache( DEFAULT_MAX_ENTRIES, DEFAULT_TIME_TO_LIVE_SECONDS )
+{
+}
+
+
+CDatabaseResultCache::CDatabaseResultCache( size_t max_entries, double time_to_live_seconds ) :
+	Entries(),
+	Index(),
+	MaxEntries( max_entries ),
+	TimeToLiveSeconds( time_to_live_seconds ),
+	HitCount( 0 ),
+	MissCount( 0 )
+{
+	FATAL_ASSERT( MaxEntries > 0 );
+}
+
+
+CDatabaseResultCache::~CDatabaseResultCache()
+{
+}
+
+
+const IDatabaseResultCacheEntry *CDatabaseResultCache::Find( const Loki::TypeInfo &task_type, const std::string &key, double current_time_seconds )
+{
+	auto type_iter = Index.find( task_type );
+	if ( type_iter != Index.end() )
+	{
+		auto key_iter = type_iter->second.find( key );
+		if ( key_iter != type_iter->second.end() )
+		{
+			EntryListType::iterator entry_iter = key_iter->second;
+			if ( entry_iter->ExpirationTimeSeconds > current_time_seconds )
+			{
+				Entries.splice( Entries.begin(), Entries, entry_iter );
+				++HitCount;
+				return entry_iter->Entry.get();
+			}
+
+			Remove_Entry( entry_iter );
+		}
+	}
+
+	++MissCount;
+	return nullptr;
+}
+
+
+void CDatabaseResultCache::Insert( const Loki::TypeInfo &task_type, const std::string &key, std::unique_ptr< IDatabaseResultCacheEntry > &&entry, double capture_time_seconds )
+{
+	FATAL_ASSERT( entry.get() != nullptr );
+
+	Invalidate( task_type, key );
+
+	Entries.emplace_front( task_type, key, std::move( entry ), capture_time_seconds + TimeToLiveSeconds );
+	Index[ task_type ][ key ] = Entries.begin();
+
+	Enforce_Entry_Limit();
+}
+
+
+void CDatabaseResultCache::Invalidate( const Loki::TypeInfo &task_type )
+{
+	auto type_iter = Index.find( task_type );
+	if ( type_iter == Index.end() )
+	{
+		return;
+	}
+
+	for ( auto iter = type_iter->second.cbegin(), end = type_iter->second.cend(); iter != end; ++iter )
+	{
+		Entries.erase( iter->second );
+	}
+
+	Index.erase( type_iter );
+}
+
+
+void CDatabaseResultCache::Invalidate( const Loki::TypeInfo &task_type, const std::string &key )
+{
+	auto type_iter = Index.find( task_type );
+	if ( type_iter == Index.end() )
+	{
+		return;
+	}
+
+	auto key_iter = type_iter->second.find( key );
+	if ( key_iter != type_iter->second.end() )
+	{
+		Remove_Entry( key_iter->second );
+	}
+}
+
+
+void CDatabaseResultCache::Clear( void )
+{
+	Entries.clear();
+	Index.clear();
+}
+
+
+void CDatabaseResultCache::Set_Limits( size_t max_entries, double time_to_live_seconds )
+{
+	FATAL_ASSERT( max_entries > 0 );
+
+	MaxEntries = max_entries;
+	TimeToLiveSeconds = time_to_live_seconds;
+
+	Enforce_Entry_Limit();
+}
+
+
+void CDatabaseResultCache::Remove_Entry( EntryListType::iterator entry_iter )
+{
+	auto type_iter = Index.find( entry_iter->TaskType );
+	FATAL_ASSERT( type_iter != Index.end() );
+
+	type_iter->second.erase( entry_iter->Key );
+	if ( type_iter->second.empty() )
+	{
+		Index.erase( type_iter );
+	}
+
+	Entries.erase( entry_iter );
+}
+
+
+void CDatabaseResultCache::Enforce_Entry_Limit( void )
+{
+	while ( Entries.size() > MaxEntries )
+	{
+		Remove_Entry( std::prev( Entries.end() ) );
+	}
+}
+
+} // namespace Db
+} // namespace IP
@@ -0,0 +1,158 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include "Interfaces/DatabaseTaskInterface.h"
+#include "Interfaces/DatabaseVariableSetInterface.h"
+
+namespace IP
+{
+namespace Db
+{
+
+// A captured, completed execution of a task that can be handed to an equivalent task without touching the database
+class IDatabaseResultCacheEntry
+{
+	public:
+
+		IDatabaseResultCacheEntry( void ) {}
+		virtual ~IDatabaseResultCacheEntry() {}
+
+		virtual void Replay( IDatabaseTask *task ) const = 0;
+};
+
+// Copies of every result row and the final parameter row a task of type T received during execution
+template < typename T >
+class TDatabaseResultCacheEntry : public IDatabaseResultCacheEntry
+{
+	public:
+
+		using BASECLASS = IDatabaseResultCacheEntry;
+		using InputParametersType = typename T::InputParametersType;
+		using ResultSetType = typename T::ResultSetType;
+
+		TDatabaseResultCacheEntry( void ) :
+			BASECLASS(),
+			Results(),
+			FinalParameters()
+		{}
+
+		virtual ~TDatabaseResultCacheEntry() {}
+
+		virtual void Replay( IDatabaseTask *task ) const
+		{
+			for ( size_t i = 0; i < Results.size(); i += T::ResultSetBatchSize )
+			{
+				size_t row_count = std::min< size_t >( Results.size() - i, T::ResultSetBatchSize );
+				ResultSetType *rows = const_cast< ResultSetType * >( &Results[ i ] );
+
+				task->On_Fetch_Results( rows, static_cast< int64_t >( row_count ) );
+			}
+
+			InputParametersType final_parameters( FinalParameters );
+			task->On_Fetch_Results_Finished( &final_parameters );
+		}
+
+		void Add_Results( IDatabaseVariableSet *result_set, int64_t rows_fetched )
+		{
+			ResultSetType *rows = static_cast< ResultSetType * >( result_set );
+			Results.insert( Results.end(), rows, rows + rows_fetched );
+		}
+
+		void Set_Final_Parameters( IDatabaseVariableSet *input_parameters ) 
+		{ 
+			FinalParameters = *static_cast< InputParametersType * >( input_parameters ); 
+		}
+
+		void Reset( void ) { Results.clear(); }
+
+	private:
+
+		std::vector< ResultSetType > Results;
+		InputParametersType FinalParameters;
+};
+
+// Bounded, time-limited store of completed read results, keyed by task type and the string form of the input parameters.
+// Least recently used entries are evicted first once the entry limit is reached.
+class CDatabaseResultCache
+{
+	public:
+
+		CDatabaseResultCache( void );
+		CDatabaseResultCache( size_t max_entries, double time_to_live_seconds );
+		~CDatabaseResultCache();
+
+		CDatabaseResultCache( const CDatabaseResultCache &rhs ) = delete;
+		CDatabaseResultCache &operator =( const CDatabaseResultCache &rhs ) = delete;
+
+		const IDatabaseResultCacheEntry *Find( const Loki::TypeInfo &task_type, const std::string &key, double current_time_seconds );
+		void Insert( const Loki::TypeInfo &task_type, const std::string &key, std::unique_ptr< IDatabaseResultCacheEntry > &&entry, double capture_time_seconds );
+
+		void Invalidate( const Loki::TypeInfo &task_type );
+		void Invalidate( const Loki::TypeInfo &task_type, const std::string &key );
+		void Clear( void );
+
+		void Set_Limits( size_t max_entries, double time_to_live_seconds );
+
+		size_t Get_Entry_Count( void ) const { return Entries.size(); }
+		size_t Get_Max_Entries( void ) const { return MaxEntries; }
+		double Get_Time_To_Live_Seconds( void ) const { return TimeToLiveSeconds; }
+
+		uint64_t Get_Hit_Count( void ) const { return HitCount; }
+		uint64_t Get_Miss_Count( void ) const { return MissCount; }
+
+	private:
+
+		struct SCacheEntry
+		{
+			SCacheEntry( const Loki::TypeInfo &task_type, const std::string &key, std::unique_ptr< IDatabaseResultCacheEntry > &&entry, double expiration_time_seconds ) :
+				TaskType( task_type ),
+				Key( key ),
+				Entry( std::move( entry ) ),
+				ExpirationTimeSeconds( expiration_time_seconds )
+			{}
+
+			Loki::TypeInfo TaskType;
+			std::string Key;
+			std::unique_ptr< IDatabaseResultCacheEntry > Entry;
+			double ExpirationTimeSeconds;
+		};
+
+		using EntryListType = std::list< SCacheEntry >;
+		using KeyTableType = std::unordered_map< std::string, EntryListType::iterator >;
+		using TypeTableType = std::unordered_map< Loki::TypeInfo, KeyTableType, STypeInfoContainerHelper >;
+
+		void Remove_Entry( EntryListType::iterator entry_iter );
+		void Enforce_Entry_Limit( void );
+
+		// most recently used at the front
+		EntryListType Entries;
+		TypeTableType Index;
+
+		size_t MaxEntries;
+		double TimeToLiveSeconds;
+
+		uint64_t HitCount;
+		uint64_t MissCount;
+};
+
+} // namespace Db
+} // namespace IP
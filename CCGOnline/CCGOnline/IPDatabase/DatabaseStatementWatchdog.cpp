@@ -0,0 +1,135 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "DatabaseStatementWatchdog.h"
+
+#include "Interfaces/DatabaseStatementInterface.h"
+#include "DatabaseTaskBatchUtilities.h"
+
+namespace IP
+{
+namespace Db
+{
+
+CDatabaseStatementWatchdog::CDatabaseStatementWatchdog( void ) :
+	Lock(),
+	WatchSignal(),
+	WatchThread(),
+	Statement( nullptr ),
+	Deadline( 0.0 ),
+	Cancelled( false ),
+	Stopping( false ),
+	CancelCount( 0 )
+{
+}
+
+
+CDatabaseStatementWatchdog::~CDatabaseStatementWatchdog()
+{
+	Stop();
+}
+
+
+void CDatabaseStatementWatchdog::Start( void )
+{
+	FATAL_ASSERT( !WatchThread.joinable() );
+
+	Stopping = false;
+	WatchThread = std::thread( &CDatabaseStatementWatchdog::Run, this );
+}
+
+
+void CDatabaseStatementWatchdog::Stop( void )
+{
+	if ( !WatchThread.joinable() )
+	{
+		return;
+	}
+
+	{
+		std::lock_guard< std::mutex > lock( Lock );
+		Stopping = true;
+	}
+
+	WatchSignal.notify_one();
+	WatchThread.join();
+}
+
+
+void CDatabaseStatementWatchdog::Watch( IDatabaseStatement *statement, double deadline )
+{
+	FATAL_ASSERT( statement != nullptr );
+
+	{
+		std::lock_guard< std::mutex > lock( Lock );
+		FATAL_ASSERT( Statement == nullptr );
+
+		Statement = statement;
+		Deadline = deadline;
+		Cancelled = false;
+	}
+
+	WatchSignal.notify_one();
+}
+
+
+bool CDatabaseStatementWatchdog::Unwatch( void )
+{
+	std::lock_guard< std::mutex > lock( Lock );
+
+	bool cancelled = Cancelled;
+	Statement = nullptr;
+	Cancelled = false;
+
+	return cancelled;
+}
+
+
+void CDatabaseStatementWatchdog::Run( void )
+{
+	std::unique_lock< std::mutex > lock( Lock );
+
+	while ( !Stopping )
+	{
+		if ( Statement == nullptr || Cancelled )
+		{
+			WatchSignal.wait( lock );
+			continue;
+		}
+
+		double current_time = Get_Database_Task_Time();
+		if ( current_time < Deadline )
+		{
+			WatchSignal.wait_for( lock, std::chrono::duration< double >( Deadline - current_time ) );
+			continue;
+		}
+
+		// Cancelling under the lock guarantees the statement can't be released out from under us by the executing thread.
+		// Logging is left to the executing thread; the log interface is not safe to use from here.
+		Statement->Cancel();
+		Cancelled = true;
+		++CancelCount;
+	}
+}
+
+} // namespace Db
+} // namespace IP
@@ -0,0 +1,71 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include <condition_variable>
+
+namespace IP
+{
+namespace Db
+{
+
+class IDatabaseStatement;
+
+// Cancels the statement a database process is executing once it runs past the earliest deadline of the tasks it carries.
+// The process's connection is only ever used by one thread, so only one statement is watched at a time.
+class CDatabaseStatementWatchdog
+{
+	public:
+
+		CDatabaseStatementWatchdog( void );
+		~CDatabaseStatementWatchdog();
+
+		CDatabaseStatementWatchdog( const CDatabaseStatementWatchdog &rhs ) = delete;
+		CDatabaseStatementWatchdog &operator =( const CDatabaseStatementWatchdog &rhs ) = delete;
+
+		void Start( void );
+		void Stop( void );
+
+		void Watch( IDatabaseStatement *statement, double deadline );
+
+		// Returns true if the watched statement was cancelled; once this returns the statement will not be touched again
+		bool Unwatch( void );
+
+		uint64_t Get_Cancel_Count( void ) const { return CancelCount; }
+
+	private:
+
+		void Run( void );
+
+		std::mutex Lock;
+		std::condition_variable WatchSignal;
+		std::thread WatchThread;
+
+		IDatabaseStatement *Statement;
+		double Deadline;
+		bool Cancelled;
+		bool Stopping;
+
+		std::atomic< uint64_t > CancelCount;
+};
+
+} // namespace Db
+} // namespace IP
@@ -24,6 +24,10 @@
 #include "Interfaces/DatabaseStatementInterface.h"
 #include "Interfaces/DatabaseTaskInterface.h"
 #include "DatabaseTaskBatchUtilities.h"
+#include "DatabaseTaskQueue.h"
+#include "DatabaseBatchSizeController.h"
+#include "DatabaseResultCache.h"
+#include "DatabaseStatementWatchdog.h"
 #include "DatabaseTypes.h"
 #include "DatabaseCallContext.h"
 #include "IPShared/Logging/LogInterface.h"
@@ -34,7 +38,7 @@ namespace Db
 {
 
 template < typename T >
-class TDatabaseTaskBatch : public IDatabaseTaskBatch
+class TDatabaseTaskBatch : public IDatabaseTaskBatch, public IDatabaseTaskResultObserver
 {
 	public:
 
@@ -43,7 +47,13 @@ class TDatabaseTaskBatch : public IDatabaseTaskBatch
 		TDatabaseTaskBatch( void ) :
 			BASECLASS(),
 			PendingTasks(),
+			CoalesceIndices(),
+			SupersededTasks(),
+			ResultCache( nullptr ),
+			ResultCaptures(),
+			Watchdog( nullptr ),
 			CallContext( nullptr ),
+			BatchSizeController( T::InputParameterBatchSize ),
 			TaskName( typeid( T ).name() )
 		{
 			FATAL_ASSERT( T::InputParameterBatchSize > 0 && T::ResultSetBatchSize > 0 );
@@ -53,7 +63,9 @@ class TDatabaseTaskBatch : public IDatabaseTaskBatch
 
 		virtual ~TDatabaseTaskBatch()
 		{
-			FATAL_ASSERT( PendingTasks.empty() );
+			FATAL_ASSERT( PendingTasks.Empty() );
+			FATAL_ASSERT( CoalesceIndices.empty() );
+			FATAL_ASSERT( ResultCaptures.empty() );
 
 			delete CallContext;
 			CallContext = nullptr;
@@ -64,19 +76,81 @@ class TDatabaseTaskBatch : public IDatabaseTaskBatch
 			return Loki::TypeInfo( typeid( T ) );
 		}
 
-		virtual void Add_Task( IDatabaseTask *task ) { PendingTasks.push_back( task ); }
+		virtual void Add_Task( IDatabaseTask *task ) 
+		{
+			if ( task->Get_Coalesce_Rule() == EDatabaseTaskCoalesceRule::NONE )
+			{
+				PendingTasks.Push_Back( task );
+			}
+			else
+			{
+				Coalesce_Task( task );
+			}
+		}
+
 		virtual void Add_Task( ICompoundDatabaseTask * /*task*/ ) { FATAL_ASSERT( false ); }
 
+		virtual void Enable_Result_Caching( CDatabaseResultCache *result_cache ) { ResultCache = result_cache; }
+
+		virtual bool Try_Complete_From_Result_Cache( IDatabaseTask *task, double current_time_seconds )
+		{
+			if ( ResultCache == nullptr )
+			{
+				return false;
+			}
+
+			std::string key;
+			Build_Result_Cache_Key( task, key );
+
+			const IDatabaseResultCacheEntry *entry = ResultCache->Find( Get_Task_Type_Info(), key, current_time_seconds );
+			if ( entry != nullptr )
+			{
+				entry->Replay( task );
+				return true;
+			}
+
+			// Capture what the database hands back so the next equivalent request can skip the round trip
+			ResultCaptures[ task ] = SResultCapture( key, current_time_seconds );
+			return false;
+		}
+
+		virtual void Set_Statement_Watchdog( CDatabaseStatementWatchdog *watchdog ) { Watchdog = watchdog; }
+
+		// IDatabaseTaskResultObserver interface
+		virtual void On_Fetch_Results( IDatabaseTask *task, IDatabaseVariableSet *result_set, int64_t rows_fetched )
+		{
+			auto iter = ResultCaptures.find( task );
+			if ( iter != ResultCaptures.end() )
+			{
+				iter->second.Entry->Add_Results( result_set, rows_fetched );
+			}
+		}
+
+		virtual void On_Fetch_Results_Finished( IDatabaseTask *task, IDatabaseVariableSet *input_parameters )
+		{
+			auto iter = ResultCaptures.find( task );
+			if ( iter != ResultCaptures.end() )
+			{
+				iter->second.Entry->Set_Final_Parameters( input_parameters );
+				iter->second.Finished = true;
+			}
+		}
+
+		const CDatabaseBatchSizeController &Get_Batch_Size_Controller( void ) const { return BatchSizeController; }
+
 		virtual void Execute_Tasks( IDatabaseConnection *connection, DBTaskBaseListType &successful_tasks, DBTaskBaseListType &failed_tasks )
 		{
-			if ( PendingTasks.empty() )
+			// nothing may coalesce into a task once it has been handed to the database
+			CoalesceIndices.clear();
+
+			if ( PendingTasks.Empty() )
 			{
 				return;
 			}
 
 			if ( CallContext->Get_Statement_Text().size() == 0 )
 			{
-				IDatabaseTask *first_task = *PendingTasks.begin();
+				IDatabaseTask *first_task = PendingTasks.Front();
 				FATAL_ASSERT( connection->Validate_Input_Output_Signatures( first_task, CallContext->Get_Param_Rows(), CallContext->Get_Result_Rows() ) );
 
 				std::wstring statement_text;
@@ -96,21 +170,44 @@ class TDatabaseTaskBatch : public IDatabaseTaskBatch
 
 			FATAL_ASSERT( statement->Is_Ready_For_Use() );
 
-			LOG( IP::Logging::ELogLevel::LL_LOW, "DatabaseTaskBatch " << TaskName.c_str() << " - TaskCount: " << PendingTasks.size() );
+			LOG( IP::Logging::ELogLevel::LL_LOW, "DatabaseTaskBatch " << TaskName.c_str() << " - TaskCount: " << PendingTasks.Size() << " Superseded: " << SupersededTasks.size() );
+
+			DBTaskBaseListType batch_successes;
+			DBTaskBaseListType batch_failures;
 
-			while ( !PendingTasks.empty() )
+			while ( !PendingTasks.Empty() )
 			{
-				DBTaskListType sub_list;
+				uint32_t pending_count = PendingTasks.Size();
+				uint32_t advance_amount = BatchSizeController.Get_Batch_Size( pending_count );
+
+				DBTaskRangeType sub_list = PendingTasks.Pop_Front( advance_amount );
+
+				// Tasks that waited in the queue past their deadline are failed without ever reaching the database
+				Fail_Tasks_Past_Deadline( sub_list, Get_Database_Task_Time(), EDatabaseTaskResult::DEADLINE_EXPIRED, batch_failures );
+				if ( sub_list.empty() )
+				{
+					continue;
+				}
+
+				uint32_t executed_count = static_cast< uint32_t >( sub_list.size() );
 
-				auto splice_iter = PendingTasks.begin();
-				uint32_t advance_amount = std::min<uint32_t>( static_cast< uint32_t >( PendingTasks.size() ), T::InputParameterBatchSize );
-				std::advance( splice_iter, advance_amount );
-				sub_list.splice( sub_list.end(), PendingTasks, PendingTasks.begin(), splice_iter );
+				auto start_time = std::chrono::steady_clock::now();
+				Process_Task_List( statement, sub_list, batch_successes, batch_failures );
+				std::chrono::duration< double > round_trip_time = std::chrono::steady_clock::now() - start_time;
 
-				Process_Task_List( statement, sub_list, successful_tasks, failed_tasks );
+				BatchSizeController.On_Batch_Executed( executed_count, pending_count, round_trip_time.count() );
 			}
 
-			LOG( IP::Logging::ELogLevel::LL_LOW, "DatabaseTaskBatch " << TaskName.c_str() << " - Successes: " << successful_tasks.size() << " Failures: " << failed_tasks.size() );
+			Add_Superseded_Tasks( batch_successes );
+			Add_Superseded_Tasks( batch_failures );
+			FATAL_ASSERT( SupersededTasks.empty() );
+
+			Publish_Result_Captures( batch_successes );
+
+			successful_tasks.splice( successful_tasks.end(), batch_successes );
+			failed_tasks.splice( failed_tasks.end(), batch_failures );
+
+			LOG( IP::Logging::ELogLevel::LL_LOW, "DatabaseTaskBatch " << TaskName.c_str() << " - Successes: " << successful_tasks.size() << " Failures: " << failed_tasks.size() << " BatchSize: " << BatchSizeController.Get_Effective_Batch_Size() );
 
 			FATAL_ASSERT( statement->Is_Ready_For_Use() );
 
@@ -119,60 +216,231 @@ class TDatabaseTaskBatch : public IDatabaseTaskBatch
 
 	private:
 
-		void Process_Task_List( IDatabaseStatement *statement, DBTaskListType &sub_list, DBTaskBaseListType &successful_tasks, DBTaskBaseListType &failed_tasks )
+		// Results being recorded for a task that missed the cache; only published if the task succeeds
+		struct SResultCapture
+		{
+			SResultCapture( void ) :
+				Key(),
+				CaptureTimeSeconds( 0.0 ),
+				Entry(),
+				Finished( false )
+			{}
+
+			SResultCapture( const std::string &key, double capture_time_seconds ) :
+				Key( key ),
+				CaptureTimeSeconds( capture_time_seconds ),
+				Entry( new TDatabaseResultCacheEntry< T > ),
+				Finished( false )
+			{}
+
+			std::string Key;
+			double CaptureTimeSeconds;
+			std::unique_ptr< TDatabaseResultCacheEntry< T > > Entry;
+			bool Finished;
+		};
+
+		// The cache key is the string form of every input parameter, length-prefixed so that adjacent values can't alias
+		void Build_Result_Cache_Key( IDatabaseTask *task, std::string &key ) const
+		{
+			typename T::InputParametersType params;
+			task->Initialize_Parameters( &params );
+
+			std::vector< IDatabaseVariable * > variables;
+			params.Get_Variables( variables );
+
+			for ( uint32_t i = 0; i < variables.size(); ++i )
+			{
+				std::string value;
+				params.Convert_Variable_To_String( variables[ i ], value );
+
+				key += std::to_string( value.size() );
+				key += ':';
+				key += value;
+			}
+		}
+
+		void Reset_Result_Capture( IDatabaseTask *task )
+		{
+			auto iter = ResultCaptures.find( task );
+			if ( iter != ResultCaptures.end() )
+			{
+				iter->second.Entry->Reset();
+				iter->second.Finished = false;
+			}
+		}
+
+		void Publish_Result_Captures( const DBTaskBaseListType &successful_tasks )
+		{
+			if ( ResultCaptures.empty() )
+			{
+				return;
+			}
+
+			for ( auto iter = successful_tasks.cbegin(), end = successful_tasks.cend(); iter != end; ++iter )
+			{
+				auto capture_iter = ResultCaptures.find( static_cast< IDatabaseTask * >( *iter ) );
+				if ( capture_iter != ResultCaptures.end() && capture_iter->second.Finished )
+				{
+					SResultCapture &capture = capture_iter->second;
+					std::unique_ptr< IDatabaseResultCacheEntry > entry( std::move( capture.Entry ) );
+					ResultCache->Insert( Get_Task_Type_Info(), capture.Key, std::move( entry ), capture.CaptureTimeSeconds );
+				}
+			}
+
+			ResultCaptures.clear();
+		}
+
+		void Coalesce_Task( IDatabaseTask *task )
+		{
+			uint64_t key = task->Get_Coalesce_Key();
+			auto iter = CoalesceIndices.find( key );
+			if ( iter == CoalesceIndices.end() )
+			{
+				CoalesceIndices[ key ] = PendingTasks.Size();
+				PendingTasks.Push_Back( task );
+				return;
+			}
+
+			// The newest task always survives; under MERGE it absorbs the state of the task it replaces.  It takes over the
+			// queue position of the task it replaces, so it still runs ahead of anything submitted after that task.
+			IDatabaseTask *older_task = PendingTasks[ iter->second ];
+			if ( task->Get_Coalesce_Rule() == EDatabaseTaskCoalesceRule::MERGE )
+			{
+				task->Merge_Superseded_Task( older_task );
+			}
+
+			DBTaskVectorType &superseded = SupersededTasks[ task ];
+			auto older_iter = SupersededTasks.find( older_task );
+			if ( older_iter != SupersededTasks.end() )
+			{
+				superseded.swap( older_iter->second );
+				SupersededTasks.erase( older_iter );
+			}
+
+			superseded.push_back( older_task );
+			PendingTasks[ iter->second ] = task;
+		}
+
+		// Superseded tasks were never executed; they share the outcome of the task that replaced them
+		void Add_Superseded_Tasks( DBTaskBaseListType &tasks )
+		{
+			if ( SupersededTasks.empty() )
+			{
+				return;
+			}
+
+			DBTaskBaseListType superseded_tasks;
+			for ( auto iter = tasks.cbegin(), end = tasks.cend(); iter != end; ++iter )
+			{
+				auto superseded_iter = SupersededTasks.find( static_cast< IDatabaseTask * >( *iter ) );
+				if ( superseded_iter != SupersededTasks.end() )
+				{
+					std::copy( superseded_iter->second.begin(), superseded_iter->second.end(), std::back_inserter( superseded_tasks ) );
+					SupersededTasks.erase( superseded_iter );
+				}
+			}
+
+			tasks.splice( tasks.end(), superseded_tasks );
+		}
+
+		void Process_Task_List( IDatabaseStatement *statement, DBTaskRangeType sub_list, DBTaskBaseListType &successful_tasks, DBTaskBaseListType &failed_tasks )
 		{
 			while( !sub_list.empty() )
 			{
 				EExecuteDBTaskListResult execute_result;
-				DBTaskListType::const_iterator bad_task;
-				Execute_Task_List( CallContext, statement, sub_list, execute_result, bad_task );
+				uint32_t bad_task = 0;
+
+				double deadline = Get_Earliest_Deadline( sub_list );
+				bool watched = Watchdog != nullptr && deadline > 0.0;
+				if ( watched )
+				{
+					Watchdog->Watch( statement, deadline );
+				}
+
+				Execute_Task_List( CallContext, statement, sub_list, execute_result, bad_task, ResultCaptures.empty() ? nullptr : this );
+
+				// a cancel that lands after the work is done changes nothing, so success is checked first
+				bool cancelled = watched && Watchdog->Unwatch();
 				if ( execute_result == EExecuteDBTaskListResult::SUCCESS )
 				{
 					statement->Get_Connection()->End_Transaction( true );
 					statement->Return_To_Ready();
 
 					std::for_each( sub_list.begin(), sub_list.end(), [ &successful_tasks ]( IDatabaseTask *task ){ successful_tasks.push_back( task ); } );
-					sub_list.clear();
+					sub_list = DBTaskRangeType();
 				}
 				else
 				{
 					statement->Get_Connection()->End_Transaction( false );
 					statement->Return_To_Ready();
 
-					for ( DBTaskListType::iterator iter = sub_list.begin(); iter != sub_list.end(); ++iter )
+					if ( cancelled )
+					{
+						LOG( IP::Logging::ELogLevel::LL_LOW, "DatabaseTaskBatch " << TaskName.c_str() << " - statement cancelled after exceeding a task deadline" );
+
+						// Fail the tasks whose budget ran out, then run the rest in isolation under their own deadlines
+						Fail_Tasks_Past_Deadline( sub_list, std::max( deadline, Get_Database_Task_Time() ), EDatabaseTaskResult::CANCELLED, failed_tasks );
+						for ( uint32_t i = 0; i < sub_list.size(); ++i )
+						{
+							sub_list[ i ]->On_Rollback();
+							Reset_Result_Capture( sub_list[ i ] );
+						}
+
+						for ( uint32_t i = 0; i < sub_list.size(); ++i )
+						{
+							Process_Task_List( statement, sub_list.Sub_Range( i, 1 ), successful_tasks, failed_tasks );
+						}
+
+						sub_list = DBTaskRangeType();
+						continue;
+					}
+
+					for ( uint32_t i = 0; i < sub_list.size(); ++i )
 					{
-						if ( iter != bad_task )
+						if ( i != bad_task )
 						{
-							( *iter )->On_Rollback();
+							sub_list[ i ]->On_Rollback();
+							Reset_Result_Capture( sub_list[ i ] );
 						}
 					}
 
 					if ( execute_result == EExecuteDBTaskListResult::FAILED_SPECIFIC_TASK )
 					{
-						failed_tasks.push_back( *bad_task );
-						sub_list.erase( bad_task );
+						failed_tasks.push_back( sub_list[ bad_task ] );
+						sub_list.Remove( bad_task );
 					}
 					else
 					{
-						DBTaskListType individual_list;
-						for ( DBTaskListType::iterator iter = sub_list.begin(); iter != sub_list.end(); ++iter )
+						for ( uint32_t i = 0; i < sub_list.size(); ++i )
 						{
-							individual_list.clear();
-							individual_list.push_back( *iter );
-
-							Process_Task_List( statement, individual_list, successful_tasks, failed_tasks );
+							Process_Task_List( statement, sub_list.Sub_Range( i, 1 ), successful_tasks, failed_tasks );
 						}
 
-						sub_list.clear();
+						sub_list = DBTaskRangeType();
 					}
 				}
 			}
 		}
 
-		DBTaskListType PendingTasks;
+		// coalesce key -> index of the surviving task in PendingTasks
+		using CoalesceIndexTableType = std::unordered_map< uint64_t, uint32_t >;
+		using SupersededTaskTableType = std::unordered_map< IDatabaseTask *, DBTaskVectorType >;
+		using ResultCaptureTableType = std::unordered_map< IDatabaseTask *, SResultCapture >;
+
+		DBTaskQueueType PendingTasks;
+
+		CoalesceIndexTableType CoalesceIndices;
+		SupersededTaskTableType SupersededTasks;
+
+		CDatabaseResultCache *ResultCache;
+		ResultCaptureTableType ResultCaptures;
+
+		CDatabaseStatementWatchdog *Watchdog;
 
 		IDatabaseCallContext *CallContext;
 
+		CDatabaseBatchSizeController BatchSizeController;
+
 		std::string TaskName;
 };
 
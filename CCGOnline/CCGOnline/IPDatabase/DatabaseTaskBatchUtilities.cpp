@@ -28,6 +28,7 @@
 #include "Interfaces/DatabaseVariableSetInterface.h"
 #include "IPShared/Logging/LogInterface.h"
 #include "IPShared/EnumConversion.h"
+#include "IPPlatform/PlatformTime.h"
 
 using namespace IP::Db;
 using namespace IP::Enum;
@@ -85,9 +86,9 @@ static void Log_DB_Error( IDatabaseStatement *statement, IDatabaseVariableSet *i
 static void Extract_Batch_Error( IDatabaseCallContext *call_context, 
 											IDatabaseStatement *statement, 
 											const wchar_t *additional_error_context, 
-											const DBTaskListType &sub_list, 
+											const DBTaskRangeType &sub_list, 
 											EExecuteDBTaskListResult &result, 
-											DBTaskListType::const_iterator &first_failed_task )
+											uint32_t &first_failed_task )
 {
 	FATAL_ASSERT( !sub_list.empty() );
 
@@ -95,47 +96,79 @@ static void Extract_Batch_Error( IDatabaseCallContext *call_context,
 	{
 		Log_DB_Error( statement, call_context->Get_Param_Row( 0 ), additional_error_context );
 		result = EExecuteDBTaskListResult::FAILED_SPECIFIC_TASK;
-		first_failed_task = sub_list.cbegin();
+		first_failed_task = 0;
 		return;
 	}
 
 	int32_t bad_row_number = statement->Get_Bad_Row_Number();
-	if ( bad_row_number >= 0 )
+	if ( bad_row_number >= 0 && static_cast< size_t >( bad_row_number ) < sub_list.size() )
 	{
-		int32_t row = 0;
-		auto end = sub_list.cend();
-		for( first_failed_task = sub_list.cbegin(); first_failed_task != end; ++row, ++first_failed_task )
-		{
-			if ( row == bad_row_number )
-			{
-				Log_DB_Error( statement, call_context->Get_Param_Row( row ), additional_error_context );
-				result = EExecuteDBTaskListResult::FAILED_SPECIFIC_TASK;
-				return;
-			}
-		}
+		Log_DB_Error( statement, call_context->Get_Param_Row( bad_row_number ), additional_error_context );
+		result = EExecuteDBTaskListResult::FAILED_SPECIFIC_TASK;
+		first_failed_task = static_cast< uint32_t >( bad_row_number );
+		return;
 	}
 
 	Log_DB_Error( statement, nullptr, additional_error_context );
 	result = EExecuteDBTaskListResult::FAILED_UNKNOWN_TASK;
 }
 
-void Execute_Task_List( IDatabaseCallContext *call_context, IDatabaseStatement *statement, const DBTaskListType &sub_list, EExecuteDBTaskListResult &result, DBTaskListType::const_iterator &first_failed_task )
+double Get_Database_Task_Time( void )
+{
+	return IP::Time::Convert_Duration_To_Seconds( IP::Time::Get_Elapsed_Monotonic_Time() );
+}
+
+double Get_Earliest_Deadline( const DBTaskRangeType &sub_list )
+{
+	double earliest_deadline = 0.0;
+	for ( uint32_t i = 0; i < sub_list.size(); ++i )
+	{
+		double deadline = sub_list[ i ]->Get_Deadline();
+		if ( deadline > 0.0 && ( earliest_deadline == 0.0 || deadline < earliest_deadline ) )
+		{
+			earliest_deadline = deadline;
+		}
+	}
+
+	return earliest_deadline;
+}
+
+void Fail_Tasks_Past_Deadline( DBTaskRangeType &sub_list, double cutoff_time, EDatabaseTaskResult result, DBTaskBaseListType &failed_tasks )
+{
+	uint32_t i = 0;
+	while ( i < sub_list.size() )
+	{
+		IDatabaseTask *task = sub_list[ i ];
+		double deadline = task->Get_Deadline();
+		if ( deadline > 0.0 && deadline <= cutoff_time )
+		{
+			task->Set_Result( result );
+			failed_tasks.push_back( task );
+			sub_list.Remove( i );
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+void Execute_Task_List( IDatabaseCallContext *call_context, IDatabaseStatement *statement, const DBTaskRangeType &sub_list, EExecuteDBTaskListResult &result, uint32_t &first_failed_task, IDatabaseTaskResultObserver *observer )
 {
 	FATAL_ASSERT( call_context != nullptr );
 	FATAL_ASSERT( statement != nullptr );
 
 	result = EExecuteDBTaskListResult::SUCCESS;
-	first_failed_task = sub_list.cend();
+	first_failed_task = static_cast< uint32_t >( sub_list.size() );
 
 	if ( sub_list.empty() )
 	{
 		return;
 	}
 
-	uint32_t i = 0;
-	for ( DBTaskListType::const_iterator iter = sub_list.cbegin(), end = sub_list.cend(); iter != end; ++iter, ++i )
+	for ( uint32_t i = 0; i < sub_list.size(); ++i )
 	{
-		( *iter )->Initialize_Parameters( call_context->Get_Param_Row( i ) );
+		sub_list[ i ]->Initialize_Parameters( call_context->Get_Param_Row( i ) );
 	}
 
 	FATAL_ASSERT( !statement->Is_In_Error_State() );
@@ -148,7 +181,7 @@ void Execute_Task_List( IDatabaseCallContext *call_context, IDatabaseStatement *
 		return;
 	}
 
-	DBTaskListType::const_iterator iter = sub_list.cbegin();
+	auto iter = sub_list.begin();
 
 	int64_t rows_fetched = 0;
 	uint32_t input_row = 0;
@@ -156,7 +189,7 @@ void Execute_Task_List( IDatabaseCallContext *call_context, IDatabaseStatement *
 	const wchar_t *additional_error_context = NULL;		// error logging is somewhat removed from error recognition, so use this awkward way of forwarding user-level information
 	while ( fetch_status != FRST_ERROR && fetch_status != FRST_FINISHED_ALL )
 	{
-		if ( iter == sub_list.cend() )
+		if ( iter == sub_list.end() )
 		{
 			// Uh oh, there are more result sets than batched calls, we need to fail out
 			fetch_status = FRST_ERROR;
@@ -171,12 +204,21 @@ void Execute_Task_List( IDatabaseCallContext *call_context, IDatabaseStatement *
 			if ( fetch_status != FRST_ERROR && rows_fetched > 0 )
 			{
 				( *iter )->On_Fetch_Results( call_context->Get_Result_Rows(), rows_fetched );
+				if ( observer != nullptr )
+				{
+					observer->On_Fetch_Results( *iter, call_context->Get_Result_Rows(), rows_fetched );
+				}
 			}
 		}
 
 		if ( fetch_status == FRST_FINISHED_SET )
 		{
 			( *iter )->On_Fetch_Results_Finished( call_context->Get_Param_Row( input_row ) );
+			if ( observer != nullptr )
+			{
+				observer->On_Fetch_Results_Finished( *iter, call_context->Get_Param_Row( input_row ) );
+			}
+
 			++iter;
 			++input_row;
 		}
@@ -184,9 +226,13 @@ void Execute_Task_List( IDatabaseCallContext *call_context, IDatabaseStatement *
 		{
 			if ( !statement->Should_Have_Results() || input_row + 1 == list_size )
 			{
-				for ( auto end = sub_list.cend(); iter != end; ++iter, ++input_row )
+				for ( auto end = sub_list.end(); iter != end; ++iter, ++input_row )
 				{
 					( *iter )->On_Fetch_Results_Finished( call_context->Get_Param_Row( input_row ) );
+					if ( observer != nullptr )
+					{
+						observer->On_Fetch_Results_Finished( *iter, call_context->Get_Param_Row( input_row ) );
+					}
 				}
 			}
 			else
@@ -20,6 +20,8 @@
 #pragma once
 
 #include "DatabaseTypes.h"
+#include "DatabaseTaskQueue.h"
+#include "Interfaces/DatabaseTaskBaseInterface.h"
 
 namespace IP
 {
@@ -28,6 +30,8 @@ namespace Db
 
 class IDatabaseCallContext;
 class IDatabaseStatement;
+class IDatabaseTask;
+class IDatabaseVariableSet;
 
 enum class EExecuteDBTaskListResult
 {
@@ -36,7 +40,28 @@ enum class EExecuteDBTaskListResult
 	FAILED_UNKNOWN_TASK
 };
 
-void Execute_Task_List( IDatabaseCallContext *call_context, IDatabaseStatement *statement, const DBTaskListType &sub_list, EExecuteDBTaskListResult &result, DBTaskListType::const_iterator &first_failed_task );
+// Sees every result chunk and completion delivered to a task while a task list executes
+class IDatabaseTaskResultObserver
+{
+	public:
+
+		IDatabaseTaskResultObserver( void ) {}
+		virtual ~IDatabaseTaskResultObserver() {}
+
+		virtual void On_Fetch_Results( IDatabaseTask *task, IDatabaseVariableSet *result_set, int64_t rows_fetched ) = 0;
+		virtual void On_Fetch_Results_Finished( IDatabaseTask *task, IDatabaseVariableSet *input_parameters ) = 0;
+};
+
+// Time base for task deadlines: elapsed monotonic time in seconds, the same clock CThreadProcessBase uses for process time
+double Get_Database_Task_Time( void );
+
+// Returns zero if no task in the list has a deadline
+double Get_Earliest_Deadline( const DBTaskRangeType &sub_list );
+
+// Pulls every task whose deadline falls at or before cutoff_time out of the list and fails it with the supplied result
+void Fail_Tasks_Past_Deadline( DBTaskRangeType &sub_list, double cutoff_time, EDatabaseTaskResult result, DBTaskBaseListType &failed_tasks );
+
+void Execute_Task_List( IDatabaseCallContext *call_context, IDatabaseStatement *statement, const DBTaskRangeType &sub_list, EExecuteDBTaskListResult &result, uint32_t &first_failed_task, IDatabaseTaskResultObserver *observer = nullptr );
 
 } // namespace Db
 } // namespace IP
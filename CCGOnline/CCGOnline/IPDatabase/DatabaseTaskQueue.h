@@ -0,0 +1,211 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include "IPDatabase/DatabaseTypes.h"
+
+namespace IP
+{
+namespace Db
+{
+
+// A non-owning view of a contiguous run of queued tasks
+template< typename T >
+class TDatabaseTaskRange
+{
+	public:
+
+		TDatabaseTaskRange( void ) :
+			First( nullptr ),
+			Last( nullptr )
+		{}
+
+		TDatabaseTaskRange( T *first, T *last ) :
+			First( first ),
+			Last( last )
+		{}
+
+		T *begin( void ) const { return First; }
+		T *end( void ) const { return Last; }
+
+		T &operator []( size_t index ) const { return First[ index ]; }
+
+		size_t size( void ) const { return static_cast< size_t >( Last - First ); }
+		bool empty( void ) const { return First == Last; }
+
+		TDatabaseTaskRange< T > Sub_Range( size_t offset, size_t count ) const { return TDatabaseTaskRange< T >( First + offset, First + offset + count ); }
+
+		void Remove( size_t index )
+		{
+			std::move( First + index + 1, Last, First + index );
+			--Last;
+		}
+
+	private:
+
+		T *First;
+		T *Last;
+};
+
+// A growable ring buffer of pending tasks.  Items are stored contiguously so that a sub-batch can be handed out as a
+// pointer range rather than spliced node by node.  A popped range remains valid until the next Push_Back or Pop_Front:
+// a push may reuse or reallocate the slots behind it, and a pop that straddles the end of the buffer rotates them.
+template< typename T >
+class TDatabaseTaskQueue
+{
+	public:
+
+		TDatabaseTaskQueue( void ) :
+			Buffer(),
+			Capacity( 0 ),
+			Head( 0 ),
+			Count( 0 )
+		{}
+
+		~TDatabaseTaskQueue() = default;
+
+		TDatabaseTaskQueue( TDatabaseTaskQueue< T > &&rhs ) :
+			Buffer( std::move( rhs.Buffer ) ),
+			Capacity( rhs.Capacity ),
+			Head( rhs.Head ),
+			Count( rhs.Count )
+		{
+			rhs.Capacity = 0;
+			rhs.Head = 0;
+			rhs.Count = 0;
+		}
+
+		TDatabaseTaskQueue< T > & operator =( TDatabaseTaskQueue< T > &&rhs )
+		{
+			if ( this != &rhs )
+			{
+				Buffer = std::move( rhs.Buffer );
+				Capacity = rhs.Capacity;
+				Head = rhs.Head;
+				Count = rhs.Count;
+
+				rhs.Capacity = 0;
+				rhs.Head = 0;
+				rhs.Count = 0;
+			}
+
+			return *this;
+		}
+
+		TDatabaseTaskQueue( const TDatabaseTaskQueue< T > &rhs ) = delete;
+		TDatabaseTaskQueue< T > & operator =( const TDatabaseTaskQueue< T > &rhs ) = delete;
+
+		void Push_Back( T &&task )
+		{
+			if ( Count == Capacity )
+			{
+				Grow();
+			}
+
+			Buffer[ ( Head + Count ) & ( Capacity - 1 ) ] = std::move( task );
+			++Count;
+		}
+
+		void Push_Back( const T &task )
+		{
+			T copy( task );
+			Push_Back( std::move( copy ) );
+		}
+
+		TDatabaseTaskRange< T > Pop_Front( uint32_t max_count )
+		{
+			uint32_t count = std::min( max_count, Count );
+			if ( count == 0 )
+			{
+				return TDatabaseTaskRange< T >();
+			}
+
+			if ( Head + count > Capacity )
+			{
+				Linearize();
+			}
+
+			T *first = Buffer.get() + Head;
+			Count -= count;
+			Head = ( Count == 0 ) ? 0 : ( Head + count ) & ( Capacity - 1 );
+
+			return TDatabaseTaskRange< T >( first, first + count );
+		}
+
+		const T &Front( void ) const
+		{
+			FATAL_ASSERT( Count > 0 );
+
+			return Buffer[ Head ];
+		}
+
+		// Indexed from the front; an index stays attached to the same task until something is popped
+		T &operator []( uint32_t index )
+		{
+			FATAL_ASSERT( index < Count );
+
+			return Buffer[ ( Head + index ) & ( Capacity - 1 ) ];
+		}
+
+		uint32_t Size( void ) const { return Count; }
+		bool Empty( void ) const { return Count == 0; }
+
+	private:
+
+		static const uint32_t INITIAL_CAPACITY = 16;
+
+		void Grow( void )
+		{
+			uint32_t new_capacity = ( Capacity == 0 ) ? INITIAL_CAPACITY : Capacity * 2;
+			std::unique_ptr< T[] > new_buffer( new T[ new_capacity ] );
+
+			for ( uint32_t i = 0; i < Count; ++i )
+			{
+				new_buffer[ i ] = std::move( Buffer[ ( Head + i ) & ( Capacity - 1 ) ] );
+			}
+
+			Buffer = std::move( new_buffer );
+			Capacity = new_capacity;
+			Head = 0;
+		}
+
+		// Rotates the wrapped contents back to the start of the buffer; only needed when a pop straddles the end
+		void Linearize( void )
+		{
+			std::rotate( Buffer.get(), Buffer.get() + Head, Buffer.get() + Capacity );
+			Head = 0;
+		}
+
+		std::unique_ptr< T[] > Buffer;
+
+		uint32_t Capacity;
+		uint32_t Head;
+		uint32_t Count;
+};
+
+} // namespace Db
+} // namespace IP
+
+using DBTaskRangeType = IP::Db::TDatabaseTaskRange< IP::Db::IDatabaseTask * >;
+using DBCompoundTaskRangeType = IP::Db::TDatabaseTaskRange< IP::Db::ICompoundDatabaseTask * >;
+
+using DBTaskQueueType = IP::Db::TDatabaseTaskQueue< IP::Db::IDatabaseTask * >;
+using DBCompoundTaskQueueType = IP::Db::TDatabaseTaskQueue< IP::Db::ICompoundDatabaseTask * >;
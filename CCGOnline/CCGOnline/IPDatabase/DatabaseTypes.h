@@ -100,7 +100,7 @@ class ICompoundDatabaseTask;
 
 using DBTaskBaseListType = std::list< IP::Db::IDatabaseTaskBase * >;
 using DBTaskListType = std::list< IP::Db::IDatabaseTask * >;
-using DBCompoundTaskListType = std::list< IP::Db::ICompoundDatabaseTask * >;
+using DBTaskVectorType = std::vector< IP::Db::IDatabaseTask * >;
 
 using DBTaskListTableType = std::unordered_map< Loki::TypeInfo, DBTaskListType *, IP::STypeInfoContainerHelper >;
 using DBTaskListTablePairType = std::pair< Loki::TypeInfo, DBTaskListType * >;
@@ -19,9 +19,7 @@
 
 #pragma once
 
-enum DBErrorStateType;
-enum DBConnectionIDType;
-enum EDatabaseTaskType;
+#include "IPDatabase/DatabaseTypes.h"
 
 namespace IP
 {
@@ -19,8 +19,7 @@
 
 #pragma once
 
-enum DBConnectionIDType;
-enum DBErrorStateType;
+#include "IPDatabase/DatabaseTypes.h"
 
 namespace IP
 {
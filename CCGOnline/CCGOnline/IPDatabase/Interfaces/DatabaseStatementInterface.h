@@ -19,9 +19,7 @@
 
 #pragma once
 
-enum DBErrorStateType;
-enum EFetchResultsStatusType;
-enum DBStatementIDType;
+#include "IPDatabase/DatabaseTypes.h"
 
 namespace IP
 {
@@ -49,6 +47,9 @@ class IDatabaseStatement
 		virtual EFetchResultsStatusType Fetch_Results( int64_t &rows_fetched ) = 0;
 		virtual void Return_To_Ready( void ) = 0;
 
+		// May be called from a thread other than the one executing the statement
+		virtual void Cancel( void ) = 0;
+
 		virtual bool Needs_Binding( void ) const = 0;
 		virtual bool Is_Ready_For_Use( void ) const = 0;
 		virtual bool Is_In_Error_State( void ) const = 0;
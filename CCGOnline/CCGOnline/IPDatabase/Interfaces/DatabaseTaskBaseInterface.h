@@ -31,6 +31,16 @@ enum class EDatabaseTaskIDType
 	INVALID
 };
 
+// Outcome of a task, as reported back to the requesting process
+enum class EDatabaseTaskResult
+{
+	PENDING,
+	SUCCESS,
+	FAILED,
+	DEADLINE_EXPIRED,
+	CANCELLED
+};
+
 class IDatabaseTaskBase
 {
 	public:
@@ -41,6 +51,9 @@ class IDatabaseTaskBase
 		virtual EDatabaseTaskIDType Get_ID( void ) const = 0;
 		virtual void Set_ID( EDatabaseTaskIDType id ) = 0;	
 
+		virtual EDatabaseTaskResult Get_Result( void ) const = 0;
+		virtual void Set_Result( EDatabaseTaskResult result ) = 0;
+
 		virtual void On_Task_Success( void ) = 0;					
 		virtual void On_Task_Failure( void ) = 0;	
 
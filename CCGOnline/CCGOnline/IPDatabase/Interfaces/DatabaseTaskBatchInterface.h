@@ -29,6 +29,8 @@ namespace Db
 class ICompoundDatabaseTask;
 class IDatabaseTask;
 class IDatabaseConnection;
+class CDatabaseResultCache;
+class CDatabaseStatementWatchdog;
 
 class IDatabaseTaskBatch
 {
@@ -41,6 +43,12 @@ class IDatabaseTaskBatch
 		virtual void Add_Task( IDatabaseTask *task ) = 0;
 		virtual void Add_Task( ICompoundDatabaseTask *task ) = 0;
 		virtual void Execute_Tasks( IDatabaseConnection *connection, DBTaskBaseListType &successful_tasks, DBTaskBaseListType &failed_tasks ) = 0;
+
+		// Read-through result caching; a task that is completed from the cache must not also be added
+		virtual void Enable_Result_Caching( CDatabaseResultCache *result_cache ) = 0;
+		virtual bool Try_Complete_From_Result_Cache( IDatabaseTask *task, double current_time_seconds ) = 0;
+
+		virtual void Set_Statement_Watchdog( CDatabaseStatementWatchdog *watchdog ) = 0;
 };
 
 } // namespace Db
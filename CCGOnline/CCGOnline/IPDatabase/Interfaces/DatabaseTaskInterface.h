@@ -24,8 +24,6 @@
 #include "IPDatabase/DatabaseTypes.h"
 #include "IPDatabase/DatabaseTaskBatchUtilities.h"
 
-enum EDatabaseTaskType;
-
 namespace IP
 {
 namespace Db
@@ -37,6 +35,14 @@ class IDatabaseStatement;
 
 enum class ExecuteDBTaskListResult;
 
+// How pending tasks of the same type that share a coalesce key are combined before being flushed
+enum class EDatabaseTaskCoalesceRule
+{
+	NONE,
+	LAST_WRITER_WINS,
+	MERGE
+};
+
 class IDatabaseTask : public IDatabaseTaskBase
 {
 	public:
@@ -53,10 +59,18 @@ class IDatabaseTask : public IDatabaseTaskBase
 		virtual void Build_Column_Name_List( std::vector< const wchar_t * > &column_names ) const = 0;
 		virtual EDatabaseTaskType Get_Task_Type( void ) const = 0;	
 
+		virtual EDatabaseTaskCoalesceRule Get_Coalesce_Rule( void ) const = 0;
+		virtual uint64_t Get_Coalesce_Key( void ) const = 0;
+
+		// Absolute time, in Get_Database_Task_Time() seconds, after which the task should no longer run; zero means no deadline
+		virtual double Get_Deadline( void ) const = 0;
+		virtual void Set_Deadline( double deadline ) = 0;
+
 	protected:
 
 		template < typename T > friend class TDatabaseTaskBatch;
-		friend void Execute_Task_List( IDatabaseCallContext *, IDatabaseStatement *, const DBTaskListType &, EExecuteDBTaskListResult &, DBTaskListType::const_iterator & );
+		template < typename T > friend class TDatabaseResultCacheEntry;
+		friend void Execute_Task_List( IDatabaseCallContext *, IDatabaseStatement *, const DBTaskRangeType &, EExecuteDBTaskListResult &, uint32_t &, IDatabaseTaskResultObserver * );
 
 		virtual void Initialize_Parameters( IDatabaseVariableSet *input_parameters ) = 0;		
 		virtual void On_Fetch_Results( IDatabaseVariableSet *result_set, int64_t rows_fetched ) = 0;			
@@ -64,6 +78,9 @@ class IDatabaseTask : public IDatabaseTaskBase
 
 		virtual void On_Rollback( void ) = 0;			
 
+		// Only called under EDatabaseTaskCoalesceRule::MERGE; folds an older pending task with the same key into this one
+		virtual void Merge_Superseded_Task( IDatabaseTask *older_task ) = 0;
+
 };
 
 } // namespace Db
@@ -19,8 +19,7 @@
 
 #pragma once
 
-enum EDatabaseVariableType;
-enum EDatabaseVariableValueType;
+#include "IPDatabase/DatabaseTypes.h"
 
 namespace IP
 {
@@ -22,7 +22,7 @@
 #include "IPDatabase/Interfaces/DatabaseConnectionInterface.h"
 #include "ODBCObjectBase.h"
 
-enum DBStatementIDType;
+#include "IPDatabase/DatabaseTypes.h"
 
 namespace IP
 {
@@ -22,7 +22,7 @@
 #include "IPPlatform/WindowsWrapper.h"
 #include <sql.h>
 
-enum DBErrorStateType;
+#include "IPDatabase/DatabaseTypes.h"
 
 namespace IP
 {
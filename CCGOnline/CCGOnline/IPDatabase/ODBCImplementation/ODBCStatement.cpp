@@ -464,6 +464,18 @@ EFetchResultsStatusType CODBCStatement::Fetch_Results( int64_t &rows_fetched )
 	return FRST_ONGOING;
 }
 
+void CODBCStatement::Cancel( void )
+{
+	if ( State == ODBCStatementStateType::UNINITIALIZED || State == ODBCStatementStateType::SHUTDOWN )
+	{
+		return;
+	}
+
+	// Under ODBC 3.x this has no effect when nothing is in progress on the statement, so a late cancel is harmless.
+	// The interrupted Execute/Fetch_Results call reports the failure (HY008) on the executing thread.
+	SQLCancel( StatementHandle );
+}
+
 bool CODBCStatement::Needs_Binding( void ) const
 {
 	return State == ODBCStatementStateType::INITIALIZED;
@@ -50,6 +50,7 @@ class CODBCStatement : public CODBCObjectBase, public IDatabaseStatement
 		virtual void Execute( uint32_t batch_size );
 		virtual EFetchResultsStatusType Fetch_Results( int64_t &rows_fetched );
 		virtual void Return_To_Ready( void );
+		virtual void Cancel( void );
 
 		virtual bool Needs_Binding( void ) const;
 		virtual bool Is_Ready_For_Use( void ) const;
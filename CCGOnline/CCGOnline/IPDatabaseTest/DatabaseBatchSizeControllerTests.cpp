@@ -0,0 +1,118 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPDatabase/DatabaseBatchSizeController.h"
+
+using namespace IP::Db;
+
+static const double FAST_ROUND_TRIP = .001;
+static const double SLOW_ROUND_TRIP = 1.0;
+
+TEST( DatabaseBatchSizeControllerTests, Starts_Small )
+{
+	CDatabaseBatchSizeController controller( 16 );
+
+	ASSERT_TRUE( controller.Get_Max_Batch_Size() == 16 );
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() == 1 );
+	ASSERT_TRUE( controller.Get_Batch_Size( 0 ) == 0 );
+	ASSERT_TRUE( controller.Get_Batch_Size( 100 ) == 1 );
+}
+
+TEST( DatabaseBatchSizeControllerTests, Backlog_Grows_To_Capacity )
+{
+	CDatabaseBatchSizeController controller( 16 );
+
+	uint32_t pending = 1000;
+	while ( controller.Get_Effective_Batch_Size() < 16 )
+	{
+		uint32_t batch_size = controller.Get_Batch_Size( pending );
+
+		// constant per-call cost, so larger batches always yield more throughput
+		controller.On_Batch_Executed( batch_size, pending, FAST_ROUND_TRIP );
+		pending -= batch_size;
+
+		ASSERT_TRUE( pending > 0 );
+	}
+
+	ASSERT_TRUE( controller.Get_Batch_Size( pending ) == 16 );
+
+	controller.On_Batch_Executed( 16, pending, FAST_ROUND_TRIP );
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() == 16 );
+}
+
+TEST( DatabaseBatchSizeControllerTests, Backlog_Backs_Off_When_Throughput_Drops )
+{
+	CDatabaseBatchSizeController controller( 64, 100.0 );
+
+	controller.On_Batch_Executed( 1, 1000, FAST_ROUND_TRIP );
+	controller.On_Batch_Executed( 2, 1000, FAST_ROUND_TRIP * 2 );
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() == 4 );
+
+	controller.On_Batch_Executed( 4, 1000, FAST_ROUND_TRIP * 4 );
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() == 8 );
+
+	// eight tasks now cost far more than eight times a single task
+	controller.On_Batch_Executed( 8, 1000, FAST_ROUND_TRIP * 80 );
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() < 8 );
+}
+
+TEST( DatabaseBatchSizeControllerTests, Light_Load_Shrinks_On_Slow_Round_Trips )
+{
+	CDatabaseBatchSizeController controller( 32 );
+
+	uint32_t pending = 10000;
+	for ( uint32_t i = 0; i < 10; ++i )
+	{
+		uint32_t batch_size = controller.Get_Batch_Size( pending );
+		controller.On_Batch_Executed( batch_size, pending, FAST_ROUND_TRIP );
+		pending -= batch_size;
+	}
+
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() == 32 );
+
+	controller.On_Batch_Executed( 2, 2, SLOW_ROUND_TRIP );
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() == 16 );
+	ASSERT_TRUE( controller.Get_Average_Round_Trip_Seconds() > controller.Get_Target_Round_Trip_Seconds() );
+}
+
+TEST( DatabaseBatchSizeControllerTests, Light_Load_Drifts_Toward_Demand )
+{
+	CDatabaseBatchSizeController controller( 32 );
+
+	uint32_t pending = 10000;
+	for ( uint32_t i = 0; i < 10; ++i )
+	{
+		uint32_t batch_size = controller.Get_Batch_Size( pending );
+		controller.On_Batch_Executed( batch_size, pending, FAST_ROUND_TRIP );
+		pending -= batch_size;
+	}
+
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() == 32 );
+
+	for ( uint32_t i = 0; i < 50; ++i )
+	{
+		controller.On_Batch_Executed( 2, 2, FAST_ROUND_TRIP );
+	}
+
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() < 8 );
+	ASSERT_TRUE( controller.Get_Effective_Batch_Size() >= 2 );
+}
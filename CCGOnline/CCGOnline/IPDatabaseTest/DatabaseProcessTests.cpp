@@ -0,0 +1,199 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+#include "stdafx.h"
+
+#include "IPDatabase/DatabaseProcessBase.h"
+#include "IPDatabase/DatabaseProcessMessages.h"
+#include "IPDatabase/DatabaseCalls.h"
+#include "IPDatabase/CompoundDatabaseTaskBatch.h"
+#include "IPDatabase/EmptyVariableSet.h"
+#include "IPDatabase/Interfaces/DatabaseConnectionInterface.h"
+#include "IPDatabase/Interfaces/DatabaseEnvironmentInterface.h"
+#include "IPDatabase/Interfaces/DatabaseStatementInterface.h"
+#include "IPDatabase/Interfaces/DatabaseTaskBatchInterface.h"
+#include "IPShared/Concurrency/ProcessMailbox.h"
+#include "IPShared/Concurrency/MailboxInterfaces.h"
+#include "IPShared/Concurrency/ProcessMessageFrame.h"
+#include "IPShared/Concurrency/ProcessExecutionContext.h"
+#include "IPShared/Concurrency/ProcessID.h"
+#include "IPShared/Concurrency/ProcessSubject.h"
+
+using namespace IP::Db;
+using namespace IP::Execution;
+using namespace IP::Execution::Messaging;
+
+// Connection stand-in; nothing in these tests reaches the database
+class CNullDatabaseConnection : public IDatabaseConnection
+{
+	public:
+
+		CNullDatabaseConnection( void ) {}
+		virtual ~CNullDatabaseConnection() {}
+
+		virtual void Initialize( const std::wstring & /*connection_string*/ ) {}
+		virtual void Shutdown( void ) {}
+
+		virtual DBConnectionIDType Get_ID( void ) const { return DBCIDT_INVALID; }
+
+		virtual IDatabaseStatement *Allocate_Statement( const std::wstring & /*statement_text*/ ) { return nullptr; }
+		virtual void Release_Statement( IDatabaseStatement * /*statement*/ ) {}
+		virtual void End_Transaction( bool /*commit*/ ) {}
+
+		virtual DBErrorStateType Get_Error_State( void ) const { return DBEST_SUCCESS; }
+
+		virtual void Construct_Statement_Text( IDatabaseTask * /*task*/, IDatabaseVariableSet * /*input_parameters*/, std::wstring & /*statement_text*/ ) const {}
+		virtual bool Validate_Input_Output_Signatures( IDatabaseTask * /*task*/, IDatabaseVariableSet * /*input_parameters*/, IDatabaseVariableSet * /*output_parameters*/ ) const { return true; }
+};
+
+class CNullDatabaseEnvironment : public IDatabaseEnvironment
+{
+	public:
+
+		CNullDatabaseEnvironment( void ) {}
+		virtual ~CNullDatabaseEnvironment() {}
+
+		virtual void Initialize( void ) {}
+		virtual void Shutdown( void ) {}
+
+		virtual void Shutdown_Connection( DBConnectionIDType /*connection_id*/ ) {}
+		virtual void Shutdown_Connection( IDatabaseConnection * /*connection*/ ) {}
+
+		virtual IDatabaseConnection *Add_Connection( const std::wstring & /*connection_string*/, bool /*cache_statements*/ ) { return new CNullDatabaseConnection; }
+
+		virtual DBErrorStateType Get_Error_State( void ) const { return DBEST_SUCCESS; }
+};
+
+class CCachedReadProcedureCall : public TDatabaseProcedureCall< CEmptyVariableSet, 1, CEmptyVariableSet, 1 >
+{
+	public:
+
+		using BASECLASS = TDatabaseProcedureCall< CEmptyVariableSet, 1, CEmptyVariableSet, 1 >;
+
+		CCachedReadProcedureCall( void ) :
+			BASECLASS()
+		{}
+
+		virtual ~CCachedReadProcedureCall() {}
+
+		virtual const wchar_t *Get_Database_Object_Name( void ) const { return L"dynamic.cached_read"; }
+
+		static uint32_t SuccessCount;
+		static uint32_t FailureCount;
+
+	protected:
+
+		virtual void Initialize_Parameters( IDatabaseVariableSet * /*input_parameters*/ ) {}
+		virtual void On_Fetch_Results( IDatabaseVariableSet * /*result_set*/, int64_t /*rows_fetched*/ ) {}
+		virtual void On_Fetch_Results_Finished( IDatabaseVariableSet * /*input_parameters*/ ) {}
+
+		virtual void On_Rollback( void ) {}
+		virtual void On_Task_Success( void ) { ++SuccessCount; }
+		virtual void On_Task_Failure( void ) { ++FailureCount; }
+};
+
+uint32_t CCachedReadProcedureCall::SuccessCount = 0;
+uint32_t CCachedReadProcedureCall::FailureCount = 0;
+
+// A batch whose every task is answered from the result cache, the way an enabled TDatabaseTaskBatch answers a hit
+class CAlwaysCachedTaskBatch : public IDatabaseTaskBatch
+{
+	public:
+
+		CAlwaysCachedTaskBatch( void ) {}
+		virtual ~CAlwaysCachedTaskBatch() {}
+
+		virtual Loki::TypeInfo Get_Task_Type_Info( void ) const { return Loki::TypeInfo( typeid( CCachedReadProcedureCall ) ); }
+
+		virtual void Add_Task( IDatabaseTask * /*task*/ ) { FATAL_ASSERT( false ); }
+		virtual void Add_Task( ICompoundDatabaseTask * /*task*/ ) { FATAL_ASSERT( false ); }
+
+		virtual void Execute_Tasks( IDatabaseConnection * /*connection*/, DBTaskBaseListType & /*successful_tasks*/, DBTaskBaseListType & /*failed_tasks*/ ) {}
+
+		virtual void Enable_Result_Caching( CDatabaseResultCache * /*result_cache*/ ) {}
+		virtual bool Try_Complete_From_Result_Cache( IDatabaseTask * /*task*/, double /*current_time_seconds*/ ) { return true; }
+
+		virtual void Set_Statement_Watchdog( CDatabaseStatementWatchdog * /*watchdog*/ ) {}
+};
+
+class CChildlessCompoundTask : public TCompoundDatabaseTask< 4 >
+{
+	public:
+
+		using BASECLASS = TCompoundDatabaseTask< 4 >;
+
+		CChildlessCompoundTask( void ) :
+			BASECLASS()
+		{}
+
+		virtual ~CChildlessCompoundTask() {}
+
+		static void Register_Child_Tasks( ICompoundDatabaseTaskBatch * /*task_batch*/ ) {}
+
+		virtual void On_Task_Success( void ) {}
+		virtual void On_Task_Failure( void ) {}
+};
+
+class CTestDatabaseProcess : public CDatabaseProcessBase
+{
+	public:
+
+		using BASECLASS = CDatabaseProcessBase;
+
+		CTestDatabaseProcess( IDatabaseEnvironment *environment ) :
+			BASECLASS( environment, L"", true, SProcessProperties( EProcessSubject::NEXT_FREE_VALUE ) )
+		{
+			// the compound batch runs after the cached batch, with nothing queued
+			Add_Batch( new CAlwaysCachedTaskBatch );
+			Add_Batch( new TCompoundDatabaseTaskBatch< CChildlessCompoundTask > );
+		}
+
+		virtual ~CTestDatabaseProcess() {}
+
+		virtual bool Is_Root_Thread( void ) const { return false; }
+};
+
+static const EProcessID DB_TEST_PROCESS_ID = static_cast< EProcessID >( static_cast< uint64_t >( EProcessID::FIRST_FREE_ID ) + 1 );
+static const EProcessID DB_TEST_CLIENT_ID = static_cast< EProcessID >( static_cast< uint64_t >( EProcessID::FIRST_FREE_ID ) + 2 );
+
+TEST( DatabaseProcessTests, Cache_Hits_Survive_Compound_Batches )
+{
+	CNullDatabaseEnvironment environment;
+	CTestDatabaseProcess process( &environment );
+	process.Initialize( DB_TEST_PROCESS_ID );
+
+	std::shared_ptr< CProcessMailbox > self_mailbox( new CProcessMailbox( DB_TEST_PROCESS_ID, process.Get_Properties() ) );
+	process.Set_My_Mailbox( self_mailbox->Get_Readable_Mailbox() );
+
+	CCachedReadProcedureCall::SuccessCount = 0;
+	CCachedReadProcedureCall::FailureCount = 0;
+
+	std::unique_ptr< CProcessMessageFrame > frame( new CProcessMessageFrame( DB_TEST_CLIENT_ID ) );
+	frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CRunDatabaseTaskRequest( new CCachedReadProcedureCall ) ) );
+	frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CRunDatabaseTaskRequest( new CCachedReadProcedureCall ) ) );
+	self_mailbox->Get_Writable_Mailbox()->Add_Frame( frame );
+
+	// a single synchronous frame, rather than the process's own thread
+	process.CProcessBase::Run( CProcessExecutionContext() );
+
+	ASSERT_TRUE( CCachedReadProcedureCall::SuccessCount == 2 );
+	ASSERT_TRUE( CCachedReadProcedureCall::FailureCount == 0 );
+
+	process.Cleanup();
+}
@@ -0,0 +1,158 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPDatabase/DatabaseResultCache.h"
+
+using namespace IP::Db;
+
+class CTestCacheEntry : public IDatabaseResultCacheEntry
+{
+	public:
+
+		CTestCacheEntry( uint32_t value ) :
+			Value( value )
+		{}
+
+		virtual ~CTestCacheEntry() {}
+
+		virtual void Replay( IDatabaseTask * /*task*/ ) const {}
+
+		uint32_t Get_Value( void ) const { return Value; }
+
+	private:
+
+		uint32_t Value;
+};
+
+class CCachedReadA {};
+class CCachedReadB {};
+
+static const Loki::TypeInfo READ_A_TYPE( typeid( CCachedReadA ) );
+static const Loki::TypeInfo READ_B_TYPE( typeid( CCachedReadB ) );
+
+static void Insert_Test_Entry( CDatabaseResultCache &cache, const Loki::TypeInfo &task_type, const std::string &key, uint32_t value, double time )
+{
+	std::unique_ptr< IDatabaseResultCacheEntry > entry( new CTestCacheEntry( value ) );
+	cache.Insert( task_type, key, std::move( entry ), time );
+}
+
+static uint32_t Get_Test_Entry_Value( CDatabaseResultCache &cache, const Loki::TypeInfo &task_type, const std::string &key, double time )
+{
+	const IDatabaseResultCacheEntry *entry = cache.Find( task_type, key, time );
+	if ( entry == nullptr )
+	{
+		return 0;
+	}
+
+	return static_cast< const CTestCacheEntry * >( entry )->Get_Value();
+}
+
+TEST( DatabaseResultCacheTests, Hit_And_Miss_Counters )
+{
+	CDatabaseResultCache cache( 16, 10.0 );
+
+	ASSERT_TRUE( cache.Find( READ_A_TYPE, "1:5", 0.0 ) == nullptr );
+	ASSERT_TRUE( cache.Get_Miss_Count() == 1 );
+
+	Insert_Test_Entry( cache, READ_A_TYPE, "1:5", 5, 0.0 );
+	ASSERT_TRUE( cache.Get_Entry_Count() == 1 );
+
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "1:5", 1.0 ) == 5 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "1:6", 1.0 ) == 0 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_B_TYPE, "1:5", 1.0 ) == 0 );
+
+	ASSERT_TRUE( cache.Get_Hit_Count() == 1 );
+	ASSERT_TRUE( cache.Get_Miss_Count() == 3 );
+}
+
+TEST( DatabaseResultCacheTests, Entries_Expire )
+{
+	CDatabaseResultCache cache( 16, 10.0 );
+
+	Insert_Test_Entry( cache, READ_A_TYPE, "1:5", 5, 2.0 );
+
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "1:5", 11.5 ) == 5 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "1:5", 12.5 ) == 0 );
+	ASSERT_TRUE( cache.Get_Entry_Count() == 0 );
+
+	Insert_Test_Entry( cache, READ_A_TYPE, "1:5", 6, 20.0 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "1:5", 21.0 ) == 6 );
+}
+
+TEST( DatabaseResultCacheTests, Least_Recently_Used_Evicted )
+{
+	CDatabaseResultCache cache( 3, 100.0 );
+
+	Insert_Test_Entry( cache, READ_A_TYPE, "1", 1, 0.0 );
+	Insert_Test_Entry( cache, READ_A_TYPE, "2", 2, 0.0 );
+	Insert_Test_Entry( cache, READ_B_TYPE, "3", 3, 0.0 );
+
+	// touch the oldest so the second entry becomes the eviction candidate
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "1", 1.0 ) == 1 );
+
+	Insert_Test_Entry( cache, READ_B_TYPE, "4", 4, 1.0 );
+	ASSERT_TRUE( cache.Get_Entry_Count() == 3 );
+
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "2", 1.0 ) == 0 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "1", 1.0 ) == 1 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_B_TYPE, "3", 1.0 ) == 3 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_B_TYPE, "4", 1.0 ) == 4 );
+
+	cache.Set_Limits( 1, 100.0 );
+	ASSERT_TRUE( cache.Get_Entry_Count() == 1 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_B_TYPE, "4", 1.0 ) == 4 );
+}
+
+TEST( DatabaseResultCacheTests, Reinsert_Replaces_Entry )
+{
+	CDatabaseResultCache cache( 16, 100.0 );
+
+	Insert_Test_Entry( cache, READ_A_TYPE, "1", 1, 0.0 );
+	Insert_Test_Entry( cache, READ_A_TYPE, "1", 2, 0.0 );
+
+	ASSERT_TRUE( cache.Get_Entry_Count() == 1 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "1", 1.0 ) == 2 );
+}
+
+TEST( DatabaseResultCacheTests, Invalidation )
+{
+	CDatabaseResultCache cache( 16, 100.0 );
+
+	Insert_Test_Entry( cache, READ_A_TYPE, "1", 1, 0.0 );
+	Insert_Test_Entry( cache, READ_A_TYPE, "2", 2, 0.0 );
+	Insert_Test_Entry( cache, READ_B_TYPE, "1", 3, 0.0 );
+	Insert_Test_Entry( cache, READ_B_TYPE, "2", 4, 0.0 );
+
+	cache.Invalidate( READ_B_TYPE, "1" );
+	ASSERT_TRUE( cache.Get_Entry_Count() == 3 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_B_TYPE, "1", 1.0 ) == 0 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_B_TYPE, "2", 1.0 ) == 4 );
+
+	cache.Invalidate( READ_A_TYPE );
+	ASSERT_TRUE( cache.Get_Entry_Count() == 1 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "1", 1.0 ) == 0 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_A_TYPE, "2", 1.0 ) == 0 );
+
+	cache.Clear();
+	ASSERT_TRUE( cache.Get_Entry_Count() == 0 );
+	ASSERT_TRUE( Get_Test_Entry_Value( cache, READ_B_TYPE, "2", 1.0 ) == 0 );
+}
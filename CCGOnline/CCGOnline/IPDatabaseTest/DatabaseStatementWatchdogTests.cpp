@@ -0,0 +1,128 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPDatabase/DatabaseStatementWatchdog.h"
+#include "IPDatabase/DatabaseTaskBatchUtilities.h"
+#include "IPDatabase/DatabaseTypes.h"
+#include "IPDatabase/Interfaces/DatabaseStatementInterface.h"
+
+using namespace IP::Db;
+
+// Statement stand-in that only records cancellation requests
+class CCancelCountingStatement : public IDatabaseStatement
+{
+	public:
+
+		CCancelCountingStatement( void ) :
+			StatementText( L"test" ),
+			CancelCount( 0 )
+		{}
+
+		virtual ~CCancelCountingStatement() {}
+
+		virtual void Initialize( const std::wstring & /*statement_text*/ ) {}
+		virtual void Shutdown( void ) {}
+
+		virtual DBStatementIDType Get_ID( void ) const { return DBSIDT_INVALID; }
+		virtual const std::wstring &Get_Statement_Text( void ) const { return StatementText; }
+
+		virtual void Bind_Input( IDatabaseVariableSet * /*param_set*/, uint32_t /*param_set_size*/ ) {}
+		virtual void Bind_Output( IDatabaseVariableSet * /*result_set*/, uint32_t /*result_set_size*/, uint32_t /*result_set_count*/ ) {}
+		virtual void Execute( uint32_t /*batch_size*/ ) {}
+		virtual EFetchResultsStatusType Fetch_Results( int64_t &rows_fetched ) { rows_fetched = 0; return FRST_FINISHED_ALL; }
+		virtual void Return_To_Ready( void ) {}
+
+		virtual void Cancel( void ) { ++CancelCount; }
+
+		virtual bool Needs_Binding( void ) const { return false; }
+		virtual bool Is_Ready_For_Use( void ) const { return true; }
+		virtual bool Is_In_Error_State( void ) const { return false; }
+		virtual bool Should_Have_Results( void ) const { return false; }
+		virtual IDatabaseConnection *Get_Connection( void ) const { return nullptr; }
+
+		virtual DBErrorStateType Get_Error_State( void ) const { return DBEST_SUCCESS; }
+		virtual int32_t Get_Bad_Row_Number( void ) const { return -1; }
+		virtual void Log_Error_State( void ) const {}
+
+		uint32_t Get_Cancel_Count( void ) const { return CancelCount; }
+
+	private:
+
+		std::wstring StatementText;
+
+		std::atomic< uint32_t > CancelCount;
+};
+
+TEST( DatabaseStatementWatchdogTests, Cancels_Past_Deadline )
+{
+	CDatabaseStatementWatchdog watchdog;
+	watchdog.Start();
+
+	CCancelCountingStatement statement;
+	watchdog.Watch( &statement, Get_Database_Task_Time() + .02 );
+
+	std::this_thread::sleep_for( std::chrono::milliseconds( 250 ) );
+
+	ASSERT_TRUE( watchdog.Unwatch() );
+	ASSERT_TRUE( statement.Get_Cancel_Count() == 1 );
+	ASSERT_TRUE( watchdog.Get_Cancel_Count() == 1 );
+
+	watchdog.Stop();
+}
+
+TEST( DatabaseStatementWatchdogTests, No_Cancel_Within_Deadline )
+{
+	CDatabaseStatementWatchdog watchdog;
+	watchdog.Start();
+
+	CCancelCountingStatement statement;
+	watchdog.Watch( &statement, Get_Database_Task_Time() + 60.0 );
+
+	std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+
+	ASSERT_FALSE( watchdog.Unwatch() );
+	ASSERT_TRUE( statement.Get_Cancel_Count() == 0 );
+
+	watchdog.Stop();
+}
+
+TEST( DatabaseStatementWatchdogTests, Rewatch_After_Cancel )
+{
+	CDatabaseStatementWatchdog watchdog;
+	watchdog.Start();
+
+	CCancelCountingStatement statement;
+	watchdog.Watch( &statement, Get_Database_Task_Time() - 1.0 );
+	std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+	ASSERT_TRUE( watchdog.Unwatch() );
+
+	watchdog.Watch( &statement, Get_Database_Task_Time() + 60.0 );
+	ASSERT_FALSE( watchdog.Unwatch() );
+
+	watchdog.Watch( &statement, Get_Database_Task_Time() - 1.0 );
+	std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+	ASSERT_TRUE( watchdog.Unwatch() );
+
+	ASSERT_TRUE( statement.Get_Cancel_Count() == 2 );
+
+	watchdog.Stop();
+}
@@ -0,0 +1,160 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2012, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPDatabase/DatabaseTaskQueue.h"
+
+using namespace IP::Db;
+
+TEST( DatabaseTaskQueueTests, Empty )
+{
+	TDatabaseTaskQueue< uint32_t > queue;
+
+	ASSERT_TRUE( queue.Empty() );
+	ASSERT_TRUE( queue.Size() == 0 );
+	ASSERT_TRUE( queue.Pop_Front( 5 ).empty() );
+}
+
+TEST( DatabaseTaskQueueTests, Push_Pop_Ordering )
+{
+	TDatabaseTaskQueue< uint32_t > queue;
+
+	for ( uint32_t i = 0; i < 100; ++i )
+	{
+		queue.Push_Back( i );
+	}
+
+	ASSERT_TRUE( queue.Size() == 100 );
+	ASSERT_TRUE( queue.Front() == 0 );
+
+	uint32_t expected = 0;
+	while ( !queue.Empty() )
+	{
+		TDatabaseTaskRange< uint32_t > range = queue.Pop_Front( 7 );
+		ASSERT_TRUE( range.size() == 7 || queue.Empty() );
+
+		for ( auto iter = range.begin(); iter != range.end(); ++iter, ++expected )
+		{
+			ASSERT_TRUE( *iter == expected );
+		}
+	}
+
+	ASSERT_TRUE( expected == 100 );
+}
+
+TEST( DatabaseTaskQueueTests, Wrapped_Pop_Is_Contiguous )
+{
+	TDatabaseTaskQueue< uint32_t > queue;
+
+	uint32_t next_value = 0;
+	uint32_t expected = 0;
+
+	// interleave pushes and pops so that the live region repeatedly wraps the end of the buffer
+	for ( uint32_t round = 0; round < 50; ++round )
+	{
+		for ( uint32_t i = 0; i < 11; ++i )
+		{
+			queue.Push_Back( next_value++ );
+		}
+
+		TDatabaseTaskRange< uint32_t > range = queue.Pop_Front( 9 );
+		ASSERT_TRUE( range.size() == 9 );
+		for ( size_t i = 0; i < range.size(); ++i )
+		{
+			ASSERT_TRUE( range[ i ] == expected++ );
+		}
+	}
+
+	ASSERT_TRUE( queue.Size() == 100 );
+}
+
+TEST( DatabaseTaskQueueTests, Indexed_Replace_Across_Wrap )
+{
+	TDatabaseTaskQueue< uint32_t > queue;
+	for ( uint32_t i = 0; i < 12; ++i )
+	{
+		queue.Push_Back( i );
+	}
+
+	queue.Pop_Front( 10 );
+
+	// the live region now wraps the end of the buffer; indices are relative to the front
+	for ( uint32_t i = 12; i < 24; ++i )
+	{
+		queue.Push_Back( i );
+	}
+
+	ASSERT_TRUE( queue[ 0 ] == 10 );
+	ASSERT_TRUE( queue[ 13 ] == 23 );
+
+	queue[ 1 ] = 100;
+	queue[ 8 ] = 200;
+
+	TDatabaseTaskRange< uint32_t > range = queue.Pop_Front( 14 );
+	ASSERT_TRUE( range.size() == 14 );
+	ASSERT_TRUE( range[ 0 ] == 10 );
+	ASSERT_TRUE( range[ 1 ] == 100 );
+	ASSERT_TRUE( range[ 2 ] == 12 );
+	ASSERT_TRUE( range[ 8 ] == 200 );
+	ASSERT_TRUE( range[ 13 ] == 23 );
+}
+
+TEST( DatabaseTaskQueueTests, Range_Remove_And_Sub_Range )
+{
+	TDatabaseTaskQueue< uint32_t > queue;
+	for ( uint32_t i = 0; i < 5; ++i )
+	{
+		queue.Push_Back( i );
+	}
+
+	TDatabaseTaskRange< uint32_t > range = queue.Pop_Front( 5 );
+	range.Remove( 2 );
+
+	ASSERT_TRUE( range.size() == 4 );
+	ASSERT_TRUE( range[ 0 ] == 0 );
+	ASSERT_TRUE( range[ 1 ] == 1 );
+	ASSERT_TRUE( range[ 2 ] == 3 );
+	ASSERT_TRUE( range[ 3 ] == 4 );
+
+	TDatabaseTaskRange< uint32_t > sub_range = range.Sub_Range( 1, 2 );
+	ASSERT_TRUE( sub_range.size() == 2 );
+	ASSERT_TRUE( sub_range[ 0 ] == 1 );
+	ASSERT_TRUE( sub_range[ 1 ] == 3 );
+}
+
+TEST( DatabaseTaskQueueTests, Move_Only_Items )
+{
+	TDatabaseTaskQueue< std::unique_ptr< uint32_t > > queue;
+	for ( uint32_t i = 0; i < 40; ++i )
+	{
+		queue.Push_Back( std::unique_ptr< uint32_t >( new uint32_t( i ) ) );
+	}
+
+	TDatabaseTaskQueue< std::unique_ptr< uint32_t > > moved_queue( std::move( queue ) );
+	ASSERT_TRUE( queue.Empty() );
+	ASSERT_TRUE( moved_queue.Size() == 40 );
+
+	TDatabaseTaskRange< std::unique_ptr< uint32_t > > range = moved_queue.Pop_Front( 40 );
+	for ( uint32_t i = 0; i < range.size(); ++i )
+	{
+		ASSERT_TRUE( *range[ i ] == i );
+	}
+}
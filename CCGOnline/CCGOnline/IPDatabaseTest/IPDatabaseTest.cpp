@@ -44,7 +44,11 @@ void Shutdown_IPDatabaseTest( void )
 
 using namespace IP::Global;
 
+#ifdef WIN32
 int main(int argc, wchar_t* argv[])
+#else
+int main(int argc, char* argv[])
+#endif // WIN32
 {
 	Initialize_IPDatabaseTest();
 
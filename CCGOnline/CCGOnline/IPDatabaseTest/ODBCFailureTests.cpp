@@ -79,6 +79,8 @@ class CMissingProcedureCall : public TDatabaseProcedureCall< CEmptyVariableSet,
 			ASSERT_TRUE( Rollbacks == expected_rollback_count );
 		}
 
+		bool Was_Executed( void ) const { return InitializeCalls > 0; }
+
 	protected:
 
 		virtual void Initialize_Parameters( IDatabaseVariableSet * /*input_parameters*/ ) { InitializeCalls++; }	
@@ -162,6 +164,62 @@ TEST_F( ODBCFailureTests, MissingProcedureCall_3_1_3 )
 	Run_MissingProcedureCall_Test< 3, 1 >( 3 );
 }
 
+template< uint32_t ISIZE, uint32_t OSIZE >
+void Run_ExpiredDeadline_Test( uint32_t task_count )
+{
+	IDatabaseConnection *connection = CODBCFactory::Get_Environment()->Add_Connection( L"Driver={SQL Server Native Client 11.0};Server=AZAZELPC\\CCGONLINE;Database=testdb;UID=testserver;PWD=TEST5erver#;", false );
+	ASSERT_TRUE( connection != nullptr );
+
+	// every other task is already past its deadline when the batch runs
+	double current_time = Get_Database_Task_Time();
+
+	TDatabaseTaskBatch< CMissingProcedureCall< ISIZE, OSIZE > > db_task_batch;
+	std::vector< CMissingProcedureCall< ISIZE, OSIZE > * > tasks;
+	for ( uint32_t i = 0; i < task_count; ++i )
+	{
+		CMissingProcedureCall< ISIZE, OSIZE > *db_task = new CMissingProcedureCall< ISIZE, OSIZE >;
+		db_task->Set_Deadline( ( i % 2 == 0 ) ? current_time - 1.0 : current_time + 600.0 );
+		tasks.push_back( db_task );
+		db_task_batch.Add_Task( db_task );
+	}
+
+	DBTaskBaseListType successful_tasks;
+	DBTaskBaseListType failed_tasks;
+	db_task_batch.Execute_Tasks( connection, successful_tasks, failed_tasks );
+
+	ASSERT_TRUE( failed_tasks.size() == task_count );
+	ASSERT_TRUE( successful_tasks.size() == 0 );
+	
+	for ( uint32_t i = 0; i < tasks.size(); ++i )
+	{
+		if ( i % 2 == 0 )
+		{
+			ASSERT_TRUE( tasks[ i ]->Get_Result() == EDatabaseTaskResult::DEADLINE_EXPIRED );
+			ASSERT_FALSE( tasks[ i ]->Was_Executed() );
+		}
+		else
+		{
+			ASSERT_TRUE( tasks[ i ]->Get_Result() == EDatabaseTaskResult::PENDING );
+			ASSERT_TRUE( tasks[ i ]->Was_Executed() );
+		}
+
+		delete tasks[ i ];
+	}
+
+	CODBCFactory::Get_Environment()->Shutdown_Connection( connection->Get_ID() );
+	delete connection;
+}
+
+TEST_F( ODBCFailureTests, ExpiredDeadline_1_1_2 )
+{
+	Run_ExpiredDeadline_Test< 1, 1 >( 2 );
+}
+
+TEST_F( ODBCFailureTests, ExpiredDeadline_3_1_7 )
+{
+	Run_ExpiredDeadline_Test< 3, 1 >( 7 );
+}
+
 class CTooFewInputParams : public CODBCVariableSet
 {
 	public:
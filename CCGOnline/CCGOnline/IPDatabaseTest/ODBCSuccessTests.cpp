@@ -911,6 +911,143 @@ TEST_F( ODBCSuccessTests, DoNothing_OK_Test_3_7 )
 	Run_DoNothing_OK_Test< 3 >( 7 );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////
+// Coalesced writes
+
+template< uint32_t ISIZE >
+class CCoalescingDoNothingProcedureCall : public CDoNothingProcedureCall< ISIZE >
+{
+	public:
+
+		using BASECLASS = CDoNothingProcedureCall< ISIZE >;
+
+		CCoalescingDoNothingProcedureCall( uint64_t key, EDatabaseTaskCoalesceRule rule ) : 
+			BASECLASS(),
+			Key( key ),
+			Rule( rule ),
+			MergedTasks( 0 )
+		{}
+
+		virtual ~CCoalescingDoNothingProcedureCall() {}
+
+		virtual EDatabaseTaskCoalesceRule Get_Coalesce_Rule( void ) const { return Rule; }
+		virtual uint64_t Get_Coalesce_Key( void ) const { return Key; }
+
+		uint32_t Get_Merged_Tasks( void ) const { return MergedTasks; }
+
+	protected:
+
+		virtual void Merge_Superseded_Task( IDatabaseTask *older_task ) 
+		{
+			MergedTasks += 1 + static_cast< CCoalescingDoNothingProcedureCall< ISIZE > * >( older_task )->MergedTasks;
+		}
+
+	private:
+
+		uint64_t Key;
+		EDatabaseTaskCoalesceRule Rule;
+
+		uint32_t MergedTasks;
+};
+
+template< uint32_t ISIZE >
+void Run_Coalesced_DoNothing_OK_Test( const std::vector< uint64_t > &keys, EDatabaseTaskCoalesceRule rule )
+{
+	IDatabaseConnection *connection = CODBCFactory::Get_Environment()->Add_Connection( L"Driver={SQL Server Native Client 11.0};Server=AZAZELPC\\CCGONLINE;Database=testdb;UID=testserver;PWD=TEST5erver#;", false );
+	ASSERT_TRUE( connection != nullptr );
+
+	TDatabaseTaskBatch< CCoalescingDoNothingProcedureCall< ISIZE > > db_task_batch;
+	std::vector< CCoalescingDoNothingProcedureCall< ISIZE > * > tasks;
+	std::unordered_map< uint64_t, uint32_t > key_counts;
+	for ( uint32_t i = 0; i < keys.size(); ++i )
+	{
+		CCoalescingDoNothingProcedureCall< ISIZE > *db_task = new CCoalescingDoNothingProcedureCall< ISIZE >( keys[ i ], rule );
+		tasks.push_back( db_task );
+		db_task_batch.Add_Task( db_task );
+		key_counts[ keys[ i ] ]++;
+	}
+
+	DBTaskBaseListType successful_tasks;
+	DBTaskBaseListType failed_tasks;
+	db_task_batch.Execute_Tasks( connection, successful_tasks, failed_tasks );
+
+	// every submitted task is reported, even though only the last task per key reached the database
+	ASSERT_TRUE( failed_tasks.size() == 0 );
+	ASSERT_TRUE( successful_tasks.size() == keys.size() );
+	
+	for ( int32_t i = static_cast< int32_t >( tasks.size() ) - 1; i >= 0; --i )
+	{
+		uint64_t key = keys[ i ];
+		if ( key_counts[ key ] > 0 )
+		{
+			tasks[ i ]->Verify_Results();
+			if ( rule == EDatabaseTaskCoalesceRule::MERGE )
+			{
+				ASSERT_TRUE( tasks[ i ]->Get_Merged_Tasks() == key_counts[ key ] - 1 );
+			}
+
+			key_counts[ key ] = 0;
+		}
+
+		delete tasks[ i ];
+	}
+
+	CODBCFactory::Get_Environment()->Shutdown_Connection( connection->Get_ID() );
+	delete connection;
+}
+
+TEST_F( ODBCSuccessTests, DoNothing_Coalesced_LastWriterWins_OK_Test_2 )
+{
+	Run_Coalesced_DoNothing_OK_Test< 2 >( std::vector< uint64_t >{ 1, 1, 2, 1, 2, 3 }, EDatabaseTaskCoalesceRule::LAST_WRITER_WINS );
+}
+
+TEST_F( ODBCSuccessTests, DoNothing_Coalesced_Merge_OK_Test_3 )
+{
+	Run_Coalesced_DoNothing_OK_Test< 3 >( std::vector< uint64_t >{ 5, 5, 5, 7, 5, 7, 9 }, EDatabaseTaskCoalesceRule::MERGE );
+}
+
+TEST_F( ODBCSuccessTests, DoNothing_Coalesced_Keeps_Queue_Order )
+{
+	IDatabaseConnection *connection = CODBCFactory::Get_Environment()->Add_Connection( L"Driver={SQL Server Native Client 11.0};Server=AZAZELPC\\CCGONLINE;Database=testdb;UID=testserver;PWD=TEST5erver#;", false );
+	ASSERT_TRUE( connection != nullptr );
+
+	// coalesced writes to key 1 interleaved with uncoalesced writes of the same type
+	TDatabaseTaskBatch< CCoalescingDoNothingProcedureCall< 2 > > db_task_batch;
+	std::vector< CCoalescingDoNothingProcedureCall< 2 > * > tasks;
+	tasks.push_back( new CCoalescingDoNothingProcedureCall< 2 >( 1, EDatabaseTaskCoalesceRule::LAST_WRITER_WINS ) );
+	tasks.push_back( new CCoalescingDoNothingProcedureCall< 2 >( 0, EDatabaseTaskCoalesceRule::NONE ) );
+	tasks.push_back( new CCoalescingDoNothingProcedureCall< 2 >( 1, EDatabaseTaskCoalesceRule::LAST_WRITER_WINS ) );
+	tasks.push_back( new CCoalescingDoNothingProcedureCall< 2 >( 0, EDatabaseTaskCoalesceRule::NONE ) );
+	tasks.push_back( new CCoalescingDoNothingProcedureCall< 2 >( 2, EDatabaseTaskCoalesceRule::LAST_WRITER_WINS ) );
+
+	for ( uint32_t i = 0; i < tasks.size(); ++i )
+	{
+		db_task_batch.Add_Task( tasks[ i ] );
+	}
+
+	DBTaskBaseListType successful_tasks;
+	DBTaskBaseListType failed_tasks;
+	db_task_batch.Execute_Tasks( connection, successful_tasks, failed_tasks );
+
+	ASSERT_TRUE( failed_tasks.size() == 0 );
+	ASSERT_TRUE( successful_tasks.size() == tasks.size() );
+
+	// executed tasks are reported in execution order, ahead of the tasks they superseded; the surviving key 1 write
+	// runs from the position of the first key 1 write
+	std::vector< IDatabaseTask * > expected_order{ tasks[ 2 ], tasks[ 1 ], tasks[ 3 ], tasks[ 4 ], tasks[ 0 ] };
+	std::vector< IDatabaseTask * > reported_order;
+	std::for_each( successful_tasks.cbegin(), successful_tasks.cend(), [ &reported_order ]( IDatabaseTaskBase *task ){ reported_order.push_back( static_cast< IDatabaseTask * >( task ) ); } );
+	ASSERT_TRUE( reported_order == expected_order );
+
+	for ( uint32_t i = 0; i < tasks.size(); ++i )
+	{
+		delete tasks[ i ];
+	}
+
+	CODBCFactory::Get_Environment()->Shutdown_Connection( connection->Get_ID() );
+	delete connection;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////
 // Boolean input/output test
 
@@ -24,6 +24,11 @@
 #include <sstream>
 #include <iostream>
 
+#ifndef WIN32
+#include <cstdio>
+#include "StringUtils.h"
+#endif // WIN32
+
 static void Build_Assertion_String( const char *expression_string, const char *file_name, uint32_t line_number, bool is_fatal, std::wstring &output_string )
 {
 	std::basic_ostringstream< wchar_t > assert_description;
@@ -88,6 +93,7 @@ bool CAssertSystem::Assert_Handler( const char *expression_string, const char *f
 		LogFunction( assert_string );
 	}
 
+#ifdef WIN32
 	// bring up a message box
 	int result = 0;
 	if ( force_crash )
@@ -106,6 +112,20 @@ bool CAssertSystem::Assert_Handler( const char *expression_string, const char *f
 	{
 		DebugBreak();
 	}       
+#else
+	// no message box to bring up; report on stderr and let the fatal case fault into the exception handler
+	std::string narrow_assert_string;
+	IP::String::WideString_To_String( assert_string, narrow_assert_string );
+	std::fputs( narrow_assert_string.c_str(), stderr );
+	std::fflush( stderr );
+
+	if ( force_crash )
+	{
+		int32_t * volatile null_dereference = nullptr;
+		*null_dereference = 5;
+		return false;
+	}
+#endif // WIN32
 
 	return true;	
 }
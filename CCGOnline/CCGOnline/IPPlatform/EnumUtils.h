@@ -30,7 +30,7 @@ bool Are_All_Enum_Flags_Set( T value, T mask )
 {
 	static_assert( std::is_enum< T >::value, "Type T must be an enum" );
 
-	using BaseEnumType = std::underlying_type< T >::type;
+	using BaseEnumType = typename std::underlying_type< T >::type;
 
 	return ( static_cast< BaseEnumType >( value ) & static_cast< BaseEnumType >( mask ) ) == static_cast< BaseEnumType >( mask );
 }
@@ -40,7 +40,7 @@ bool Is_An_Enum_Flag_Set( T value, T mask )
 {
 	static_assert( std::is_enum< T >::value, "Type T must be an enum" );
 
-	using BaseEnumType = std::underlying_type< T >::type;
+	using BaseEnumType = typename std::underlying_type< T >::type;
 
 	return ( static_cast< BaseEnumType >( value ) & static_cast< BaseEnumType >( mask ) ) != 0;
 }
@@ -58,7 +58,7 @@ T Make_Enum_Mask( T first, Args... rest )
 {
 	static_assert( std::is_enum< T >::value, "Type T must be an enum" );
 
-	using BaseEnumType = std::underlying_type< T >::type;
+	using BaseEnumType = typename std::underlying_type< T >::type;
 
 	BaseEnumType rest_value = static_cast< BaseEnumType >( Make_Enum_Mask( rest... ) );
 
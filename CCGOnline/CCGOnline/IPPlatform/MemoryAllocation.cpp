@@ -25,7 +25,7 @@
 #pragma warning( push )
 #pragma warning( disable : 4290 )
 
-void *operator new( std::size_t size ) throw( std::bad_alloc )
+void *operator new( std::size_t size ) IP_THROWS_BAD_ALLOC
 {
 	if ( size  == 0 )
 	{
@@ -41,7 +41,7 @@ void *operator new( std::size_t size ) throw( std::bad_alloc )
 	throw std::bad_alloc();
 }
 
-void *operator new( std::size_t size, const std::nothrow_t & /*no_throw*/ ) throw()
+void *operator new( std::size_t size, const std::nothrow_t & /*no_throw*/ ) IP_NO_THROW
 {
 	if ( size  == 0 )
 	{
@@ -51,17 +51,17 @@ void *operator new( std::size_t size, const std::nothrow_t & /*no_throw*/ ) thro
 	return scalable_malloc( size );
 }
 
-void *operator new[]( std::size_t size ) throw( std::bad_alloc )
+void *operator new[]( std::size_t size ) IP_THROWS_BAD_ALLOC
 {
 	return operator new( size );
 }
 
-void *operator new[]( std::size_t size, const std::nothrow_t &no_throw ) throw()
+void *operator new[]( std::size_t size, const std::nothrow_t &no_throw ) IP_NO_THROW
 {
 	return operator new( size, no_throw );
 }
 
-void operator delete( void *memory ) throw()
+void operator delete( void *memory ) IP_NO_THROW
 {
 	if ( memory != nullptr )
 	{
@@ -69,7 +69,7 @@ void operator delete( void *memory ) throw()
 	}
 }
 
-void operator delete( void *memory, const std::nothrow_t & /*no_throw*/ ) throw()
+void operator delete( void *memory, const std::nothrow_t & /*no_throw*/ ) IP_NO_THROW
 {
 	if ( memory != nullptr )
 	{
@@ -77,12 +77,12 @@ void operator delete( void *memory, const std::nothrow_t & /*no_throw*/ ) throw(
 	}
 }
 
-void operator delete[]( void *memory ) throw()
+void operator delete[]( void *memory ) IP_NO_THROW
 {
 	operator delete( memory );
 }
 
-void operator delete[]( void *memory, const std::nothrow_t &no_throw ) throw()
+void operator delete[]( void *memory, const std::nothrow_t &no_throw ) IP_NO_THROW
 {
 	operator delete( memory, no_throw );
 }
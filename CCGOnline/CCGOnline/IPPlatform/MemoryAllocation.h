@@ -21,18 +21,27 @@
 
 //#define USE_CACHE_ALIGNED_ALLOCATION
 
+// Dynamic exception specifications are gone as of C++17; v120 predates noexcept
+#if defined( _MSC_VER ) && _MSC_VER < 1900
+#define IP_THROWS_BAD_ALLOC throw( std::bad_alloc )
+#define IP_NO_THROW throw()
+#else
+#define IP_THROWS_BAD_ALLOC
+#define IP_NO_THROW noexcept
+#endif
+
 #pragma warning( push )
 #pragma warning( disable : 4290 )
 
-void *operator new( std::size_t size ) throw( std::bad_alloc );
-void *operator new( std::size_t size, const std::nothrow_t &no_throw ) throw();
-void *operator new[]( std::size_t size ) throw( std::bad_alloc );
-void *operator new[]( std::size_t size, const std::nothrow_t &no_throw ) throw();
+void *operator new( std::size_t size ) IP_THROWS_BAD_ALLOC;
+void *operator new( std::size_t size, const std::nothrow_t &no_throw ) IP_NO_THROW;
+void *operator new[]( std::size_t size ) IP_THROWS_BAD_ALLOC;
+void *operator new[]( std::size_t size, const std::nothrow_t &no_throw ) IP_NO_THROW;
 
-void operator delete( void *memory ) throw();
-void operator delete( void *memory, const std::nothrow_t &no_throw ) throw();
-void operator delete[]( void *memory ) throw();
-void operator delete[]( void *memory, const std::nothrow_t &no_throw ) throw();
+void operator delete( void *memory ) IP_NO_THROW;
+void operator delete( void *memory, const std::nothrow_t &no_throw ) IP_NO_THROW;
+void operator delete[]( void *memory ) IP_NO_THROW;
+void operator delete[]( void *memory, const std::nothrow_t &no_throw ) IP_NO_THROW;
 
 #pragma warning( pop ) 
 
@@ -21,7 +21,19 @@
 
 #include <sstream>
 #include <iostream>
+
+#ifdef WIN32
 #include <DbgHelp.h>
+#else
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <cerrno>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <unistd.h>
+#endif // WIN32
 
 #include "PlatformExceptionHandler.h"
 #include "PlatformMisc.h"
@@ -336,6 +348,387 @@ bool CPlatformExceptionHandler::Load_Symbols( std::wstring &error_message )
 	return true;
 }
 
+
+void CPlatformExceptionHandler::Install_Thread_Signal_Stack( void )
+{
+	// Windows has no per-thread signal stack; the vectored handler reports stack overflows as they are raised
+}
+
+
+void CPlatformExceptionHandler::Remove_Thread_Signal_Stack( void )
+{
+}
+
+} // namespace Debug
+} // namespace IP
+
+#else
+
+#include "PlatformFileSystem.h"
+#include "StringUtils.h"
+
+// SIGUSR1 plays the role of the Windows test exception (code 1): it is reported and execution then continues
+static const int TEST_EXCEPTION_SIGNAL = SIGUSR1;
+
+static const int HandledSignals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT, TEST_EXCEPTION_SIGNAL };
+static const size_t HANDLED_SIGNAL_COUNT = sizeof( HandledSignals ) / sizeof( HandledSignals[ 0 ] );
+
+static struct sigaction PreviousSignalActions[ HANDLED_SIGNAL_COUNT ];
+
+static const int MAX_STACK_FRAMES = 128;
+
+// The signal handler's own frame is not part of the reported stack
+static const int HANDLER_FRAME_COUNT = 1;
+
+// Room for the handler to walk the faulting stack even when that stack is exhausted
+static const size_t SIGNAL_STACK_SIZE = 64 * 1024;
+
+// What the signal handler passes to the reporter thread; only written by the thread holding the report token
+struct SSignalReport
+{
+	int SignalNumber;
+	int SignalCode;
+	int FrameCount;
+	void *Frames[ MAX_STACK_FRAMES ];
+};
+
+static SSignalReport PendingReport;
+
+// Pipes are the only thing the handler blocks on, since read() and write() are async-signal-safe.  The token pipe holds a
+// single byte that serializes faulting threads; the request and done pipes hand a report to the reporter thread and back.
+static int ReportTokenPipe[ 2 ] = { -1, -1 };
+static int ReportRequestPipe[ 2 ] = { -1, -1 };
+static int ReportDonePipe[ 2 ] = { -1, -1 };
+
+static const uint8_t REPORT_REQUEST = 1;
+static const uint8_t STOP_REQUEST = 0;
+
+static std::thread ReporterThread;
+
+// Set on the reporter thread, and on a faulting thread while it holds the token, so that a fault there is not reported again
+static thread_local bool ReportingBlocked = false;
+
+static thread_local uint8_t *ThreadSignalStack = nullptr;
+
+static bool Write_Report_Byte( int fd, uint8_t value )
+{
+	for ( ;; )
+	{
+		ssize_t result = ::write( fd, &value, 1 );
+		if ( result == 1 )
+		{
+			return true;
+		}
+
+		if ( result < 0 && errno != EINTR )
+		{
+			return false;
+		}
+	}
+}
+
+static bool Read_Report_Byte( int fd, uint8_t &value )
+{
+	for ( ;; )
+	{
+		ssize_t result = ::read( fd, &value, 1 );
+		if ( result == 1 )
+		{
+			return true;
+		}
+
+		if ( result == 0 || errno != EINTR )
+		{
+			return false;
+		}
+	}
+}
+
+static void Add_Stack_Frames( const SSignalReport &report, IP::Debug::CStructuredExceptionInfo &info )
+{
+	for ( int i = HANDLER_FRAME_COUNT; i < report.FrameCount; ++i )
+	{
+		uint64_t address = reinterpret_cast< uint64_t >( report.Frames[ i ] );
+
+		Dl_info symbol_info;
+		if ( ::dladdr( report.Frames[ i ], &symbol_info ) == 0 )
+		{
+			info.Add_Frame( IP::Debug::CStackFrame( address, std::wstring(), std::wstring() ) );
+			continue;
+		}
+
+		std::wstring symbol_name;
+		if ( symbol_info.dli_sname != nullptr )
+		{
+			int demangle_status = 0;
+			char *demangled_name = abi::__cxa_demangle( symbol_info.dli_sname, nullptr, nullptr, &demangle_status );
+			IP::String::String_To_WideString( demangle_status == 0 ? demangled_name : symbol_info.dli_sname, symbol_name );
+			std::free( demangled_name );
+		}
+
+		std::wstring module_name;
+		if ( symbol_info.dli_fname != nullptr )
+		{
+			IP::String::String_To_WideString( symbol_info.dli_fname, module_name );
+			module_name = IP::File::Strip_Path( module_name );
+		}
+
+		info.Add_Frame( IP::Debug::CStackFrame( address, symbol_name, module_name ) );
+	}
+}
+
+static std::wstring Convert_Signal_To_Message( int signal_number, int signal_code )
+{
+	switch ( signal_number )
+	{
+		case SIGSEGV:
+			return std::wstring( L"Access Violation" );
+
+		case SIGBUS:
+			return std::wstring( L"Bus Error" );
+
+		case SIGFPE:
+			switch ( signal_code )
+			{
+				case FPE_INTDIV:
+					return std::wstring( L"Divide By Zero" );
+
+				case FPE_FLTDIV:
+					return std::wstring( L"FP Divide By Zero" );
+
+				case FPE_FLTINV:
+					return std::wstring( L"FP Invalid Op" );
+
+				case FPE_FLTOVF:
+					return std::wstring( L"FP Overflow" );
+
+				case FPE_FLTUND:
+					return std::wstring( L"FP Underflow" );
+
+				default:
+					return std::wstring( L"Floating Point Exception" );
+			}
+
+		case SIGILL:
+			if ( signal_code == ILL_PRVOPC )
+			{
+				return std::wstring( L"Privileged Instruction" );
+			}
+
+			return std::wstring( L"Illegal Instruction" );
+
+		case SIGABRT:
+			return std::wstring( L"Abort" );
+
+		default:
+		{
+			std::basic_ostringstream< wchar_t > error_string;
+			error_string << L"Unknown Signal: " << signal_number;
+			return error_string.rdbuf()->str();
+		}
+	}
+}
+
+// Runs the registered handler for each report the signal handler posts, off the faulting thread's stack and outside signal context
+static void Report_Signals( void )
+{
+	ReportingBlocked = true;
+
+	uint8_t request = STOP_REQUEST;
+	while ( Read_Report_Byte( ReportRequestPipe[ 0 ], request ) && request == REPORT_REQUEST )
+	{
+		{
+			std::lock_guard< std::mutex > exception_lock( IP::Debug::CPlatformExceptionHandler::Get_Lock() );
+
+			IP::Debug::CStructuredExceptionInfo shared_exception_info( PendingReport.SignalNumber == TEST_EXCEPTION_SIGNAL );
+			shared_exception_info.Set_Exception_Message( ::Convert_Signal_To_Message( PendingReport.SignalNumber, PendingReport.SignalCode ) );
+
+			if ( IP::Debug::CPlatformExceptionHandler::Load_Symbols( shared_exception_info.Get_Symbol_Error() ) )
+			{
+				::Add_Stack_Frames( PendingReport, shared_exception_info );
+			}
+
+			IP::Debug::CPlatformExceptionHandler::On_Exception( shared_exception_info );
+		}
+
+		Write_Report_Byte( ReportDonePipe[ 1 ], REPORT_REQUEST );
+	}
+}
+
+// Only async-signal-safe work happens here: the heap and any lock may be in an arbitrary state when a fault arrives
+static __attribute__(( noinline )) void Posix_Signal_Handler( int signal_number, siginfo_t *signal_info, void * /*context*/ )
+{
+	int saved_errno = errno;
+	bool is_test_exception = signal_number == TEST_EXCEPTION_SIGNAL;
+
+	uint8_t token = 0;
+	if ( !ReportingBlocked && Read_Report_Byte( ReportTokenPipe[ 0 ], token ) )
+	{
+		ReportingBlocked = true;
+
+		PendingReport.SignalNumber = signal_number;
+		PendingReport.SignalCode = signal_info->si_code;
+		PendingReport.FrameCount = ::backtrace( PendingReport.Frames, MAX_STACK_FRAMES );
+
+		uint8_t done = 0;
+		if ( Write_Report_Byte( ReportRequestPipe[ 1 ], REPORT_REQUEST ) )
+		{
+			Read_Report_Byte( ReportDonePipe[ 0 ], done );
+		}
+
+		ReportingBlocked = false;
+		Write_Report_Byte( ReportTokenPipe[ 1 ], token );
+	}
+
+	errno = saved_errno;
+
+	if ( is_test_exception )
+	{
+		return;
+	}
+
+	// Equivalent of EXCEPTION_CONTINUE_SEARCH: restore the default disposition and let the signal terminate the process
+	::signal( signal_number, SIG_DFL );
+	::raise( signal_number );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace IP
+{
+namespace Debug
+{
+
+DExceptionHandler CPlatformExceptionHandler::Handler;
+std::mutex CPlatformExceptionHandler::ExceptionLock;
+bool CPlatformExceptionHandler::SymbolsLoaded = false;
+bool CPlatformExceptionHandler::Initialized = false;
+
+
+void CPlatformExceptionHandler::Initialize( const DExceptionHandler &handler )
+{
+	FATAL_ASSERT( !Initialized );
+
+	Handler = handler;
+
+	std::wstring symbol_error;
+	Load_Symbols( symbol_error );
+
+	FATAL_ASSERT( ::pipe( ReportTokenPipe ) == 0 && ::pipe( ReportRequestPipe ) == 0 && ::pipe( ReportDonePipe ) == 0 );
+	Write_Report_Byte( ReportTokenPipe[ 1 ], REPORT_REQUEST );
+
+	ReporterThread = std::thread( Report_Signals );
+
+	Install_Thread_Signal_Stack();
+
+	struct sigaction signal_action;
+	std::memset( &signal_action, 0, sizeof( signal_action ) );
+	signal_action.sa_sigaction = Posix_Signal_Handler;
+	signal_action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+	sigemptyset( &signal_action.sa_mask );
+
+	for ( size_t i = 0; i < HANDLED_SIGNAL_COUNT; ++i )
+	{
+		::sigaction( HandledSignals[ i ], &signal_action, &PreviousSignalActions[ i ] );
+	}
+
+	Initialized = true;
+}
+
+
+void CPlatformExceptionHandler::Shutdown( void )
+{
+	if ( !Initialized )
+	{
+		return;
+	}
+
+	for ( size_t i = 0; i < HANDLED_SIGNAL_COUNT; ++i )
+	{
+		::sigaction( HandledSignals[ i ], &PreviousSignalActions[ i ], nullptr );
+	}
+
+	Write_Report_Byte( ReportRequestPipe[ 1 ], STOP_REQUEST );
+	ReporterThread.join();
+
+	int *pipes[] = { ReportTokenPipe, ReportRequestPipe, ReportDonePipe };
+	for ( int *report_pipe : pipes )
+	{
+		::close( report_pipe[ 0 ] );
+		::close( report_pipe[ 1 ] );
+		report_pipe[ 0 ] = report_pipe[ 1 ] = -1;
+	}
+
+	Remove_Thread_Signal_Stack();
+
+	Handler = DExceptionHandler();
+	SymbolsLoaded = false;
+
+	Initialized = false;
+}
+
+
+void CPlatformExceptionHandler::On_Exception( IP::Debug::CStructuredExceptionInfo &shared_exception_info )
+{
+	if ( !Handler.empty() )
+	{
+		Handler( shared_exception_info );
+	}
+}
+
+
+bool CPlatformExceptionHandler::Load_Symbols( std::wstring & /*error_message*/ )
+{
+	if ( SymbolsLoaded )
+	{
+		return true;
+	}
+
+	// The first call to backtrace() lazily loads the unwinder, which should not happen for the first time inside a signal handler
+	void *warm_up_frame = nullptr;
+	::backtrace( &warm_up_frame, 1 );
+
+	SymbolsLoaded = true;
+	return true;
+}
+
+
+void CPlatformExceptionHandler::Install_Thread_Signal_Stack( void )
+{
+	if ( ThreadSignalStack != nullptr )
+	{
+		return;
+	}
+
+	ThreadSignalStack = new uint8_t[ SIGNAL_STACK_SIZE ];
+
+	stack_t signal_stack;
+	std::memset( &signal_stack, 0, sizeof( signal_stack ) );
+	signal_stack.ss_sp = ThreadSignalStack;
+	signal_stack.ss_size = SIGNAL_STACK_SIZE;
+	signal_stack.ss_flags = 0;
+
+	FATAL_ASSERT( ::sigaltstack( &signal_stack, nullptr ) == 0 );
+}
+
+
+void CPlatformExceptionHandler::Remove_Thread_Signal_Stack( void )
+{
+	if ( ThreadSignalStack == nullptr )
+	{
+		return;
+	}
+
+	stack_t signal_stack;
+	std::memset( &signal_stack, 0, sizeof( signal_stack ) );
+	signal_stack.ss_flags = SS_DISABLE;
+
+	::sigaltstack( &signal_stack, nullptr );
+
+	delete []ThreadSignalStack;
+	ThreadSignalStack = nullptr;
+}
+
 } // namespace Debug
 } // namespace IP
 
@@ -42,6 +42,11 @@ class CPlatformExceptionHandler
 
 		static std::mutex &Get_Lock( void ) { return ExceptionLock; }
 
+		// Gives the calling thread its own stack to report faults on, so that a stack overflow can still be reported;
+		// Initialize covers the thread that calls it, every other long-lived thread must do this for itself
+		static void Install_Thread_Signal_Stack( void );
+		static void Remove_Thread_Signal_Stack( void );
+
 	private:
 
 		static DExceptionHandler Handler;
@@ -20,7 +20,19 @@
 #include "stdafx.h"
 
 #include "PlatformFileSystem.h"
+
+#ifdef WIN32
 #include "Shlwapi.h"
+#else
+#include <fcntl.h>
+#include <glob.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "StringUtils.h"
+#endif // WIN32
+
+#ifdef WIN32
 
 namespace IP
 {
@@ -95,6 +107,230 @@ bool Delete_File( const std::wstring &file_name )
 	return true;
 }
 
+
+CMemoryMappedFile::CMemoryMappedFile( void ) :
+	FileHandle( INVALID_HANDLE_VALUE ),
+	MappingHandle( nullptr ),
+	Data( nullptr ),
+	Size( 0 )
+{
+}
+
+
+CMemoryMappedFile::~CMemoryMappedFile()
+{
+	Close();
+}
+
+
+bool CMemoryMappedFile::Open( const std::wstring &file_name )
+{
+	Close();
+
+	FileHandle = ::CreateFileW( file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+	if ( FileHandle == INVALID_HANDLE_VALUE )
+	{
+		return false;
+	}
+
+	LARGE_INTEGER file_size;
+	if ( ::GetFileSizeEx( FileHandle, &file_size ) == 0 || file_size.QuadPart == 0 )
+	{
+		Close();
+		return false;
+	}
+
+	MappingHandle = ::CreateFileMappingW( FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+	if ( MappingHandle == nullptr )
+	{
+		Close();
+		return false;
+	}
+
+	Data = static_cast< const uint8_t * >( ::MapViewOfFile( MappingHandle, FILE_MAP_READ, 0, 0, 0 ) );
+	if ( Data == nullptr )
+	{
+		Close();
+		return false;
+	}
+
+	Size = static_cast< size_t >( file_size.QuadPart );
+
+	return true;
+}
+
+
+void CMemoryMappedFile::Close( void )
+{
+	if ( Data != nullptr )
+	{
+		::UnmapViewOfFile( Data );
+		Data = nullptr;
+	}
+
+	if ( MappingHandle != nullptr )
+	{
+		::CloseHandle( MappingHandle );
+		MappingHandle = nullptr;
+	}
+
+	if ( FileHandle != INVALID_HANDLE_VALUE )
+	{
+		::CloseHandle( FileHandle );
+		FileHandle = INVALID_HANDLE_VALUE;
+	}
+
+	Size = 0;
+}
+
+} // namespace File
+} // namespace IP
+
+#else
+
+namespace IP
+{
+namespace File
+{
+
+// Paths are built with Windows separators throughout the codebase; accept them by converting to '/' on the way out
+std::string Get_Native_Path( const std::wstring &path )
+{
+	std::string native_path;
+	IP::String::WideString_To_String( path, native_path );
+	std::replace( native_path.begin(), native_path.end(), '\\', '/' );
+
+	return native_path;
+}
+
+
+std::wstring Strip_Path( const std::wstring &full_path )
+{
+	size_t separator_index = full_path.find_last_of( L"\\/" );
+	if ( separator_index == std::wstring::npos )
+	{
+		return full_path;
+	}
+
+	return full_path.substr( separator_index + 1 );
+}
+
+
+bool Directory_Exists( const std::wstring &path )
+{
+	struct stat file_stats;
+	if ( stat( Get_Native_Path( path ).c_str(), &file_stats ) != 0 )
+	{
+		return false;
+	}
+
+	return S_ISDIR( file_stats.st_mode );
+}
+
+
+bool Create_Directory( const std::wstring &path )
+{
+	return mkdir( Get_Native_Path( path ).c_str(), 0755 ) == 0;
+} 
+
+
+void Delete_Directory( const std::wstring &path )
+{
+	rmdir( Get_Native_Path( path ).c_str() );
+}
+
+
+void Enumerate_Matching_Files( const std::wstring &pattern, std::vector< std::wstring > &file_names )
+{
+	file_names.clear();
+
+	glob_t glob_results;
+	if ( glob( Get_Native_Path( pattern ).c_str(), 0, nullptr, &glob_results ) != 0 )
+	{
+		globfree( &glob_results );
+		return;
+	}
+
+	for ( size_t i = 0; i < glob_results.gl_pathc; ++i )
+	{
+		struct stat file_stats;
+		if ( stat( glob_results.gl_pathv[ i ], &file_stats ) == 0 && !S_ISDIR( file_stats.st_mode ) )
+		{
+			std::wstring file_name;
+			IP::String::String_To_WideString( glob_results.gl_pathv[ i ], file_name );
+			file_names.push_back( Strip_Path( file_name ) );
+		}
+	}
+
+	globfree( &glob_results );
+}
+
+
+bool Delete_File( const std::wstring &file_name )
+{
+	return unlink( Get_Native_Path( file_name ).c_str() ) == 0;
+}
+
+
+CMemoryMappedFile::CMemoryMappedFile( void ) :
+	Data( nullptr ),
+	Size( 0 )
+{
+}
+
+
+CMemoryMappedFile::~CMemoryMappedFile()
+{
+	Close();
+}
+
+
+bool CMemoryMappedFile::Open( const std::wstring &file_name )
+{
+	Close();
+
+	int file_descriptor = open( Get_Native_Path( file_name ).c_str(), O_RDONLY );
+	if ( file_descriptor == -1 )
+	{
+		return false;
+	}
+
+	struct stat file_stats;
+	if ( fstat( file_descriptor, &file_stats ) != 0 || file_stats.st_size == 0 )
+	{
+		close( file_descriptor );
+		return false;
+	}
+
+	// the mapping holds its own reference to the file, so the descriptor can be released immediately
+	size_t file_size = static_cast< size_t >( file_stats.st_size );
+	void *mapping = mmap( nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0 );
+	close( file_descriptor );
+
+	if ( mapping == MAP_FAILED )
+	{
+		return false;
+	}
+
+	Data = static_cast< const uint8_t * >( mapping );
+	Size = file_size;
+
+	return true;
+}
+
+
+void CMemoryMappedFile::Close( void )
+{
+	if ( Data != nullptr )
+	{
+		munmap( const_cast< uint8_t * >( Data ), Size );
+		Data = nullptr;
+	}
+
+	Size = 0;
+}
+
 } // namespace File
 } // namespace IP
 
+#endif // WIN32
\ No newline at end of file
@@ -35,6 +35,44 @@ namespace File
 
 	// Misc file-related
 	std::wstring Strip_Path( const std::wstring &full_path );
+
+	// The path in the form the standard file streams accept; Windows separators are converted on POSIX
+#ifdef WIN32
+	inline const std::wstring &Get_Native_Path( const std::wstring &path ) { return path; }
+#else
+	std::string Get_Native_Path( const std::wstring &path );
+#endif // WIN32
+
+	// A read-only view of an entire file mapped into the address space
+	class CMemoryMappedFile
+	{
+		public:
+
+			CMemoryMappedFile( void );
+			~CMemoryMappedFile();
+
+			bool Open( const std::wstring &file_name );
+			void Close( void );
+
+			bool Is_Open( void ) const { return Data != nullptr; }
+
+			const uint8_t *Get_Data( void ) const { return Data; }
+			size_t Get_Size( void ) const { return Size; }
+
+		private:
+
+			CMemoryMappedFile( const CMemoryMappedFile &rhs ) = delete;
+			CMemoryMappedFile &operator =( const CMemoryMappedFile &rhs ) = delete;
+
+#ifdef WIN32
+			void *FileHandle;
+			void *MappingHandle;
+#endif // WIN32
+
+			const uint8_t *Data;
+			size_t Size;
+	};
+
 } // namespace File
 } // namespace IP
 
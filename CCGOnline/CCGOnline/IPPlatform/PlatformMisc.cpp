@@ -21,6 +21,14 @@
 
 #include "PlatformMisc.h"
 
+#ifndef WIN32
+#include <cstring>
+#include <random>
+#include "StringUtils.h"
+#endif // WIN32
+
+#ifdef WIN32
+
 static void Convert_GUID_To_Numeric( const GUID &guid, uint32_t &first32, uint32_t &second32, uint32_t &third32, uint32_t &fourth32 )
 {
 	first32 = guid.Data1;
@@ -44,11 +52,15 @@ static void Convert_GUID_To_Numeric( const GUID &guid, uint32_t &first32, uint32
 	}
 }
 
+#endif // WIN32
+
 namespace IP
 {
 namespace Misc
 {
 
+#ifdef WIN32
+
 uint32_t Get_Semi_Unique_ID( void )
 {
 	GUID guid;
@@ -75,5 +87,24 @@ std::wstring Format_OS_Error_Message( uint32_t error_code )
 	return std::wstring( msg_buffer );
 }
 
+#else
+
+uint32_t Get_Semi_Unique_ID( void )
+{
+	std::random_device device;
+
+	return device();
+}
+
+std::wstring Format_OS_Error_Message( uint32_t error_code )
+{
+	std::wstring message;
+	IP::String::String_To_WideString( std::strerror( static_cast< int >( error_code ) ), message );
+
+	return message;
+}
+
+#endif // WIN32
+
 } // namespace Misc
 } // namespace IP
\ No newline at end of file
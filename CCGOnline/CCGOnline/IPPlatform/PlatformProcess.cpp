@@ -22,14 +22,22 @@
 #include "PlatformProcess.h"
 
 #include <regex>
-#include "Shlwapi.h"
 #include "StringUtils.h"
 
+#ifdef WIN32
+#include "Shlwapi.h"
+#else
+#include <unistd.h>
+#include "PlatformFileSystem.h"
+#endif // WIN32
+
 namespace IP
 {
 namespace Process
 {
 
+#ifdef WIN32
+
 uint32_t Get_Self_PID( void )
 {
 	return ::GetCurrentProcessId();
@@ -54,6 +62,41 @@ std::wstring Get_Exe_Name( void )
 	return exe_name;
 }
 
+#else
+
+uint32_t Get_Self_PID( void )
+{
+	return static_cast< uint32_t >( getpid() );
+}
+
+
+std::wstring Get_Exe_Name( void )
+{
+	char file_name_buffer[ 1024 ];
+	ssize_t file_name_length = readlink( "/proc/self/exe", file_name_buffer, sizeof( file_name_buffer ) - 1 );
+	if ( file_name_length <= 0 )
+	{
+		return std::wstring();
+	}
+
+	file_name_buffer[ file_name_length ] = 0;
+
+	std::wstring file_name;
+	IP::String::String_To_WideString( file_name_buffer, file_name );
+
+	std::wstring exe_name = IP::File::Strip_Path( file_name );
+
+	size_t extension_index = exe_name.find( L'.' );
+	if ( extension_index != std::wstring::npos )
+	{
+		exe_name.erase( extension_index );
+	}
+
+	return exe_name;
+}
+
+#endif // WIN32
+
 
 std::wstring Get_Service_Name( void )
 {
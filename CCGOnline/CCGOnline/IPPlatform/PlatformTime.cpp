@@ -21,6 +21,7 @@
 
 #include "PlatformTime.h"
 #include "StringUtils.h"
+#include "PlatformFileSystem.h"
 
 #include <sstream>
 #include <iostream>
@@ -29,6 +30,10 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 
+#ifndef WIN32
+#include <time.h>
+#endif // WIN32
+
 /*
 uint64_t CPlatformTime::HighResolutionFrequency = 0;
 bool CPlatformTime::Initialized = false;
@@ -146,6 +151,7 @@ SystemTimePoint Get_Current_System_Time( void )
 
 SystemTimePoint Get_File_Last_Modified_Time( const std::wstring &file_name )
 {
+#ifdef WIN32
 	std::string narrow_file_name;
 	IP::String::WideString_To_String( file_name, narrow_file_name );
 
@@ -161,6 +167,11 @@ SystemTimePoint Get_File_Last_Modified_Time( const std::wstring &file_name )
 	FATAL_ASSERT( result == 0 );
 
 	fclose(fp);
+#else
+	struct stat file_stats;
+	auto result = stat( IP::File::Get_Native_Path( file_name ).c_str(), &file_stats );
+	FATAL_ASSERT( result == 0 );
+#endif // WIN32
 
 	return std::chrono::system_clock::from_time_t(file_stats.st_mtime);
 }
@@ -212,19 +223,53 @@ std::wstring Format_System_Time( SystemTimePoint time_point )
 	return output_string.rdbuf()->str();
 }
 
-SystemDuration Get_Elapsed_System_Time( void )
+#ifdef WIN32
+
+// The counter frequency is fixed at boot, so it only needs to be queried once
+static int64_t Query_Performance_Frequency( void )
+{
+	LARGE_INTEGER frequency;
+	::QueryPerformanceFrequency( &frequency );
+
+	FATAL_ASSERT( frequency.QuadPart != 0 );
+
+	return frequency.QuadPart;
+}
+
+static const int64_t PerformanceFrequency = Query_Performance_Frequency();
+
+CMonotonicClock::time_point CMonotonicClock::now( void )
 {
-	auto now = std::chrono::system_clock::now();
+	LARGE_INTEGER count;
+	::QueryPerformanceCounter( &count );
+
+	// Split the conversion so that ticks * 10^9 cannot overflow
+	int64_t seconds = count.QuadPart / PerformanceFrequency;
+	int64_t remainder = count.QuadPart % PerformanceFrequency;
 
-	return now - SystemTimePoint::min();
+	return time_point( duration( seconds * 1000000000LL + remainder * 1000000000LL / PerformanceFrequency ) );
 }
 
-double Convert_Duration_To_Seconds(SystemDuration duration)
+#else
+
+CMonotonicClock::time_point CMonotonicClock::now( void )
 {
-	// Question: what is the best way of doing this precision-wise?
-	double raw_count = static_cast< double >( duration.count() );
+	struct timespec current_time;
+	::clock_gettime( CLOCK_MONOTONIC, &current_time );
+
+	return time_point( duration( static_cast< int64_t >( current_time.tv_sec ) * 1000000000LL + current_time.tv_nsec ) );
+}
 
-	return raw_count / static_cast< double >( SystemDuration::period::den ) * static_cast< double >( SystemDuration::period::num );
+#endif // WIN32
+
+MonotonicTimePoint Get_Current_Monotonic_Time( void )
+{
+	return CMonotonicClock::now();
+}
+
+MonotonicDuration Get_Elapsed_Monotonic_Time( void )
+{
+	return CMonotonicClock::now().time_since_epoch();
 }
 
 } // namespace Time
@@ -24,16 +24,48 @@ namespace IP
 {
 namespace Time
 {
+	// A clock that never steps backwards or jumps when the wall clock is adjusted.  Scheduling and interval measurement
+	// should use this; system time is for display and logging only.  Both backends read the TSC where the OS has
+	// found it invariant and calibrated it, and neither enters the kernel on the common path.
+	class CMonotonicClock
+	{
+		public:
+
+			using rep = int64_t;
+			using period = std::nano;
+			using duration = std::chrono::nanoseconds;
+			using time_point = std::chrono::time_point< CMonotonicClock >;
+
+			static const bool is_steady = true;
+
+			static time_point now( void );
+	};
+
 	// Types
 	using SystemTimePoint = std::chrono::system_clock::time_point;
 	using SystemDuration = std::chrono::system_clock::duration;
 
+	using MonotonicTimePoint = CMonotonicClock::time_point;
+	using MonotonicDuration = CMonotonicClock::duration;
+
 	// Interface
 	SystemTimePoint Get_Current_System_Time( void );
-	SystemDuration Get_Elapsed_System_Time( void );
 	SystemTimePoint Get_File_Last_Modified_Time( const std::wstring &file_name );
 
-	double Convert_Duration_To_Seconds( SystemDuration duration );
+	MonotonicTimePoint Get_Current_Monotonic_Time( void );
+	MonotonicDuration Get_Elapsed_Monotonic_Time( void );
+
+	template< typename Rep, typename Period >
+	double Convert_Duration_To_Seconds( std::chrono::duration< Rep, Period > duration )
+	{
+		return std::chrono::duration_cast< std::chrono::duration< double > >( duration ).count();
+	}
+
+	template< typename Duration >
+	Duration Convert_Seconds_To_Duration( double seconds )
+	{
+		return std::chrono::duration_cast< Duration >( std::chrono::duration< double >( seconds ) );
+	}
 
 	std::wstring Format_System_Time( SystemTimePoint time_point );
 
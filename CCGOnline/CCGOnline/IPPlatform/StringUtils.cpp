@@ -21,6 +21,9 @@
 
 #include "StringUtils.h"
 
+#include <cctype>
+#include <cwctype>
+
 namespace IP
 {
 namespace String
@@ -29,11 +32,21 @@ namespace String
 void String_To_WideString( const std::string &source, std::wstring &target )
 {
 	size_t buffer_length = source.size() * 2 + 2;
-	size_t buffer_word_length = buffer_length * sizeof( wchar_t ) / sizeof( uint32_t );
 	wchar_t *target_buffer = new wchar_t[ buffer_length ];
 	size_t bytes_written = 0;
 
+#ifdef WIN32
+	size_t buffer_word_length = buffer_length * sizeof( wchar_t ) / sizeof( uint32_t );
 	mbstowcs_s( &bytes_written, target_buffer, buffer_word_length, source.c_str(), source.size() + 1 );
+#else
+	bytes_written = mbstowcs( target_buffer, source.c_str(), buffer_length );
+	if ( bytes_written == static_cast< size_t >( -1 ) )
+	{
+		bytes_written = 0;
+	}
+
+	target_buffer[ std::min( bytes_written, buffer_length - 1 ) ] = 0;
+#endif // WIN32
 	target = std::wstring( target_buffer );
 
 	delete []target_buffer;
@@ -52,7 +65,17 @@ void WideString_To_String( const std::wstring &source, std::string &target )
 	char *target_buffer = new char[ buffer_length ];
 	size_t characters_converted = 0;
 
+#ifdef WIN32
 	wcstombs_s( &characters_converted, target_buffer, buffer_length, source.c_str(), source.size() + 1 );
+#else
+	characters_converted = wcstombs( target_buffer, source.c_str(), buffer_length );
+	if ( characters_converted == static_cast< size_t >( -1 ) )
+	{
+		characters_converted = 0;
+	}
+
+	target_buffer[ std::min( characters_converted, buffer_length - 1 ) ] = 0;
+#endif // WIN32
 	target = std::string( target_buffer );
 
 	delete []target_buffer;
@@ -67,27 +90,15 @@ void WideString_To_String( const wchar_t *source, std::string &target )
 
 void To_Upper_Case( const std::string &source, std::string &dest )
 {
-	size_t buffer_size = source.size() + 1;
-	char *buffer = new char[ buffer_size ];
-	strcpy_s( buffer, buffer_size, source.c_str() );
-	_strupr_s( buffer, buffer_size );
-
-	dest = std::string( buffer );
-
-	delete buffer;
+	dest.resize( source.size() );
+	std::transform( source.cbegin(), source.cend(), dest.begin(), []( char c ){ return static_cast< char >( ::toupper( static_cast< unsigned char >( c ) ) ); } );
 }
 
 
 void To_Upper_Case( const std::wstring &source, std::wstring &dest )
 {
-	size_t buffer_size = source.size() + 1;
-	wchar_t *buffer = new wchar_t[ buffer_size ];
-	wcscpy_s( buffer, buffer_size, source.c_str() );
-	_wcsupr_s( buffer, buffer_size );
-
-	dest = std::wstring( buffer );
-
-	delete buffer;
+	dest.resize( source.size() );
+	std::transform( source.cbegin(), source.cend(), dest.begin(), []( wchar_t c ){ return static_cast< wchar_t >( ::towupper( c ) ); } );
 }
 
 
@@ -166,7 +177,7 @@ bool Convert_Raw( const wchar_t *source, uint32_t &value )
 bool Convert_Raw( const wchar_t *source, int64_t &value ) 
 {
 	wchar_t *end_ptr = nullptr;
-	value = _wcstoi64( source, &end_ptr, 10 );
+	value = wcstoll( source, &end_ptr, 10 );
 	
 	return *end_ptr == 0;
 }
@@ -175,7 +186,7 @@ bool Convert_Raw( const wchar_t *source, int64_t &value )
 bool Convert_Raw( const wchar_t *source, uint64_t &value ) 
 {
 	wchar_t *end_ptr = nullptr;
-	value = _wcstoui64( source, &end_ptr, 10 );
+	value = wcstoull( source, &end_ptr, 10 );
 
 	return *end_ptr == 0;
 }
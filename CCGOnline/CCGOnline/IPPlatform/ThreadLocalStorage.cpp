@@ -21,6 +21,10 @@
 
 #include "ThreadLocalStorage.h"
 
+#ifndef WIN32
+#include <pthread.h>
+#endif // WIN32
+
 #ifdef WIN32
 
 namespace IP
@@ -57,4 +61,45 @@ void Set_Raw_TLS_Value( uint32_t tls_handle, void *handle )
 } // namespace TLS
 } // namespace IP
 
+#else
+
+namespace IP
+{
+namespace TLS
+{
+
+uint32_t Allocate_Thread_Local_Storage( void )
+{
+	pthread_key_t key;
+	if ( pthread_key_create( &key, nullptr ) != 0 )
+	{
+		return THREAD_LOCAL_INVALID_HANDLE;
+	}
+
+	static_assert( sizeof( pthread_key_t ) <= sizeof( uint32_t ), "pthread_key_t does not fit in a TLS handle" );
+
+	return static_cast< uint32_t >( key );
+}
+
+
+void Deallocate_Thread_Local_Storage( uint32_t tls_handle )
+{
+	pthread_key_delete( static_cast< pthread_key_t >( tls_handle ) );
+}		
+
+
+void *Get_Raw_TLS_Value( uint32_t tls_handle )
+{
+	return pthread_getspecific( static_cast< pthread_key_t >( tls_handle ) );
+}
+
+
+void Set_Raw_TLS_Value( uint32_t tls_handle, void *handle )
+{
+	pthread_setspecific( static_cast< pthread_key_t >( tls_handle ), handle );
+}
+
+} // namespace TLS
+} // namespace IP
+
 #endif // WIN32
\ No newline at end of file
@@ -25,7 +25,8 @@
 
 #else
 
-#define THREAD_LOCAL_INVALID_HANDLE ??
+// pthread keys are small indices, so the all-ones value is never handed out
+#define THREAD_LOCAL_INVALID_HANDLE ( ( uint32_t ) 0xFFFFFFFF )
 
 #endif
 
@@ -37,6 +38,9 @@ namespace TLS
 		uint32_t Allocate_Thread_Local_Storage( void );
 		void Deallocate_Thread_Local_Storage( uint32_t tls_handle );
 		
+		void *Get_Raw_TLS_Value( uint32_t tls_handle );
+		void Set_Raw_TLS_Value( uint32_t tls_handle, void *handle );
+
 		template< class T >
 		void Set_TLS_Value( uint32_t tls_handle, T *value )
 		{
@@ -49,9 +53,6 @@ namespace TLS
 			return static_cast< T * >( Get_Raw_TLS_Value( tls_handle ) );
 		}
 
-		void *Get_Raw_TLS_Value( uint32_t tls_handle );
-		void Set_Raw_TLS_Value( uint32_t tls_handle, void *handle );
-
 
 } // namespace TLS
 } // namespace IP
\ No newline at end of file
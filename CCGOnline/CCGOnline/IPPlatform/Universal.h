@@ -32,3 +32,20 @@
 
 #define IP_UNREFERENCED_PARAM( x ) ( &reinterpret_cast< const int& >( x ) )
 
+// The v120 toolset has neither constexpr nor user-defined literals; code that needs them is compiled only for newer compilers
+#if !defined( _MSC_VER ) || _MSC_VER >= 1900
+#define IP_HAS_CONSTEXPR 1
+#endif
+
+// Names for the handful of CRT extensions that have a direct POSIX equivalent
+#ifndef WIN32
+
+#include <strings.h>
+#include <wchar.h>
+
+#define _stricmp strcasecmp
+#define _strnicmp strncasecmp
+#define _wcsicmp wcscasecmp
+
+#endif // WIN32
+
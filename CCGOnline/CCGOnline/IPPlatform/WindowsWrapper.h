@@ -19,6 +19,10 @@
 
 #pragma once
 
+#ifdef WIN32
+
 #define NOMINMAX
 #include <Windows.h>
 
+#endif // WIN32
+
@@ -41,9 +41,6 @@
 #include <type_traits>
 #include <assert.h>
 
-// Loki includes
-#include "loki/include/loki/LokiTypeInfo.h"
-
 // Misc includes
 #pragma warning( push )
 #pragma warning( disable : 4100 )
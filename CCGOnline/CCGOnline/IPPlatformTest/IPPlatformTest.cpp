@@ -19,7 +19,11 @@
 
 #include "stdafx.h"
 
+#ifdef WIN32
 int main(int argc, wchar_t* argv[])
+#else
+int main(int argc, char* argv[])
+#endif // WIN32
 {
 	::testing::InitGoogleTest(&argc, argv);
 	int result_code = RUN_ALL_TESTS();
@@ -28,6 +28,7 @@ static const std::wstring TEST_DIRECTORY( L"DirectoryTest" );
 static const std::wstring TEST_FILE1( L"FileTest1.txt" );
 static const std::wstring TEST_FILE2( L"FileTest2.txt" );
 static const std::wstring TEST_FILE_PATTERN( L"FileTest*.txt" );
+static const std::wstring TEST_MAPPED_FILE( L"MappedFileTest.bin" );
 
 class PlatformFileSystemTests : public testing::Test 
 {
@@ -59,6 +60,7 @@ class PlatformFileSystemTests : public testing::Test
 		{
 			IP::File::Delete_File( TEST_FILE1 );
 			IP::File::Delete_File( TEST_FILE2 );
+			IP::File::Delete_File( TEST_MAPPED_FILE );
 		}
 
 };
@@ -67,8 +69,11 @@ TEST_F( PlatformFileSystemTests, Directory_Ops )
 {
 	ASSERT_FALSE( IP::File::Directory_Exists( std::wstring( L"GarbageDirectory" ) ) );
 	ASSERT_TRUE( IP::File::Directory_Exists( std::wstring( L"Data" ) ) );
+#ifdef WIN32
+	// copied alongside the run directory by the Windows build only
 	ASSERT_TRUE( IP::File::Directory_Exists( std::wstring( L"x86\\External_DLLs" ) ) );
 	ASSERT_TRUE( IP::File::Directory_Exists( std::wstring( L"x64\\External_DLLs" ) ) );
+#endif // WIN32
 
 	ASSERT_FALSE( IP::File::Directory_Exists( TEST_DIRECTORY ) );
 	IP::File::Create_Directory( TEST_DIRECTORY );
@@ -84,11 +89,11 @@ TEST_F( PlatformFileSystemTests, File_Ops )
 
 	ASSERT_TRUE( file_names.size() == 0 );
 
-	std::basic_ofstream< wchar_t > file1( TEST_FILE1.c_str(), std::ios_base::out | std::ios_base::trunc );
+	std::basic_ofstream< wchar_t > file1( IP::File::Get_Native_Path( TEST_FILE1 ).c_str(), std::ios_base::out | std::ios_base::trunc );
 	file1 << L"test1\n";
 	file1.close();
 
-	std::basic_ofstream< wchar_t > file2( TEST_FILE2.c_str(), std::ios_base::out | std::ios_base::trunc );
+	std::basic_ofstream< wchar_t > file2( IP::File::Get_Native_Path( TEST_FILE2 ).c_str(), std::ios_base::out | std::ios_base::trunc );
 	file2 << L"test2\n";
 	file2.close();
 
@@ -118,3 +123,26 @@ TEST_F( PlatformFileSystemTests, Strip_Path )
 	ASSERT_TRUE( IP::File::Strip_Path( path3 ) == test_file_name );
 }
 
+TEST_F( PlatformFileSystemTests, Memory_Mapped_File )
+{
+	IP::File::CMemoryMappedFile mapped_file;
+	ASSERT_FALSE( mapped_file.Open( TEST_MAPPED_FILE ) );
+	ASSERT_FALSE( mapped_file.Is_Open() );
+
+	static const char file_contents[] = "mapped\0contents";
+
+	std::ofstream file( IP::File::Get_Native_Path( TEST_MAPPED_FILE ).c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary );
+	file.write( file_contents, sizeof( file_contents ) );
+	file.close();
+
+	ASSERT_TRUE( mapped_file.Open( TEST_MAPPED_FILE ) );
+	ASSERT_TRUE( mapped_file.Is_Open() );
+	ASSERT_TRUE( mapped_file.Get_Size() == sizeof( file_contents ) );
+	ASSERT_TRUE( memcmp( mapped_file.Get_Data(), file_contents, sizeof( file_contents ) ) == 0 );
+
+	mapped_file.Close();
+	ASSERT_FALSE( mapped_file.Is_Open() );
+	ASSERT_TRUE( mapped_file.Get_Size() == 0 );
+
+	ASSERT_TRUE( IP::File::Delete_File( TEST_MAPPED_FILE ) );
+}
@@ -0,0 +1,65 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+#include "stdafx.h"
+
+#include "IPPlatform/PlatformTime.h"
+
+using namespace IP::Time;
+
+class PlatformTimeTests : public testing::Test 
+{
+	protected:  
+
+	private:
+
+
+};
+
+TEST_F( PlatformTimeTests, Monotonic_Clock_Never_Decreases )
+{
+	MonotonicTimePoint previous_time = Get_Current_Monotonic_Time();
+	for ( uint32_t i = 0; i < 100000; ++i )
+	{
+		MonotonicTimePoint current_time = Get_Current_Monotonic_Time();
+		ASSERT_TRUE( current_time >= previous_time );
+
+		previous_time = current_time;
+	}
+}
+
+TEST_F( PlatformTimeTests, Monotonic_Clock_Advances )
+{
+	MonotonicTimePoint start_time = Get_Current_Monotonic_Time();
+
+	std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+
+	double elapsed_seconds = Convert_Duration_To_Seconds( Get_Current_Monotonic_Time() - start_time );
+	ASSERT_TRUE( elapsed_seconds >= .015 );
+	ASSERT_TRUE( elapsed_seconds < 5.0 );
+}
+
+TEST_F( PlatformTimeTests, Duration_Conversion )
+{
+	ASSERT_DOUBLE_EQ( Convert_Duration_To_Seconds( std::chrono::milliseconds( 1500 ) ), 1.5 );
+	ASSERT_DOUBLE_EQ( Convert_Duration_To_Seconds( MonotonicDuration( 250000000 ) ), .25 );
+
+	ASSERT_TRUE( Convert_Seconds_To_Duration< MonotonicDuration >( 2.5 ) == std::chrono::milliseconds( 2500 ) );
+	ASSERT_TRUE( Convert_Seconds_To_Duration< std::chrono::microseconds >( .1 ) == std::chrono::microseconds( 100000 ) );
+}
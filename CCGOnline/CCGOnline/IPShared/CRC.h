@@ -34,6 +34,86 @@ namespace CRC
 	CRCValue String_To_CRC( const std::wstring &value );
 	CRCValue String_To_CRC_Case_Insensitive( const std::wstring &value );
 
+	// Accumulates a CRC over input that arrives in pieces; the value matches CRC_Memory over the concatenated input
+	class CCRCStream
+	{
+		public:
+
+			CCRCStream( void );
+
+			void Reset( void );
+
+			void Update( const void *memory, size_t length );
+			void Update_Case_Insensitive( const char *value, size_t length );
+			void Update_Case_Insensitive( const wchar_t *value, size_t length );
+
+			CRCValue Get_Value( void ) const;
+
+		private:
+
+			uint32_t Register;
+	};
+
+#ifdef IP_HAS_CONSTEXPR
+
+	// Compile-time equivalents of String_To_CRC and String_To_CRC_Case_Insensitive (narrow strings only).  Written as single
+	// expression recursions so they are valid C++11 constexpr; case folding only covers ASCII, matching the "C" locale.
+	namespace Constexpr
+	{
+		constexpr uint32_t Update_Bits( uint32_t crc, uint32_t bit_count )
+		{
+			return bit_count == 0 ? crc : Update_Bits( ( crc & 0x80000000 ) != 0 ? ( crc << 1 ) ^ 0x04C11DB7 : crc << 1, bit_count - 1 );
+		}
+
+		constexpr uint32_t Update_Byte( uint32_t crc, uint8_t value )
+		{
+			return Update_Bits( crc ^ ( static_cast< uint32_t >( value ) << 24 ), 8 );
+		}
+
+		constexpr char Fold_Case( char value )
+		{
+			return ( value >= 'a' && value <= 'z' ) ? static_cast< char >( value - 'a' + 'A' ) : value;
+		}
+
+		constexpr uint32_t Update( uint32_t crc, const char *value, size_t length )
+		{
+			return length == 0 ? crc : Update( Update_Byte( crc, static_cast< uint8_t >( *value ) ), value + 1, length - 1 );
+		}
+
+		constexpr uint32_t Update_Case_Insensitive( uint32_t crc, const char *value, size_t length )
+		{
+			return length == 0 ? crc : Update_Case_Insensitive( Update_Byte( crc, static_cast< uint8_t >( Fold_Case( *value ) ) ), value + 1, length - 1 );
+		}
+
+	} // namespace Constexpr
+
+	constexpr CRCValue Constexpr_String_To_CRC( const char *value, size_t length )
+	{
+		return ~Constexpr::Update( 0xFFFFFFFF, value, length );
+	}
+
+	constexpr CRCValue Constexpr_String_To_CRC_Case_Insensitive( const char *value, size_t length )
+	{
+		return ~Constexpr::Update_Case_Insensitive( 0xFFFFFFFF, value, length );
+	}
+
+	// "Identifier"_crc and "Identifier"_crci; usable as switch labels and static table keys
+	namespace Literals
+	{
+		constexpr CRCValue operator "" _crc( const char *value, size_t length )
+		{
+			return Constexpr_String_To_CRC( value, length );
+		}
+
+		constexpr CRCValue operator "" _crci( const char *value, size_t length )
+		{
+			return Constexpr_String_To_CRC_Case_Insensitive( value, length );
+		}
+
+	} // namespace Literals
+
+#endif // IP_HAS_CONSTEXPR
+
 } // namespace CRC
 } // namespace IP
 
@@ -37,11 +37,13 @@
 #include "ProcessMessageFrame.h"
 #include "ProcessStatics.h"
 #include "ProcessSubject.h"
+#include "QuiescentStateReclaimer.h"
 #include "IPShared/TaskScheduler/ScheduledTask.h"
 #include "IPShared/TaskScheduler/TaskScheduler.h"
 #include "tbb/include/tbb/task.h"
 #include "tbb/include/tbb/task_scheduler_init.h"
 #include "IPShared/Time/TimeKeeper.h"
+#include <limits>
 
 using namespace IP::Logging;
 using namespace IP::Time;
@@ -83,6 +85,33 @@ class CExecuteProcessScheduledTask : public CScheduledTask
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Runs a process's service function on the calling thread; shared by the TBB tasks below and simulated time mode
+static void Service_Process( IManagedProcess *process, CQuiescentStateReclaimer *reclaimer, const CProcessExecutionContext &context )
+{
+	FATAL_ASSERT( CProcessStatics::Get_Current_Process() == nullptr );
+
+	CProcessStatics::Set_Current_Process( process );
+
+	{
+		// the process may read shared, reloadable data only while it is being serviced
+		CQuiescentStateReadGuard read_guard( reclaimer );
+		process->Run( context );
+	}
+
+	CProcessStatics::Set_Current_Process( nullptr );
+	process->Flush_System_Messages();
+}
+
+
+static void Service_Logging_Process( const CProcessExecutionContext &context )
+{
+	FATAL_ASSERT( CProcessStatics::Get_Current_Process() == nullptr );
+
+	CLogInterface::Service_Logging( context );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 // A TBB task that executes a process's service function
 class CServiceProcessTBBTask : public tbb::task
 {
@@ -90,8 +119,9 @@ class CServiceProcessTBBTask : public tbb::task
 
 		using BASECLASS = tbb::task;
 
-		CServiceProcessTBBTask( const std::shared_ptr< IManagedProcess > &process, double elapsed_seconds ) :
+		CServiceProcessTBBTask( const std::shared_ptr< IManagedProcess > &process, CQuiescentStateReclaimer *reclaimer, double elapsed_seconds ) :
 			Process( process ),
+			Reclaimer( reclaimer ),
 			ElapsedSeconds( elapsed_seconds )
 		{}
 
@@ -101,12 +131,7 @@ class CServiceProcessTBBTask : public tbb::task
 		{
 			CProcessExecutionContext context( this, ElapsedSeconds );
 
-			FATAL_ASSERT( CProcessStatics::Get_Current_Process() == nullptr );
-
-			CProcessStatics::Set_Current_Process( Process.get() );
-			Process->Run( context );
-			CProcessStatics::Set_Current_Process( nullptr );
-			Process->Flush_System_Messages();
+			Service_Process( Process.get(), Reclaimer, context );
 
 			return nullptr;
 		}
@@ -114,6 +139,7 @@ class CServiceProcessTBBTask : public tbb::task
 	private:
 
 		std::shared_ptr< IManagedProcess > Process;
+		CQuiescentStateReclaimer *Reclaimer;
 
 		double ElapsedSeconds;
 };
@@ -137,9 +163,7 @@ class CServiceLoggingProcessTBBTask : public tbb::task
 		{
 			CProcessExecutionContext context( this, ElapsedSeconds );
 
-			FATAL_ASSERT( CProcessStatics::Get_Current_Process() == nullptr );
-
-			CLogInterface::Service_Logging( context );
+			Service_Logging_Process( context );
 
 			return nullptr;
 		}
@@ -289,6 +313,12 @@ enum class EConcurrencyManagerState
 
 
 CConcurrencyManager::CConcurrencyManager( void ) :
+	CConcurrencyManager( EConcurrencyTimeMode::REAL )
+{
+}
+
+
+CConcurrencyManager::CConcurrencyManager( EConcurrencyTimeMode time_mode ) :
 	ProcessRecords(),
 	IDToPropertiesTable(),
 	PropertiesToIDTable(),
@@ -296,10 +326,12 @@ CConcurrencyManager::CConcurrencyManager( void ) :
 	MessageHandlers(),
 	PendingOutboundFrames(),
 	TaskScheduler( std::make_shared< CTaskScheduler >() ),
-	TimeKeeper( new CTimeKeeper ),
-	TBBTaskSchedulerInit( new tbb::task_scheduler_init ),
+	TimeKeeper( time_mode == EConcurrencyTimeMode::SIMULATED ? new CSimulatedTimeKeeper : new CTimeKeeper ),
+	TBBTaskSchedulerInit( time_mode == EConcurrencyTimeMode::SIMULATED ? nullptr : new tbb::task_scheduler_init ),
+	Reclaimer( new CQuiescentStateReclaimer ),
 	State( EConcurrencyManagerState::PRE_INITIALIZE ),
-	NextID( EProcessID::FIRST_FREE_ID )
+	TimeMode( time_mode ),
+	ExecutedProcessCount( 0 )
 {
 }
 
@@ -398,7 +430,7 @@ void CConcurrencyManager::Setup_For_Run( const std::shared_ptr< IManagedProcess
 	Add_Process( starting_process );
 
 	// Reset time
-	TimeKeeper->Set_Base_Time( Get_Current_System_Time() );
+	TimeKeeper->Set_Base_Time( Get_Current_Monotonic_Time() );
 
 	State = EConcurrencyManagerState::RUNNING;
 }
@@ -415,6 +447,7 @@ void CConcurrencyManager::Add_Process( const std::shared_ptr< IManagedProcess >
 	FATAL_ASSERT( id != EProcessID::CONCURRENCY_MANAGER );
 	FATAL_ASSERT( ProcessRecords.find( id ) == ProcessRecords.cend() );
 	FATAL_ASSERT( process->Get_Properties().Is_Valid() );
+	FATAL_ASSERT( !Is_Time_Simulated() || process->Get_Execution_Mode() == EProcessExecutionMode::TBB_TASK );
 
 	process->Initialize( id );
 	if ( id != EProcessID::LOGGING )
@@ -529,19 +562,48 @@ void CConcurrencyManager::Service( void )
 	{
 		Service_One_Iteration();
 
-		std::this_thread::sleep_for( std::chrono::milliseconds( 0 ) );	// make this adjustable later depending on the service's needs
+		if ( !Is_Time_Simulated() )
+		{
+			std::this_thread::sleep_for( std::chrono::milliseconds( 0 ) );	// make this adjustable later depending on the service's needs
+		}
 	}
 }
 
 
 void CConcurrencyManager::Service_One_Iteration( void )
 {
-	Service_Incoming_Frames();
+	// One clock read per iteration; scheduling below all works off the cached value
+	TimeKeeper->Refresh();
+
+	ExecutedProcessCount = 0;
+
+	uint32_t handled_frame_count = Service_Incoming_Frames();
 	Flush_Frames();
 
 	TaskScheduler->Service( TimeKeeper->Get_Elapsed_Seconds() );	
 
+	Reclaimer->Reclaim();
+
 	Service_Shutdown();
+
+	// Processes only run inline in simulated mode, so an iteration that neither handled a frame nor ran a process
+	// cannot have produced any new work at this instant
+	if ( Is_Time_Simulated() && handled_frame_count == 0 && ExecutedProcessCount == 0 )
+	{
+		Advance_Simulated_Time();
+	}
+}
+
+
+void CConcurrencyManager::Advance_Simulated_Time( void )
+{
+	double next_task_time = TaskScheduler->Get_Next_Task_Time();
+	if ( next_task_time == std::numeric_limits< double >::max() )
+	{
+		return;
+	}
+
+	static_cast< CSimulatedTimeKeeper * >( TimeKeeper.get() )->Advance_To( next_task_time );
 }
 
 
@@ -567,7 +629,7 @@ void CConcurrencyManager::Service_Shutdown( void )
 }
 
 
-void CConcurrencyManager::Service_Incoming_Frames( void )
+uint32_t CConcurrencyManager::Service_Incoming_Frames( void )
 {
 	std::vector< std::unique_ptr< CProcessMessageFrame > > control_frames;
 	Get_My_Mailbox()->Remove_Frames( control_frames );
@@ -584,6 +646,8 @@ void CConcurrencyManager::Service_Incoming_Frames( void )
 			Handle_Message( source_process_id, *iter );
 		}
 	}
+
+	return static_cast< uint32_t >( control_frames.size() );
 }
 
 
@@ -722,7 +786,10 @@ void CConcurrencyManager::Handle_Reschedule_Process_Message( EProcessID source_p
 		return;
 	}
 
-	double execute_time = std::min( message->Get_Reschedule_Time(), TimeKeeper->Get_Elapsed_Seconds() );
+	// Real time services the process again on the next pass.  Simulated time must honor the requested time instead, or
+	// there would always be work due at the current instant and the clock could never advance.
+	double current_time = TimeKeeper->Get_Elapsed_Seconds();
+	double execute_time = Is_Time_Simulated() ? std::max( message->Get_Reschedule_Time(), current_time ) : std::min( message->Get_Reschedule_Time(), current_time );
 	record->Add_Execute_Task( TaskScheduler, execute_time );
 }
 
@@ -806,17 +873,31 @@ void CConcurrencyManager::Execute_Process( EProcessID process_id, double current
 
 	std::shared_ptr< IManagedProcess > thread_task_base = record->Get_Process();
 
+	++ExecutedProcessCount;
+
 	switch ( thread_task_base->Get_Execution_Mode() )
 	{
 		case EProcessExecutionMode::TBB_TASK:
-			if ( process_id == EProcessID::LOGGING )
+			if ( Is_Time_Simulated() )
+			{
+				CProcessExecutionContext context( current_time_seconds );
+				if ( process_id == EProcessID::LOGGING )
+				{
+					Service_Logging_Process( context );
+				}
+				else
+				{
+					Service_Process( thread_task_base.get(), Reclaimer.get(), context );
+				}
+			}
+			else if ( process_id == EProcessID::LOGGING )
 			{
 				CServiceLoggingProcessTBBTask &tbb_task = *new( tbb::task::allocate_root() ) CServiceLoggingProcessTBBTask( current_time_seconds );
 				tbb::task::enqueue( tbb_task );
 			}
 			else
 			{
-				CServiceProcessTBBTask &tbb_task = *new( tbb::task::allocate_root() ) CServiceProcessTBBTask( thread_task_base, current_time_seconds );
+				CServiceProcessTBBTask &tbb_task = *new( tbb::task::allocate_root() ) CServiceProcessTBBTask( thread_task_base, Reclaimer.get(), current_time_seconds );
 				tbb::task::enqueue( tbb_task );
 			}
 
@@ -824,7 +905,8 @@ void CConcurrencyManager::Execute_Process( EProcessID process_id, double current
 
 		case EProcessExecutionMode::THREAD:
 		{
-			CProcessExecutionContext context;
+			// only starts the thread; it opens its own read section around each of its service passes
+			CProcessExecutionContext context( Reclaimer.get() );
 			thread_task_base->Run( context );
 
 			break;
@@ -913,10 +995,7 @@ void CConcurrencyManager::Log( std::wstring &&message )
 
 EProcessID CConcurrencyManager::Allocate_Process_ID( void )
 {
-	EProcessID id = NextID;
-	NextID = static_cast< EProcessID >( static_cast< uint64_t >( NextID ) + 1 );
-
-	return id;
+	return ProcessRecords.Allocate_ID();
 }
 
 } // namespace Execution
@@ -20,6 +20,7 @@
 #pragma once
 
 #include "ProcessProperties.h"
+#include "ProcessSlotTable.h"
 
 namespace tbb
 {
@@ -62,9 +63,18 @@ class CWriteOnlyMailbox;
 class CProcessMessageFrame;
 class CTaskScheduler;
 class CProcessRecord;
+class CQuiescentStateReclaimer;
 
 enum class EConcurrencyManagerState;
-enum class EProcessID;
+
+// How the manager's clock advances.  In SIMULATED mode every process runs on the manager's own thread, one at a time in
+// schedule order, and whenever nothing is left to do at the current instant time jumps straight to the next scheduled
+// execution.  Runs are reproducible and hours of virtual time pass in seconds; thread processes are not supported.
+enum class EConcurrencyTimeMode
+{
+	REAL,
+	SIMULATED
+};
 
 // the central, manager class that manages all thread tasks
 class CConcurrencyManager
@@ -73,6 +83,7 @@ class CConcurrencyManager
 
 		// Construction/Destruction
 		CConcurrencyManager( void );
+		CConcurrencyManager( EConcurrencyTimeMode time_mode );
 		~CConcurrencyManager();
 
 		// Public interface
@@ -84,9 +95,12 @@ class CConcurrencyManager
 
 		void Register_Handler( const std::type_info &message_type_info, std::unique_ptr< Messaging::IProcessMessageHandler > &handler );
 
+		// Defers destruction of shared data replaced while processes may be reading it; see CXMLReloadableTable
+		CQuiescentStateReclaimer *Get_Reclaimer( void ) const { return Reclaimer.get(); }
+
 	private:
 
-		friend class CConcurrencyManagerTester;
+		friend class ::CConcurrencyManagerTester;
 
 		// Accessors
 		std::shared_ptr< CProcessRecord > Get_Record( EProcessID process_id ) const;
@@ -116,7 +130,7 @@ class CConcurrencyManager
 		void Service( void );
 		void Service_One_Iteration( void );
 		void Service_Shutdown( void );
-		void Service_Incoming_Frames( void );
+		uint32_t Service_Incoming_Frames( void );
 
 		void Setup_For_Run( const std::shared_ptr< IManagedProcess > &starting_process );
 		void Shutdown( void );
@@ -124,6 +138,9 @@ class CConcurrencyManager
 		// Execution helpers
 		void Execute_Process( EProcessID process_id, double current_time_seconds );
 
+		bool Is_Time_Simulated( void ) const { return TimeMode == EConcurrencyTimeMode::SIMULATED; }
+		void Advance_Simulated_Time( void );
+
 		void Add_Process( const std::shared_ptr< IManagedProcess > &process );
 		void Add_Process( const std::shared_ptr< IManagedProcess > &process, EProcessID id );
 
@@ -146,9 +163,9 @@ class CConcurrencyManager
 
 		using FrameTableType = std::unordered_map< EProcessID, std::unique_ptr< CProcessMessageFrame > >;
 		using ProcessMessageHandlerTableType = std::unordered_map< Loki::TypeInfo, std::unique_ptr< Messaging::IProcessMessageHandler >, STypeInfoContainerHelper >;
-		using ProcessRecordTableType = std::unordered_map< EProcessID, std::shared_ptr< CProcessRecord > >;
+		using ProcessRecordTableType = TProcessSlotTable< std::shared_ptr< CProcessRecord > >;
 
-		using IDToProcessPropertiesTableType = std::unordered_map< EProcessID, SProcessProperties >;
+		using IDToProcessPropertiesTableType = TProcessSlotTable< SProcessProperties >;
 		using ProcessPropertiesToIDTableType = std::unordered_multimap< SProcessProperties, EProcessID, SProcessPropertiesContainerHelper >;
 
 		// Private Data
@@ -167,9 +184,12 @@ class CConcurrencyManager
 
 		std::unique_ptr< tbb::task_scheduler_init > TBBTaskSchedulerInit;
 
+		std::unique_ptr< CQuiescentStateReclaimer > Reclaimer;
+
 		EConcurrencyManagerState State;
 
-		EProcessID NextID;
+		EConcurrencyTimeMode TimeMode;
+		uint32_t ExecutedProcessCount;
 };
 
 } // namespace Execution
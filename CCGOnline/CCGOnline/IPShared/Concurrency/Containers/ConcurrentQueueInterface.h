@@ -34,6 +34,7 @@ class IConcurrentQueue
 
 		virtual void Move_Item( T &&item ) = 0;
 
+		// Appends every queued item to items
 		virtual void Remove_Items( std::vector< T > &items ) = 0;
 
 };
@@ -55,8 +55,6 @@ class CTBBConcurrentQueue : public IConcurrentQueue< T >
 
 		virtual void Remove_Items( std::vector< T > &items ) override
 		{
-			items.clear();
-
 			T item;
 			while ( Queue.try_pop( item ) )
 			{
@@ -0,0 +1,261 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "CoroutineProcessBase.h"
+
+#if defined( __cpp_impl_coroutine )
+
+#include <cstddef>
+
+namespace IP
+{
+namespace Execution
+{
+
+// Frames are rounded up to a multiple of this, and each multiple gets its own free list
+static const size_t FRAME_SIZE_GRANULARITY = 64;
+
+// Frames bigger than this bypass the free lists
+static const size_t MAX_POOLED_FRAME_SIZE = 4096;
+
+// Each frame is preceded by a pointer to the pool that owns it, padded to keep the frame itself fully aligned
+static const size_t FRAME_HEADER_SIZE = alignof( std::max_align_t );
+
+
+CCoroutineFramePool::CCoroutineFramePool( void ) :
+	FreeLists(),
+	OutstandingCount( 0 ),
+	AllocatedCount( 0 )
+{
+}
+
+
+CCoroutineFramePool::~CCoroutineFramePool()
+{
+	FATAL_ASSERT( OutstandingCount == 0 );
+
+	for ( auto list_iter = FreeLists.begin(), list_end = FreeLists.end(); list_iter != list_end; ++list_iter )
+	{
+		for ( auto iter = list_iter->cbegin(), end = list_iter->cend(); iter != end; ++iter )
+		{
+			::operator delete( *iter );
+		}
+	}
+}
+
+
+void *CCoroutineFramePool::Allocate( size_t size )
+{
+	++OutstandingCount;
+
+	size_t size_class = ( size + FRAME_SIZE_GRANULARITY - 1 ) / FRAME_SIZE_GRANULARITY;
+	size_t block_size = size_class * FRAME_SIZE_GRANULARITY;
+	if ( block_size > MAX_POOLED_FRAME_SIZE )
+	{
+		++AllocatedCount;
+		return ::operator new( size );
+	}
+
+	if ( size_class >= FreeLists.size() )
+	{
+		FreeLists.resize( size_class + 1 );
+	}
+
+	std::vector< void * > &free_list = FreeLists[ size_class ];
+	if ( free_list.empty() )
+	{
+		++AllocatedCount;
+		return ::operator new( block_size );
+	}
+
+	void *block = free_list.back();
+	free_list.pop_back();
+
+	return block;
+}
+
+
+void CCoroutineFramePool::Release( void *block, size_t size )
+{
+	FATAL_ASSERT( OutstandingCount > 0 );
+	--OutstandingCount;
+
+	size_t size_class = ( size + FRAME_SIZE_GRANULARITY - 1 ) / FRAME_SIZE_GRANULARITY;
+	if ( size_class * FRAME_SIZE_GRANULARITY > MAX_POOLED_FRAME_SIZE )
+	{
+		::operator delete( block );
+		return;
+	}
+
+	FreeLists[ size_class ].push_back( block );
+}
+
+
+CProcessCoroutine::promise_type::~promise_type()
+{
+	Process->Coroutines.erase( std::coroutine_handle< promise_type >::from_promise( *this ).address() );
+}
+
+
+void *CProcessCoroutine::promise_type::Allocate_Frame( size_t size, CCoroutineProcessBase &process )
+{
+	void *block = process.FramePool.Allocate( size + FRAME_HEADER_SIZE );
+	*static_cast< CCoroutineFramePool ** >( block ) = &process.FramePool;
+
+	return static_cast< uint8_t * >( block ) + FRAME_HEADER_SIZE;
+}
+
+
+void CProcessCoroutine::promise_type::operator delete( void *frame, size_t size )
+{
+	void *block = static_cast< uint8_t * >( frame ) - FRAME_HEADER_SIZE;
+	CCoroutineFramePool *pool = *static_cast< CCoroutineFramePool ** >( block );
+
+	pool->Release( block, size + FRAME_HEADER_SIZE );
+}
+
+
+CProcessCoroutine CProcessCoroutine::promise_type::get_return_object( void )
+{
+	Process->Coroutines.insert( std::coroutine_handle< promise_type >::from_promise( *this ).address() );
+
+	return CProcessCoroutine();
+}
+
+
+void CProcessCoroutine::promise_type::unhandled_exception( void )
+{
+	// process logic does not throw
+	FATAL_ASSERT( false );
+}
+
+
+CCoroutineProcessBase::CCoroutineProcessBase( const SProcessProperties &properties ) :
+	BASECLASS( properties ),
+	FramePool(),
+	Coroutines(),
+	AwaitableMessages(),
+	HasStartedBody( false )
+{
+}
+
+
+CCoroutineProcessBase::~CCoroutineProcessBase()
+{
+	Destroy_Coroutines();
+}
+
+
+void CCoroutineProcessBase::Per_Frame_Logic_Start( void )
+{
+	BASECLASS::Per_Frame_Logic_Start();
+
+	if ( !HasStartedBody )
+	{
+		HasStartedBody = true;
+		Run_Process_Body();
+	}
+}
+
+
+CCoroutineProcessBase::CTimerAwaiter CCoroutineProcessBase::Wait_For_Seconds( double seconds )
+{
+	return CTimerAwaiter( Get_Task_Scheduler(), Get_Current_Process_Time() + seconds, Get_Current_Process_Time() );
+}
+
+
+CCoroutineProcessBase::CTimerAwaiter CCoroutineProcessBase::Wait_Until( double process_time_seconds )
+{
+	return CTimerAwaiter( Get_Task_Scheduler(), process_time_seconds, Get_Current_Process_Time() );
+}
+
+
+void CCoroutineProcessBase::Deliver_Awaitable_Message( const std::type_info &message_type, std::unique_ptr< const Messaging::IProcessMessage > &message )
+{
+	SAwaitableMessageQueue &queue = AwaitableMessages[ Loki::TypeInfo( message_type ) ];
+
+	// oldest waiter that will take it
+	for ( auto iter = queue.Waiters.begin(), end = queue.Waiters.end(); iter != end; ++iter )
+	{
+		SMessageWaiter *waiter = *iter;
+		if ( waiter->Filter == nullptr || waiter->Filter( *message ) )
+		{
+			queue.Waiters.erase( iter );
+
+			waiter->Message = std::move( message );
+			waiter->Handle.resume();
+			return;
+		}
+	}
+
+	queue.PendingMessages.push_back( std::move( message ) );
+}
+
+
+bool CCoroutineProcessBase::Take_Pending_Message( const std::type_info &message_type, SMessageWaiter &waiter )
+{
+	auto queue_iter = AwaitableMessages.find( Loki::TypeInfo( message_type ) );
+	if ( queue_iter == AwaitableMessages.end() )
+	{
+		return false;
+	}
+
+	std::deque< std::unique_ptr< const Messaging::IProcessMessage > > &pending_messages = queue_iter->second.PendingMessages;
+	for ( auto iter = pending_messages.begin(), end = pending_messages.end(); iter != end; ++iter )
+	{
+		if ( waiter.Filter == nullptr || waiter.Filter( **iter ) )
+		{
+			waiter.Message = std::move( *iter );
+			pending_messages.erase( iter );
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+void CCoroutineProcessBase::Add_Message_Waiter( const std::type_info &message_type, SMessageWaiter &waiter )
+{
+	AwaitableMessages[ Loki::TypeInfo( message_type ) ].Waiters.push_back( &waiter );
+}
+
+
+void CCoroutineProcessBase::Destroy_Coroutines( void )
+{
+	// nothing may resume a coroutine once its frame is gone
+	AwaitableMessages.clear();
+
+	// destroying a frame removes it from the live set, so work from a copy
+	std::vector< void * > coroutines( Coroutines.cbegin(), Coroutines.cend() );
+	for ( auto iter = coroutines.cbegin(), end = coroutines.cend(); iter != end; ++iter )
+	{
+		std::coroutine_handle<>::from_address( *iter ).destroy();
+	}
+
+	FATAL_ASSERT( Coroutines.empty() );
+}
+
+} // namespace Execution
+} // namespace IP
+
+#endif // __cpp_impl_coroutine
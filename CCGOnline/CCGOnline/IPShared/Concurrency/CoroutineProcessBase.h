@@ -0,0 +1,334 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+// Coroutine process bodies need C++20; on older compilers this header, and the matching source file, compile to nothing
+#if defined( __cpp_impl_coroutine )
+
+#include <coroutine>
+#include <deque>
+
+#include "TaskProcessBase.h"
+#include "Messaging/ProcessRequestMessages.h"
+#include "IPShared/MessageHandling/ProcessMessageHandler.h"
+#include "IPShared/TaskScheduler/ScheduledTask.h"
+#include "IPShared/TaskScheduler/TaskScheduler.h"
+
+namespace IP
+{
+namespace Execution
+{
+
+class CCoroutineProcessBase;
+
+// Recycles coroutine frames for a single process.  Frames are bucketed by size class and released blocks are kept on
+// per-class free lists for the life of the pool, so a process that keeps starting the same coroutines stops allocating.
+class CCoroutineFramePool
+{
+	public:
+
+		CCoroutineFramePool( void );
+		~CCoroutineFramePool();
+
+		void *Allocate( size_t size );
+		void Release( void *block, size_t size );
+
+		size_t Get_Outstanding_Count( void ) const { return OutstandingCount; }
+		size_t Get_Allocated_Count( void ) const { return AllocatedCount; }
+
+	private:
+
+		std::vector< std::vector< void * > > FreeLists;
+
+		size_t OutstandingCount;
+		size_t AllocatedCount;
+};
+
+// The return type of every coroutine run by a CCoroutineProcessBase.  Coroutines start immediately, run until their
+// first suspension and are resumed only from inside their process's Run, by message delivery or the task scheduler.
+// A coroutine must be a member of a CCoroutineProcessBase subclass (or take one as its first parameter): its frame
+// comes from that process's pool, and the process destroys any coroutine still suspended when it goes away.
+class CProcessCoroutine
+{
+	public:
+
+		struct promise_type
+		{
+			public:
+
+				// the process is deduced rather than taken as a CCoroutineProcessBase & because compilers differ on whether
+				// the implicit object argument of a member coroutine may convert to a base class here
+				template< typename ProcessType, typename... Args >
+				promise_type( ProcessType &process, Args &&... ) :
+					Process( &process )
+				{}
+
+				~promise_type();
+
+				// frames come from the pool of the process the coroutine belongs to
+				template< typename ProcessType, typename... Args >
+				static void *operator new( size_t size, ProcessType &process, Args &&... )
+				{
+					return Allocate_Frame( size, process );
+				}
+
+				static void operator delete( void *frame, size_t size );
+
+				CProcessCoroutine get_return_object( void );
+
+				std::suspend_never initial_suspend( void ) noexcept { return std::suspend_never(); }
+				std::suspend_never final_suspend( void ) noexcept { return std::suspend_never(); }
+
+				void return_void( void ) {}
+				void unhandled_exception( void );
+
+			private:
+
+				static void *Allocate_Frame( size_t size, CCoroutineProcessBase &process );
+
+				CCoroutineProcessBase *Process;
+		};
+};
+
+// A task process whose logic can be written as coroutines that co_await messages, timers and request responses
+class CCoroutineProcessBase : public CTaskProcessBase
+{
+	private:
+
+		// One suspended Wait_For_Message; lives in the waiting coroutine's frame
+		struct SMessageWaiter
+		{
+			std::function< bool( const Messaging::IProcessMessage & ) > Filter;
+			std::unique_ptr< const Messaging::IProcessMessage > Message;
+			std::coroutine_handle<> Handle;
+		};
+
+	public:
+
+		using BASECLASS = CTaskProcessBase;
+
+		CCoroutineProcessBase( const SProcessProperties &properties );
+		virtual ~CCoroutineProcessBase();
+
+		const CCoroutineFramePool &Get_Frame_Pool( void ) const { return FramePool; }
+		size_t Get_Live_Coroutine_Count( void ) const { return Coroutines.size(); }
+
+	protected:
+
+		template< typename MessageType >
+		class TMessageAwaiter
+		{
+			public:
+
+				TMessageAwaiter( CCoroutineProcessBase *process, const std::function< bool( const MessageType & ) > &filter ) :
+					Process( process ),
+					Waiter()
+				{
+					if ( filter != nullptr )
+					{
+						Waiter.Filter = [ filter ]( const Messaging::IProcessMessage &message ) { return filter( static_cast< const MessageType & >( message ) ); };
+					}
+				}
+
+				bool await_ready( void ) { return Process->Take_Pending_Message( typeid( MessageType ), Waiter ); }
+
+				void await_suspend( std::coroutine_handle<> handle )
+				{
+					Waiter.Handle = handle;
+					Process->Add_Message_Waiter( typeid( MessageType ), Waiter );
+				}
+
+				std::unique_ptr< const MessageType > await_resume( void )
+				{
+					return std::unique_ptr< const MessageType >( static_cast< const MessageType * >( Waiter.Message.release() ) );
+				}
+
+			private:
+
+				CCoroutineProcessBase *Process;
+
+				SMessageWaiter Waiter;
+		};
+
+		class CTimerAwaiter : public CScheduledTask
+		{
+			public:
+
+				using BASECLASS = CScheduledTask;
+
+				CTimerAwaiter( CTaskScheduler *scheduler, double execute_time_seconds, double current_time_seconds ) :
+					BASECLASS( execute_time_seconds ),
+					Scheduler( scheduler ),
+					CurrentTimeSeconds( current_time_seconds ),
+					Handle()
+				{}
+
+				// a frame destroyed while parked on the timer must not leave the scheduler holding a reference into it
+				virtual ~CTimerAwaiter()
+				{
+					if ( Is_Scheduled() )
+					{
+						Scheduler->Remove_Task( std::shared_ptr< CScheduledTask >( std::shared_ptr< CScheduledTask >(), this ) );
+					}
+				}
+
+				bool await_ready( void ) const { return Get_Execute_Time() <= CurrentTimeSeconds; }
+
+				void await_suspend( std::coroutine_handle<> handle )
+				{
+					Handle = handle;
+
+					// the awaiter lives in the suspended frame, so the scheduler gets a non-owning reference rather than an allocation
+					Scheduler->Submit_Task( std::shared_ptr< CScheduledTask >( std::shared_ptr< CScheduledTask >(), this ) );
+				}
+
+				void await_resume( void ) {}
+
+				virtual bool Execute( double /*current_time_seconds*/, double & /*reschedule_time_seconds*/ ) override
+				{
+					Handle.resume();
+
+					return false;
+				}
+
+			private:
+
+				CTaskScheduler *Scheduler;
+
+				double CurrentTimeSeconds;
+
+				std::coroutine_handle<> Handle;
+		};
+
+		template< typename ResponseType >
+		class TResponseAwaiter
+		{
+			public:
+
+				TResponseAwaiter( CCoroutineProcessBase *process, EProcessID dest_process_id, std::unique_ptr< Messaging::IProcessRequest > &&request, double timeout_seconds ) :
+					Process( process ),
+					DestProcessID( dest_process_id ),
+					Request( std::move( request ) ),
+					TimeoutSeconds( timeout_seconds ),
+					Response()
+				{}
+
+				bool await_ready( void ) const { return false; }
+
+				void await_suspend( std::coroutine_handle<> handle )
+				{
+					Process->Send_Process_Request( DestProcessID, std::move( Request ), TimeoutSeconds,
+						[ this, handle ]( std::unique_ptr< const Messaging::IProcessMessage > &response )
+						{
+							FATAL_ASSERT( response == nullptr || typeid( *response ) == typeid( ResponseType ) );
+
+							Response.reset( static_cast< const ResponseType * >( response.release() ) );
+							handle.resume();
+						} );
+				}
+
+				std::unique_ptr< const ResponseType > await_resume( void ) { return std::move( Response ); }
+
+			private:
+
+				CCoroutineProcessBase *Process;
+
+				EProcessID DestProcessID;
+				std::unique_ptr< Messaging::IProcessRequest > Request;
+				double TimeoutSeconds;
+
+				std::unique_ptr< const ResponseType > Response;
+		};
+
+		// The process body, started on the process's first run
+		virtual CProcessCoroutine Run_Process_Body( void ) = 0;
+
+		// Derived overrides must call the baseclass
+		virtual void Per_Frame_Logic_Start( void ) override;
+
+		// Routes a message type to coroutines awaiting it instead of to a handler; call from Register_Message_Handlers.
+		// Messages that arrive with no matching waiter are held until a coroutine asks for them.
+		template< typename MessageType >
+		void Register_Awaitable_Message( void )
+		{
+			Messaging::Register_This_Handler< MessageType, CCoroutineProcessBase >( this, &CCoroutineProcessBase::Handle_Awaitable_Message< MessageType > );
+		}
+
+		// co_await Wait_For_Message< T >() resumes with a std::unique_ptr< const T >; the optional filter picks which
+		// message of that type will do, for example the database task response for one particular task
+		template< typename MessageType >
+		TMessageAwaiter< MessageType > Wait_For_Message( void ) { return TMessageAwaiter< MessageType >( this, nullptr ); }
+
+		template< typename MessageType >
+		TMessageAwaiter< MessageType > Wait_For_Message( const std::function< bool( const MessageType & ) > &filter ) { return TMessageAwaiter< MessageType >( this, filter ); }
+
+		// co_await Wait_For_Seconds( s ) resumes once s seconds of process time have passed
+		CTimerAwaiter Wait_For_Seconds( double seconds );
+		CTimerAwaiter Wait_Until( double process_time_seconds );
+
+		// co_await Wait_For_Response< T >( ... ) sends a correlated request and resumes with its response, or with nullptr
+		// if it times out
+		template< typename ResponseType >
+		TResponseAwaiter< ResponseType > Wait_For_Response( EProcessID dest_process_id, std::unique_ptr< Messaging::IProcessRequest > &&request, double timeout_seconds )
+		{
+			return TResponseAwaiter< ResponseType >( this, dest_process_id, std::move( request ), timeout_seconds );
+		}
+
+	private:
+
+		friend struct CProcessCoroutine::promise_type;
+
+		struct SAwaitableMessageQueue
+		{
+			std::deque< SMessageWaiter * > Waiters;
+			std::deque< std::unique_ptr< const Messaging::IProcessMessage > > PendingMessages;
+		};
+
+		template< typename MessageType >
+		void Handle_Awaitable_Message( EProcessID /*source_process_id*/, std::unique_ptr< const MessageType > &message )
+		{
+			std::unique_ptr< const Messaging::IProcessMessage > base_message( message.release() );
+			Deliver_Awaitable_Message( typeid( MessageType ), base_message );
+		}
+
+		void Deliver_Awaitable_Message( const std::type_info &message_type, std::unique_ptr< const Messaging::IProcessMessage > &message );
+		bool Take_Pending_Message( const std::type_info &message_type, SMessageWaiter &waiter );
+		void Add_Message_Waiter( const std::type_info &message_type, SMessageWaiter &waiter );
+
+		void Destroy_Coroutines( void );
+
+		using AwaitableMessageTableType = std::unordered_map< Loki::TypeInfo, SAwaitableMessageQueue, STypeInfoContainerHelper >;
+
+		// Declared first so it outlives every frame it handed out
+		CCoroutineFramePool FramePool;
+
+		// Every coroutine started by this process that has not finished
+		std::set< void * > Coroutines;
+
+		AwaitableMessageTableType AwaitableMessages;
+
+		bool HasStartedBody;
+};
+
+} // namespace Execution
+} // namespace IP
+
+#endif // __cpp_impl_coroutine
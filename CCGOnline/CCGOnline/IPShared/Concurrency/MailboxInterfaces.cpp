@@ -31,12 +31,15 @@ namespace Execution
 
 CWriteOnlyMailbox::CWriteOnlyMailbox( EProcessID process_id, 
 												  const SProcessProperties &properties, 
-												  const std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > &write_queue ) :
+												  const std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > &write_queue,
+												  const std::shared_ptr< std::atomic< size_t > > &backlog ) :
 	ProcessID( process_id ),
 	Properties( properties ),
-	WriteQueue( write_queue )
+	WriteQueue( write_queue ),
+	Backlog( backlog )
 {
 	FATAL_ASSERT( WriteQueue.get() != nullptr );
+	FATAL_ASSERT( Backlog.get() != nullptr );
 }
 
 
@@ -49,16 +52,21 @@ void CWriteOnlyMailbox::Add_Frame( std::unique_ptr< CProcessMessageFrame > &fram
 {
 	FATAL_ASSERT( frame.get() != nullptr );
 
+	// count before queueing so the reader can never subtract messages that have not been counted yet
+	Backlog->fetch_add( frame->Get_Message_Count(), std::memory_order_relaxed );
 	WriteQueue->Move_Item( std::move( frame ) );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-CReadOnlyMailbox::CReadOnlyMailbox( const std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > &read_queue ) :
-	ReadQueue( read_queue )
+CReadOnlyMailbox::CReadOnlyMailbox( const std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > &read_queue, 
+												const std::shared_ptr< std::atomic< size_t > > &backlog ) :
+	ReadQueue( read_queue ),
+	Backlog( backlog )
 {
 	FATAL_ASSERT( ReadQueue.get() != nullptr );
+	FATAL_ASSERT( Backlog.get() != nullptr );
 }
 
 
@@ -69,7 +77,17 @@ CReadOnlyMailbox::~CReadOnlyMailbox()
 
 void CReadOnlyMailbox::Remove_Frames( std::vector< std::unique_ptr< CProcessMessageFrame > > &frames )
 {
+	size_t previous_count = frames.size();
+
 	ReadQueue->Remove_Items( frames );
+
+	size_t removed_messages = 0;
+	for ( size_t i = previous_count, size = frames.size(); i < size; ++i )
+	{
+		removed_messages += frames[ i ]->Get_Message_Count();
+	}
+
+	Backlog->fetch_sub( removed_messages, std::memory_order_relaxed );
 }
 
 } // namespace Execution
@@ -35,14 +35,14 @@ namespace Execution
 
 class CProcessMessageFrame;
 
-enum class EProcessID;
+enum class EProcessID : uint64_t;
 
 // The write-only mailbox of a virtual process.  Other processes talk to a process by adding messages to this
 class CWriteOnlyMailbox
 {
 	public:
 
-		CWriteOnlyMailbox( EProcessID process_id, const SProcessProperties &properties, const std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > &write_queue );
+		CWriteOnlyMailbox( EProcessID process_id, const SProcessProperties &properties, const std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > &write_queue, const std::shared_ptr< std::atomic< size_t > > &backlog );
 		~CWriteOnlyMailbox();
 
 		CWriteOnlyMailbox( CWriteOnlyMailbox &&rhs ) = delete;
@@ -53,6 +53,9 @@ class CWriteOnlyMailbox
 		EProcessID Get_Process_ID( void ) const { return ProcessID; }
 		const SProcessProperties &Get_Properties( void ) const { return Properties; }
 
+		// The number of messages added to the mailbox that the owning process has not yet removed; approximate by nature
+		size_t Get_Backlog( void ) const { return Backlog->load( std::memory_order_relaxed ); }
+
 		void Add_Frame( std::unique_ptr< CProcessMessageFrame > &frame );
 
 	private:
@@ -63,6 +66,8 @@ class CWriteOnlyMailbox
 
 		std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > WriteQueue;
 
+		std::shared_ptr< std::atomic< size_t > > Backlog;
+
 };
 
 // The read-only mailbox to a virtual process.  A process handles messages by reading from this
@@ -70,7 +75,7 @@ class CReadOnlyMailbox
 {
 	public:
 
-		CReadOnlyMailbox( const std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > &read_queue );
+		CReadOnlyMailbox( const std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > &read_queue, const std::shared_ptr< std::atomic< size_t > > &backlog );
 		~CReadOnlyMailbox();
 
 		CReadOnlyMailbox( CReadOnlyMailbox &&rhs ) = delete;
@@ -84,6 +89,8 @@ class CReadOnlyMailbox
 
 		std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > ReadQueue;
 
+		std::shared_ptr< std::atomic< size_t > > Backlog;
+
 };
 
 } // namespace Execution
@@ -28,7 +28,7 @@ namespace Execution
 {
 
 class CWriteOnlyMailbox;
-enum class EProcessID;
+enum class EProcessID : uint64_t;
 
 namespace Messaging
 {
@@ -29,7 +29,7 @@ namespace IP
 namespace Execution
 {
 
-enum class EProcessID;
+enum class EProcessID : uint64_t;
 
 namespace Messaging
 {
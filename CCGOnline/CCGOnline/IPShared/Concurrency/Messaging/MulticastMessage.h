@@ -0,0 +1,56 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include "ProcessMessage.h"
+
+namespace IP
+{
+namespace Execution
+{
+namespace Messaging
+{
+
+// Carries one destination's reference to a multicast payload; the payload itself is shared by every destination and
+// is never copied.  Unwrapped by the receiving process before dispatch, so handlers only ever see the payload.
+class CMulticastMessage : public IProcessMessage
+{
+	public:
+
+		using BASECLASS = IProcessMessage;
+
+		CMulticastMessage( const std::shared_ptr< const IProcessMessage > &payload ) :
+			BASECLASS(),
+			Payload( payload )
+		{}
+
+		virtual ~CMulticastMessage() = default;
+
+		const std::shared_ptr< const IProcessMessage > &Get_Payload( void ) const { return Payload; }
+
+	private:
+
+		std::shared_ptr< const IProcessMessage > Payload;
+};
+
+} // namespace Messaging
+} // namespace Execution
+} // namespace IP
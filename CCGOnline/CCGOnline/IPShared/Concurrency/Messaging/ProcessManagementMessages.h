@@ -29,7 +29,7 @@ namespace Execution
 
 class IProcess;
 
-enum class EProcessID;
+enum class EProcessID : uint64_t;
 
 namespace Messaging
 {
@@ -0,0 +1,82 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include "ProcessMessage.h"
+
+namespace IP
+{
+namespace Execution
+{
+
+class CProcessBase;
+enum class ERequestID : uint64_t;
+
+namespace Messaging
+{
+
+// Base class of requests sent through CProcessBase::Send_Process_Request; the sender stamps the request ID on the way out
+class IProcessRequest : public IProcessMessage
+{
+	public:
+
+		using BASECLASS = IProcessMessage;
+
+		IProcessRequest( void );
+
+		virtual ~IProcessRequest() = default;
+
+		ERequestID Get_Request_ID( void ) const { return RequestID; }
+
+	private:
+
+		friend class IP::Execution::CProcessBase;
+
+		ERequestID RequestID;
+};
+
+// Carries a response back to the process that made the request.  Any message type can be a response; the envelope
+// holds the correlating ID so responses need no common base.
+class CProcessResponseMessage : public IProcessMessage
+{
+	public:
+
+		using BASECLASS = IProcessMessage;
+
+		CProcessResponseMessage( ERequestID request_id, std::unique_ptr< const IProcessMessage > &&response );
+
+		virtual ~CProcessResponseMessage();
+
+		ERequestID Get_Request_ID( void ) const { return RequestID; }
+
+		// The response is handed to exactly one continuation, which takes ownership of it
+		std::unique_ptr< const IProcessMessage > Release_Response( void ) const { return std::move( Response ); }
+
+	private:
+
+		ERequestID RequestID;
+
+		mutable std::unique_ptr< const IProcessMessage > Response;
+};
+
+} // namespace Messaging
+} // namespace Execution
+} // namespace IP
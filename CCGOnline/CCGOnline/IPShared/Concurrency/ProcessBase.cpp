@@ -24,13 +24,17 @@
 
 #include "IPShared/MessageHandling/ProcessMessageHandler.h"
 #include "IPShared/TaskScheduler/TaskScheduler.h"
+#include "IPShared/TaskScheduler/ScheduledTask.h"
 #include "ProcessSubject.h"
 #include "MailboxInterfaces.h"
 #include "ProcessConstants.h"
 #include "ProcessMessageFrame.h"
+#include "ProcessRouting.h"
 #include "Messaging/LoggingMessages.h"
 #include "Messaging/ProcessManagementMessages.h"
 #include "Messaging/ExchangeMailboxMessages.h"
+#include "Messaging/MulticastMessage.h"
+#include "Messaging/ProcessRequestMessages.h"
 #include "ProcessID.h"
 
 namespace IP
@@ -38,7 +42,7 @@ namespace IP
 namespace Execution
 {
 
-enum EProcessState
+enum EProcessState : uint32_t
 {
 	EPS_INITIALIZING,
 	EPS_RUNNING,
@@ -46,6 +50,33 @@ enum EProcessState
 	EPS_SHUTTING_DOWN_HARD
 };
 
+// Fails an outstanding request whose response did not arrive in time
+class CProcessRequestTimeoutTask : public CScheduledTask
+{
+	public:
+
+		using BASECLASS = CScheduledTask;
+
+		CProcessRequestTimeoutTask( double execute_time_seconds, CProcessBase *process, ERequestID request_id ) :
+			BASECLASS( execute_time_seconds ),
+			Process( process ),
+			RequestID( request_id )
+		{}
+
+		virtual bool Execute( double /*current_time_seconds*/, double & /*reschedule_time_seconds*/ ) override
+		{
+			Process->Handle_Request_Timeout( RequestID );
+
+			return false;
+		}
+
+	private:
+
+		CProcessBase *Process;
+
+		ERequestID RequestID;
+};
+
 
 CProcessBase::CProcessBase( const SProcessProperties &properties ) :
 	BASECLASS(),
@@ -62,9 +93,11 @@ CProcessBase::CProcessBase( const SProcessProperties &properties ) :
 	LoggingMailbox( nullptr ),
 	MyMailbox( nullptr ),
 	ShutdownMailboxes(),
+	ProcessGroups(),
 	FirstServiceTimeSeconds( 0.0 ),
 	CurrentTimeSeconds( 0.0 ),
 	MessageHandlers(),
+	OutstandingRequests(),
 	TaskScheduler( new CTaskScheduler )
 {
 }
@@ -155,6 +188,102 @@ void CProcessBase::Send_Process_Message( EProcessID dest_process_id, std::unique
 }
 
 
+void CProcessBase::Send_Process_Multicast( const std::vector< EProcessID > &dest_process_ids, const std::shared_ptr< const Messaging::IProcessMessage > &message )
+{
+	for ( auto iter = dest_process_ids.cbegin(), end = dest_process_ids.cend(); iter != end; ++iter )
+	{
+		// manager messages are requests that the manager takes ownership of
+		FATAL_ASSERT( *iter != EProcessID::CONCURRENCY_MANAGER );
+
+		Send_Process_Message( *iter, std::unique_ptr< const Messaging::IProcessMessage >( new Messaging::CMulticastMessage( message ) ) );
+	}
+}
+
+
+void CProcessBase::Send_Process_Multicast( const SProcessProperties &dest_properties, const std::shared_ptr< const Messaging::IProcessMessage > &message )
+{
+	// goes to every process we hold a mailbox for whose properties match
+	for ( auto iter = IDToPropertiesTable.cbegin(), end = IDToPropertiesTable.cend(); iter != end; ++iter )
+	{
+		if ( dest_properties.Matches( iter->second ) )
+		{
+			Send_Process_Message( iter->first, std::unique_ptr< const Messaging::IProcessMessage >( new Messaging::CMulticastMessage( message ) ) );
+		}
+	}
+}
+
+
+EProcessID CProcessBase::Send_Process_Message_By_Properties( const SProcessProperties &dest_properties, std::unique_ptr< const Messaging::IProcessMessage > &message, uint64_t routing_key )
+{
+	CProcessGroup *group = nullptr;
+
+	auto iter = ProcessGroups.find( dest_properties );
+	if ( iter != ProcessGroups.cend() )
+	{
+		group = iter->second.get();
+	}
+	else
+	{
+		group = Create_Process_Group( dest_properties, std::unique_ptr< IProcessRoutingPolicy >( new CRoundRobinRoutingPolicy ) );
+	}
+
+	EProcessID dest_process_id = group->Select_Process( routing_key );
+	if ( dest_process_id != EProcessID::INVALID )
+	{
+		Send_Process_Message( dest_process_id, message );
+	}
+
+	return dest_process_id;
+}
+
+
+void CProcessBase::Set_Routing_Policy( const SProcessProperties &dest_properties, std::unique_ptr< IProcessRoutingPolicy > &&policy )
+{
+	Create_Process_Group( dest_properties, std::move( policy ) );
+}
+
+
+CProcessGroup *CProcessBase::Create_Process_Group( const SProcessProperties &properties, std::unique_ptr< IProcessRoutingPolicy > &&policy )
+{
+	std::unique_ptr< CProcessGroup > group( new CProcessGroup( properties, std::move( policy ), [ this ]( EProcessID process_id ){ return Get_Process_Backlog( process_id ); } ) );
+
+	// processes that are leaving are not routed to
+	for ( auto iter = IDToPropertiesTable.cbegin(), end = IDToPropertiesTable.cend(); iter != end; ++iter )
+	{
+		if ( properties.Matches( iter->second ) && ShutdownMailboxes.find( iter->first ) == ShutdownMailboxes.cend() )
+		{
+			group->Add_Member( iter->first );
+		}
+	}
+
+	CProcessGroup *raw_group = group.get();
+	ProcessGroups[ properties ] = std::move( group );
+
+	return raw_group;
+}
+
+
+size_t CProcessBase::Get_Process_Backlog( EProcessID process_id ) const
+{
+	size_t backlog = 0;
+
+	auto mailbox_iter = Mailboxes.find( process_id );
+	if ( mailbox_iter != Mailboxes.cend() )
+	{
+		backlog += mailbox_iter->second->Get_Backlog();
+	}
+
+	// messages we have sent this service but not yet flushed
+	auto frame_iter = PendingOutboundFrames.find( process_id );
+	if ( frame_iter != PendingOutboundFrames.cend() )
+	{
+		backlog += frame_iter->second->Get_Message_Count();
+	}
+
+	return backlog;
+}
+
+
 void CProcessBase::Send_Manager_Message( std::unique_ptr< const Messaging::IProcessMessage > &message )
 {
 	Send_Process_Message( EProcessID::CONCURRENCY_MANAGER, message );
@@ -350,6 +479,19 @@ void CProcessBase::Handle_Message( EProcessID process_id, std::unique_ptr< const
 {
 	const Messaging::IProcessMessage *msg_base = message.get();
 
+	// multicast envelopes dispatch on the type of the payload they share
+	if ( typeid( *msg_base ) == typeid( Messaging::CMulticastMessage ) )
+	{
+		const std::shared_ptr< const Messaging::IProcessMessage > &payload = static_cast< const Messaging::CMulticastMessage * >( msg_base )->Get_Payload();
+
+		Loki::TypeInfo payload_key( typeid( *payload ) );
+		auto iter = MessageHandlers.find( payload_key );
+		FATAL_ASSERT( iter != MessageHandlers.cend() );
+
+		iter->second->Handle_Shared_Message( process_id, payload );
+		return;
+	}
+
 	Loki::TypeInfo hash_key( typeid( *msg_base ) );
 	auto iter = MessageHandlers.find( hash_key );
 	FATAL_ASSERT( iter != MessageHandlers.cend() );
@@ -363,6 +505,7 @@ void CProcessBase::Register_Message_Handlers( void )
 	REGISTER_THIS_HANDLER( Messaging::CAddMailboxMessage, CProcessBase, Handle_Add_Mailbox_Message )
 	REGISTER_THIS_HANDLER( Messaging::CReleaseMailboxRequest, CProcessBase, Handle_Release_Mailbox_Request )
 	REGISTER_THIS_HANDLER( Messaging::CShutdownSelfRequest, CProcessBase, Handle_Shutdown_Self_Request )
+	REGISTER_THIS_HANDLER( Messaging::CProcessResponseMessage, CProcessBase, Handle_Process_Response )
 } 
 
 
@@ -388,6 +531,14 @@ void CProcessBase::Handle_Add_Mailbox_Message( EProcessID /*source_process_id*/,
 		const SProcessProperties &properties = message->Get_Mailbox()->Get_Properties();
 		IDToPropertiesTable.insert( IDToProcessPropertiesTableType::value_type( add_id, properties ) );
 		PropertiesToIDTable.insert( ProcessPropertiesToIDTableType::value_type( properties, add_id ) );
+
+		for ( auto iter = ProcessGroups.begin(), end = ProcessGroups.end(); iter != end; ++iter )
+		{
+			if ( iter->second->Get_Properties().Matches( properties ) )
+			{
+				iter->second->Add_Member( add_id );
+			}
+		}
 	}
 }
 
@@ -400,6 +551,9 @@ void CProcessBase::Handle_Release_Mailbox_Request( EProcessID source_process_id,
 	FATAL_ASSERT( shutdown_process_id != EProcessID::CONCURRENCY_MANAGER && shutdown_process_id != EProcessID::LOGGING );
 
 	ShutdownMailboxes.insert( shutdown_process_id );
+
+	// stop routing to the process now rather than when its mailbox is released
+	Remove_Process_ID_From_Groups( shutdown_process_id );
 }
 
 
@@ -424,6 +578,93 @@ void CProcessBase::Handle_Shutdown_Self_Request( EProcessID source_process_id, s
 }
 
 
+ERequestID CProcessBase::Send_Process_Request( EProcessID dest_process_id, std::unique_ptr< Messaging::IProcessRequest > &&request, double timeout_seconds, const RequestContinuationType &continuation )
+{
+	ERequestID request_id = OutstandingRequests.Allocate_ID();
+	request->RequestID = request_id;
+
+	SOutstandingRequest &outstanding_request = OutstandingRequests[ request_id ];
+	outstanding_request.Continuation = continuation;
+
+	if ( timeout_seconds > 0.0 )
+	{
+		outstanding_request.TimeoutTask.reset( new CProcessRequestTimeoutTask( Get_Current_Process_Time() + timeout_seconds, this, request_id ) );
+		TaskScheduler->Submit_Task( outstanding_request.TimeoutTask );
+	}
+
+	Send_Process_Message( dest_process_id, std::unique_ptr< const Messaging::IProcessMessage >( request.release() ) );
+
+	return request_id;
+}
+
+
+void CProcessBase::Send_Process_Response( EProcessID dest_process_id, const Messaging::IProcessRequest &request, std::unique_ptr< const Messaging::IProcessMessage > &&response )
+{
+	FATAL_ASSERT( request.Get_Request_ID() != ERequestID::INVALID );
+
+	Send_Process_Message( dest_process_id, std::unique_ptr< const Messaging::IProcessMessage >( new Messaging::CProcessResponseMessage( request.Get_Request_ID(), std::move( response ) ) ) );
+}
+
+
+bool CProcessBase::Cancel_Process_Request( ERequestID request_id )
+{
+	return Remove_Outstanding_Request( request_id ) != nullptr;
+}
+
+
+bool CProcessBase::Is_Process_Request_Outstanding( ERequestID request_id ) const
+{
+	return OutstandingRequests.find( request_id ) != OutstandingRequests.cend();
+}
+
+
+CProcessBase::RequestContinuationType CProcessBase::Remove_Outstanding_Request( ERequestID request_id )
+{
+	auto iter = OutstandingRequests.find( request_id );
+	if ( iter == OutstandingRequests.end() )
+	{
+		return RequestContinuationType();
+	}
+
+	RequestContinuationType continuation = std::move( iter->second.Continuation );
+
+	const std::shared_ptr< CScheduledTask > &timeout_task = iter->second.TimeoutTask;
+	if ( timeout_task != nullptr && timeout_task->Is_Scheduled() )
+	{
+		TaskScheduler->Remove_Task( timeout_task );
+	}
+
+	// released before the continuation runs, so the continuation is free to issue further requests
+	OutstandingRequests.erase( iter );
+
+	return continuation;
+}
+
+
+void CProcessBase::Handle_Process_Response( EProcessID /*source_process_id*/, std::unique_ptr< const Messaging::CProcessResponseMessage > &message )
+{
+	RequestContinuationType continuation = Remove_Outstanding_Request( message->Get_Request_ID() );
+	if ( continuation == nullptr )
+	{
+		// timed out or cancelled
+		return;
+	}
+
+	std::unique_ptr< const Messaging::IProcessMessage > response = message->Release_Response();
+	continuation( response );
+}
+
+
+void CProcessBase::Handle_Request_Timeout( ERequestID request_id )
+{
+	RequestContinuationType continuation = Remove_Outstanding_Request( request_id );
+	FATAL_ASSERT( continuation != nullptr );
+
+	std::unique_ptr< const Messaging::IProcessMessage > no_response;
+	continuation( no_response );
+}
+
+
 bool CProcessBase::Is_Shutting_Down( void ) const
 {
 	return State == EPS_SHUTTING_DOWN_SOFT || State == EPS_SHUTTING_DOWN_HARD;
@@ -474,8 +715,8 @@ void CProcessBase::Remove_Process_ID_From_Tables( EProcessID process_id )
 		return;
 	}
 
-	auto ub_iter2 = PropertiesToIDTable.upper_bound( iter1->second );
-	for ( auto iter2 = PropertiesToIDTable.lower_bound( iter1->second ); iter2 != ub_iter2; ++iter2 )
+	auto range = PropertiesToIDTable.equal_range( iter1->second );
+	for ( auto iter2 = range.first; iter2 != range.second; ++iter2 )
 	{
 		if ( iter2->second == process_id )
 		{
@@ -485,6 +726,17 @@ void CProcessBase::Remove_Process_ID_From_Tables( EProcessID process_id )
 	}
 
 	IDToPropertiesTable.erase( iter1 );
+
+	Remove_Process_ID_From_Groups( process_id );
+}
+
+
+void CProcessBase::Remove_Process_ID_From_Groups( EProcessID process_id )
+{
+	for ( auto iter = ProcessGroups.begin(), end = ProcessGroups.end(); iter != end; ++iter )
+	{
+		iter->second->Remove_Member( process_id );
+	}
 }
 
 
@@ -22,6 +22,8 @@
 #include "ManagedProcessInterface.h"
 
 #include "ProcessProperties.h"
+#include "ProcessSlotTable.h"
+#include "ProcessRequestID.h"
 
 class CProcessBaseTester;
 class CProcessBaseExaminer;
@@ -38,13 +40,19 @@ namespace Messaging
 class CAddMailboxMessage;
 class CReleaseMailboxRequest;
 class CShutdownSelfRequest;
+class CProcessResponseMessage;
 class IProcessMessageHandler;
+class IProcessRequest;
 
 } // namespace Messaging
 
-enum EProcessState;
+enum EProcessState : uint32_t;
 
+class CProcessGroup;
 class CProcessMessageFrame;
+class CProcessRequestTimeoutTask;
+class IProcessRoutingPolicy;
+class CScheduledTask;
 
 // The shared logic level of all virtual processes; not instantiable
 class CProcessBase : public IManagedProcess
@@ -65,6 +73,8 @@ class CProcessBase : public IManagedProcess
 
 		virtual void Send_Process_Message( EProcessID dest_process_id, std::unique_ptr< const Messaging::IProcessMessage > &message ) override;
 		virtual void Send_Process_Message( EProcessID dest_process_id, std::unique_ptr< const Messaging::IProcessMessage > &&message ) override;
+		virtual void Send_Process_Multicast( const std::vector< EProcessID > &dest_process_ids, const std::shared_ptr< const Messaging::IProcessMessage > &message ) override;
+		virtual void Send_Process_Multicast( const SProcessProperties &dest_properties, const std::shared_ptr< const Messaging::IProcessMessage > &message ) override;
 		virtual void Send_Manager_Message( std::unique_ptr< const Messaging::IProcessMessage > &message ) override;
 		virtual void Send_Manager_Message( std::unique_ptr< const Messaging::IProcessMessage > &&message ) override;
 		virtual void Log( std::wstring &&message ) override;
@@ -84,6 +94,38 @@ class CProcessBase : public IManagedProcess
 
 		void Register_Handler( const std::type_info &message_type_info, std::unique_ptr< Messaging::IProcessMessageHandler > &handler );
 
+		// Correlated requests: the continuation runs on this process when the response arrives, or with a null response
+		// once timeout_seconds of process time pass without one (a non-positive timeout waits indefinitely)
+		using RequestContinuationType = std::function< void( std::unique_ptr< const Messaging::IProcessMessage > & ) >;
+
+		ERequestID Send_Process_Request( EProcessID dest_process_id, std::unique_ptr< Messaging::IProcessRequest > &&request, double timeout_seconds, const RequestContinuationType &continuation );
+
+		template< typename ResponseType, typename ContinuationType >
+		ERequestID Send_Process_Request( EProcessID dest_process_id, std::unique_ptr< Messaging::IProcessRequest > &&request, double timeout_seconds, ContinuationType continuation )
+		{
+			return Send_Process_Request( dest_process_id, std::move( request ), timeout_seconds,
+				[ continuation ]( std::unique_ptr< const Messaging::IProcessMessage > &response ) mutable
+				{
+					FATAL_ASSERT( response == nullptr || typeid( *response ) == typeid( ResponseType ) );
+
+					std::unique_ptr< const ResponseType > typed_response( static_cast< const ResponseType * >( response.release() ) );
+					continuation( typed_response );
+				} );
+		}
+
+		void Send_Process_Response( EProcessID dest_process_id, const Messaging::IProcessRequest &request, std::unique_ptr< const Messaging::IProcessMessage > &&response );
+
+		// Drops an outstanding request without running its continuation; a response that arrives later is ignored
+		bool Cancel_Process_Request( ERequestID request_id );
+		bool Is_Process_Request_Outstanding( ERequestID request_id ) const;
+
+		// Load-balanced sends: the message goes to one process, among those we hold a mailbox for whose properties match,
+		// chosen by the routing policy of that property pattern (round robin unless set otherwise).  Returns the chosen
+		// process, or EProcessID::INVALID, leaving the message untouched, if no process matches.
+		EProcessID Send_Process_Message_By_Properties( const SProcessProperties &dest_properties, std::unique_ptr< const Messaging::IProcessMessage > &message, uint64_t routing_key = 0 );
+
+		void Set_Routing_Policy( const SProcessProperties &dest_properties, std::unique_ptr< IProcessRoutingPolicy > &&policy );
+
 	protected:
 
 		virtual void Per_Frame_Logic_Start( void ) {}
@@ -105,10 +147,11 @@ class CProcessBase : public IManagedProcess
 
 	private:
 
-		friend class CProcessBaseTester;
-		friend class CProcessBaseExaminer;
-		friend class CTaskProcessBaseTester;
-		friend class CTaskProcessBaseExaminer;
+		friend class ::CProcessBaseTester;
+		friend class ::CProcessBaseExaminer;
+		friend class ::CTaskProcessBaseTester;
+		friend class ::CTaskProcessBaseExaminer;
+		friend class CProcessRequestTimeoutTask;
 
 		// private accessors
 		std::shared_ptr< CWriteOnlyMailbox > Get_Mailbox( EProcessID process_id ) const;
@@ -122,18 +165,34 @@ class CProcessBase : public IManagedProcess
 		void Handle_Add_Mailbox_Message( EProcessID process_id, std::unique_ptr< const Messaging::CAddMailboxMessage > &message );
 		void Handle_Release_Mailbox_Request( EProcessID process_id, std::unique_ptr< const Messaging::CReleaseMailboxRequest > &request );
 		void Handle_Shutdown_Self_Request( EProcessID process_id, std::unique_ptr< const Messaging::CShutdownSelfRequest > &message );
+		void Handle_Process_Response( EProcessID process_id, std::unique_ptr< const Messaging::CProcessResponseMessage > &message );
+
+		void Handle_Request_Timeout( ERequestID request_id );
+		RequestContinuationType Remove_Outstanding_Request( ERequestID request_id );
 
 		void Handle_Shutdown_Mailboxes( void );
 
 		void Build_Process_ID_List_By_Properties( const SProcessProperties &properties, std::vector< EProcessID > &process_ids ) const;
 		void Remove_Process_ID_From_Tables( EProcessID process_id );
+		void Remove_Process_ID_From_Groups( EProcessID process_id );
+
+		CProcessGroup *Create_Process_Group( const SProcessProperties &properties, std::unique_ptr< IProcessRoutingPolicy > &&policy );
+		size_t Get_Process_Backlog( EProcessID process_id ) const;
+
+		struct SOutstandingRequest
+		{
+			RequestContinuationType Continuation;
+			std::shared_ptr< CScheduledTask > TimeoutTask;
+		};
 
 		// Type definitions
-		using MailboxTableType = std::unordered_map< EProcessID, std::shared_ptr< CWriteOnlyMailbox > >;
-		using IDToProcessPropertiesTableType = std::unordered_map< EProcessID, SProcessProperties >;
+		using MailboxTableType = TProcessSlotTable< std::shared_ptr< CWriteOnlyMailbox > >;
+		using IDToProcessPropertiesTableType = TProcessSlotTable< SProcessProperties >;
 		using ProcessPropertiesToIDTableType = std::unordered_multimap< SProcessProperties, EProcessID, SProcessPropertiesContainerHelper >;
 		using ProcessMessageHandlerTableType = std::unordered_map< Loki::TypeInfo, std::unique_ptr<  Messaging::IProcessMessageHandler >, STypeInfoContainerHelper >;
 		using FrameTableType = std::unordered_map< EProcessID, std::unique_ptr< CProcessMessageFrame > >;
+		using OutstandingRequestTableType = TProcessSlotTable< SOutstandingRequest, ERequestID >;
+		using ProcessGroupTableType = std::unordered_map< SProcessProperties, std::unique_ptr< CProcessGroup >, SProcessPropertiesContainerHelper >;
 
 		// Private Data
 		// Simple state
@@ -159,6 +218,8 @@ class CProcessBase : public IManagedProcess
 
 		std::set< EProcessID > ShutdownMailboxes;
 
+		ProcessGroupTableType ProcessGroups;
+
 		// Timing
 		double FirstServiceTimeSeconds;
 		double CurrentTimeSeconds;
@@ -166,6 +227,8 @@ class CProcessBase : public IManagedProcess
 		// Misc
 		ProcessMessageHandlerTableType MessageHandlers;
 
+		OutstandingRequestTableType OutstandingRequests;
+
 		std::unique_ptr< CTaskScheduler > TaskScheduler;
 };
 
@@ -29,6 +29,8 @@ namespace IP
 namespace Execution
 {
 
+class CQuiescentStateReclaimer;
+
 // Defines a virtual process's execution context; currently only contains TBB info
 class CProcessExecutionContext
 {
@@ -36,13 +38,31 @@ class CProcessExecutionContext
 
 		CProcessExecutionContext( void ) :
 			ElapsedTime( 0.0 ),
-			IsDirect( false )
+			IsDirect( false ),
+			Reclaimer( nullptr )
 		{
 		}
 
 		CProcessExecutionContext( tbb::task *task, double elapsed_time ) :
 			ElapsedTime( elapsed_time ),
-			IsDirect( task == nullptr )
+			IsDirect( task == nullptr ),
+			Reclaimer( nullptr )
+		{
+		}
+
+		// A scheduled run performed on the manager's thread rather than by a TBB task
+		explicit CProcessExecutionContext( double elapsed_time ) :
+			ElapsedTime( elapsed_time ),
+			IsDirect( false ),
+			Reclaimer( nullptr )
+		{
+		}
+
+		// The launch of a thread process, which brackets each of its own service passes with a read section
+		explicit CProcessExecutionContext( CQuiescentStateReclaimer *reclaimer ) :
+			ElapsedTime( 0.0 ),
+			IsDirect( false ),
+			Reclaimer( reclaimer )
 		{
 		}
 
@@ -50,11 +70,14 @@ class CProcessExecutionContext
 
 		double Get_Elapsed_Time( void ) const { return ElapsedTime; }
 		bool Is_Direct( void ) const { return IsDirect; }
+		CQuiescentStateReclaimer *Get_Reclaimer( void ) const { return Reclaimer; }
 
 	private:
 
 		double ElapsedTime;
 		bool IsDirect;
+
+		CQuiescentStateReclaimer *Reclaimer;
 };
 
 } // namespace Execution
@@ -24,7 +24,10 @@ namespace IP
 namespace Execution
 {
 
-enum class EProcessID
+// A process ID packs the process's slot in the slot tables (low 32 bits) with the generation of that slot (high 32 bits).
+// A slot is reused once its process is gone, under a new generation, so an ID held past its process's shutdown never
+// matches whatever occupies the slot next.  The fixed IDs below are generation zero of the reserved low slots.
+enum class EProcessID : uint64_t
 {
 	INVALID = 0,
 
@@ -34,6 +37,21 @@ enum class EProcessID
 	FIRST_FREE_ID
 };
 
+inline uint32_t Get_Process_ID_Slot( EProcessID process_id )
+{
+	return static_cast< uint32_t >( static_cast< uint64_t >( process_id ) & 0xFFFFFFFFULL );
+}
+
+inline uint32_t Get_Process_ID_Generation( EProcessID process_id )
+{
+	return static_cast< uint32_t >( static_cast< uint64_t >( process_id ) >> 32 );
+}
+
+inline EProcessID Make_Process_ID( uint32_t slot, uint32_t generation )
+{
+	return static_cast< EProcessID >( ( static_cast< uint64_t >( generation ) << 32 ) | slot );
+}
+
 } // namespace Execution 
 } // namespace IP
 
@@ -33,7 +33,7 @@ class IProcessMessage;
 class CTaskScheduler;
 struct SProcessProperties;
 
-enum class EProcessID;
+enum class EProcessID : uint64_t;
 
 enum class EProcessExecutionMode
 {
@@ -57,6 +57,8 @@ class IProcess
 
 		virtual void Send_Process_Message( EProcessID destination_id, std::unique_ptr< const Messaging::IProcessMessage > &message ) = 0;
 		virtual void Send_Process_Message( EProcessID destination_id, std::unique_ptr< const Messaging::IProcessMessage > &&message ) = 0;
+		virtual void Send_Process_Multicast( const std::vector< EProcessID > &destination_ids, const std::shared_ptr< const Messaging::IProcessMessage > &message ) = 0;
+		virtual void Send_Process_Multicast( const SProcessProperties &destination_properties, const std::shared_ptr< const Messaging::IProcessMessage > &message ) = 0;
 		virtual void Send_Manager_Message( std::unique_ptr< const Messaging::IProcessMessage > &message ) = 0;
 		virtual void Send_Manager_Message( std::unique_ptr< const Messaging::IProcessMessage > &&message ) = 0;
 		virtual void Log( std::wstring &&message ) = 0;
@@ -39,8 +39,10 @@ CProcessMailbox::CProcessMailbox( EProcessID process_id, const SProcessPropertie
 {
 	std::shared_ptr< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > > queue = std::static_pointer_cast< IP::Concurrency::IConcurrentQueue< std::unique_ptr< CProcessMessageFrame > > >( std::make_shared< ProcessToProcessQueueType >() );
 
-	WriteOnlyMailbox.reset( new CWriteOnlyMailbox( process_id, properties, queue ) );
-	ReadOnlyMailbox.reset( new CReadOnlyMailbox( queue ) );
+	std::shared_ptr< std::atomic< size_t > > backlog( new std::atomic< size_t >( 0 ) );
+
+	WriteOnlyMailbox.reset( new CWriteOnlyMailbox( process_id, properties, queue, backlog ) );
+	ReadOnlyMailbox.reset( new CReadOnlyMailbox( queue, backlog ) );
 }
 
 
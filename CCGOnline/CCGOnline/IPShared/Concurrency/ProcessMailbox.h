@@ -39,7 +39,7 @@ class CWriteOnlyMailbox;
 class CReadOnlyMailbox;
 class CProcessMessageFrame;
 
-enum class EProcessID;
+enum class EProcessID : uint64_t;
 
 // Controls which concurrent queue implementation we use
 //using ProcessToProcessQueueType = CTBBConcurrentQueue< std::unique_ptr< CProcessMessageFrame > >;
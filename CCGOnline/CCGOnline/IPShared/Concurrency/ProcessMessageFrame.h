@@ -30,7 +30,7 @@ class IProcessMessage;
 
 } // namespace Messaging
 
-enum class EProcessID;
+enum class EProcessID : uint64_t;
 
 // A container of thread messages
 class CProcessMessageFrame
@@ -45,6 +45,7 @@ class CProcessMessageFrame
 		~CProcessMessageFrame();
 
 		EProcessID Get_Process_ID( void ) const { return ProcessID; }
+		size_t Get_Message_Count( void ) const { return Messages.size(); }
 
 		void Add_Message( std::unique_ptr< const Messaging::IProcessMessage > &message );
 		void Add_Message( std::unique_ptr< const Messaging::IProcessMessage > &&message );
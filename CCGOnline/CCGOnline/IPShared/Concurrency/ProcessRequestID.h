@@ -0,0 +1,52 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include "ProcessSlotTable.h"
+
+namespace IP
+{
+namespace Execution
+{
+
+// Identifies one outstanding request of the process that sent it.  Encoded like a process ID: the slot in the sender's
+// outstanding request table (low 32 bits) and that slot's generation (high 32 bits), so a response that arrives after
+// its request timed out or was cancelled cannot be mistaken for the answer to a later request.
+enum class ERequestID : uint64_t
+{
+	INVALID = 0,
+
+	FIRST_FREE_ID
+};
+
+template<>
+struct TSlotKeyTraits< ERequestID >
+{
+	static uint32_t Get_Slot( ERequestID request_id ) { return static_cast< uint32_t >( static_cast< uint64_t >( request_id ) & 0xFFFFFFFFULL ); }
+	static uint32_t Get_Generation( ERequestID request_id ) { return static_cast< uint32_t >( static_cast< uint64_t >( request_id ) >> 32 ); }
+	static ERequestID Make_Key( uint32_t slot, uint32_t generation ) { return static_cast< ERequestID >( ( static_cast< uint64_t >( generation ) << 32 ) | slot ); }
+
+	static ERequestID Get_Invalid_Key( void ) { return ERequestID::INVALID; }
+	static uint32_t Get_First_Free_Slot( void ) { return static_cast< uint32_t >( ERequestID::FIRST_FREE_ID ); }
+};
+
+} // namespace Execution
+} // namespace IP
@@ -0,0 +1,188 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+#include "stdafx.h"
+
+#include "ProcessRouting.h"
+
+#include "ProcessID.h"
+
+namespace IP
+{
+namespace Execution
+{
+
+CProcessGroup::CProcessGroup( const SProcessProperties &properties, std::unique_ptr< IProcessRoutingPolicy > &&policy, const BacklogFunctionType &backlog_function ) :
+	Properties( properties ),
+	Members(),
+	Policy( std::move( policy ) ),
+	BacklogFunction( backlog_function )
+{
+	FATAL_ASSERT( Policy.get() != nullptr );
+}
+
+
+CProcessGroup::~CProcessGroup()
+{
+}
+
+
+void CProcessGroup::Add_Member( EProcessID process_id )
+{
+	if ( std::find( Members.cbegin(), Members.cend(), process_id ) != Members.cend() )
+	{
+		return;
+	}
+
+	Members.push_back( process_id );
+	Policy->On_Member_Added( process_id );
+}
+
+
+void CProcessGroup::Remove_Member( EProcessID process_id )
+{
+	auto iter = std::find( Members.begin(), Members.end(), process_id );
+	if ( iter == Members.end() )
+	{
+		return;
+	}
+
+	Members.erase( iter );
+	Policy->On_Member_Removed( process_id );
+}
+
+
+EProcessID CProcessGroup::Select_Process( uint64_t routing_key )
+{
+	if ( Members.empty() )
+	{
+		return EProcessID::INVALID;
+	}
+
+	return Policy->Select_Process( *this, routing_key );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CRoundRobinRoutingPolicy::CRoundRobinRoutingPolicy( void ) :
+	NextIndex( 0 )
+{
+}
+
+
+EProcessID CRoundRobinRoutingPolicy::Select_Process( const CProcessGroup &group, uint64_t /*routing_key*/ )
+{
+	const std::vector< EProcessID > &members = group.Get_Members();
+
+	// membership may have shrunk since the last pick
+	NextIndex = NextIndex % members.size();
+
+	return members[ NextIndex++ ];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CLeastBacklogRoutingPolicy::CLeastBacklogRoutingPolicy( void ) :
+	StartIndex( 0 )
+{
+}
+
+
+EProcessID CLeastBacklogRoutingPolicy::Select_Process( const CProcessGroup &group, uint64_t /*routing_key*/ )
+{
+	const std::vector< EProcessID > &members = group.Get_Members();
+	size_t member_count = members.size();
+
+	StartIndex = ( StartIndex + 1 ) % member_count;
+
+	EProcessID best_process_id = members[ StartIndex ];
+	size_t best_backlog = group.Get_Backlog( best_process_id );
+
+	for ( size_t i = 1; i < member_count && best_backlog > 0; ++i )
+	{
+		EProcessID process_id = members[ ( StartIndex + i ) % member_count ];
+		size_t backlog = group.Get_Backlog( process_id );
+		if ( backlog < best_backlog )
+		{
+			best_process_id = process_id;
+			best_backlog = backlog;
+		}
+	}
+
+	return best_process_id;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A 64 bit finalizer (splitmix64); spreads both process IDs, which differ in few bits, and caller keys, which are often small
+static uint64_t Mix_Hash( uint64_t value )
+{
+	value ^= value >> 30;
+	value *= 0xBF58476D1CE4E5B9ULL;
+	value ^= value >> 27;
+	value *= 0x94D049BB133111EBULL;
+	value ^= value >> 31;
+
+	return value;
+}
+
+
+CConsistentHashRoutingPolicy::CConsistentHashRoutingPolicy( uint32_t points_per_member ) :
+	PointsPerMember( points_per_member ),
+	Ring()
+{
+	FATAL_ASSERT( PointsPerMember > 0 );
+}
+
+
+void CConsistentHashRoutingPolicy::On_Member_Added( EProcessID process_id )
+{
+	uint64_t process_hash = Mix_Hash( static_cast< uint64_t >( process_id ) );
+	for ( uint32_t i = 0; i < PointsPerMember; ++i )
+	{
+		Ring.push_back( RingEntryType( Mix_Hash( process_hash + i ), process_id ) );
+	}
+
+	std::sort( Ring.begin(), Ring.end() );
+}
+
+
+void CConsistentHashRoutingPolicy::On_Member_Removed( EProcessID process_id )
+{
+	Ring.erase( std::remove_if( Ring.begin(), Ring.end(), [ process_id ]( const RingEntryType &entry ){ return entry.second == process_id; } ), Ring.end() );
+}
+
+
+EProcessID CConsistentHashRoutingPolicy::Select_Process( const CProcessGroup & /*group*/, uint64_t routing_key )
+{
+	FATAL_ASSERT( !Ring.empty() );
+
+	// the first point at or past the key's hash, wrapping around the ring
+	uint64_t key_hash = Mix_Hash( routing_key );
+	auto iter = std::lower_bound( Ring.cbegin(), Ring.cend(), key_hash, []( const RingEntryType &entry, uint64_t hash ){ return entry.first < hash; } );
+	if ( iter == Ring.cend() )
+	{
+		iter = Ring.cbegin();
+	}
+
+	return iter->second;
+}
+
+} // namespace Execution
+} // namespace IP
@@ -0,0 +1,138 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+#pragma once
+
+#include "ProcessProperties.h"
+
+namespace IP
+{
+namespace Execution
+{
+
+enum class EProcessID : uint64_t;
+
+class CProcessGroup;
+
+// Picks which member of a process group receives a message sent to the group's properties
+class IProcessRoutingPolicy
+{
+	public:
+
+		virtual ~IProcessRoutingPolicy() = default;
+
+		virtual void On_Member_Added( EProcessID /*process_id*/ ) {}
+		virtual void On_Member_Removed( EProcessID /*process_id*/ ) {}
+
+		// only called on a non-empty group
+		virtual EProcessID Select_Process( const CProcessGroup &group, uint64_t routing_key ) = 0;
+};
+
+// Every process, known to the owning process, whose properties match a pattern.  Membership follows the owner's mailbox
+// table: processes join when their mailbox arrives and leave when the manager asks for it back.
+class CProcessGroup
+{
+	public:
+
+		// Messages queued for a process but not yet read by it, as seen from the owning process
+		using BacklogFunctionType = std::function< size_t( EProcessID ) >;
+
+		CProcessGroup( const SProcessProperties &properties, std::unique_ptr< IProcessRoutingPolicy > &&policy, const BacklogFunctionType &backlog_function );
+		~CProcessGroup();
+
+		const SProcessProperties &Get_Properties( void ) const { return Properties; }
+		const std::vector< EProcessID > &Get_Members( void ) const { return Members; }
+
+		size_t Get_Backlog( EProcessID process_id ) const { return BacklogFunction( process_id ); }
+
+		void Add_Member( EProcessID process_id );
+		void Remove_Member( EProcessID process_id );
+
+		// Returns EProcessID::INVALID if the group is empty
+		EProcessID Select_Process( uint64_t routing_key );
+
+	private:
+
+		SProcessProperties Properties;
+
+		std::vector< EProcessID > Members;
+
+		std::unique_ptr< IProcessRoutingPolicy > Policy;
+
+		BacklogFunctionType BacklogFunction;
+};
+
+// Cycles through the members in order, ignoring the routing key
+class CRoundRobinRoutingPolicy : public IProcessRoutingPolicy
+{
+	public:
+
+		CRoundRobinRoutingPolicy( void );
+		virtual ~CRoundRobinRoutingPolicy() = default;
+
+		virtual EProcessID Select_Process( const CProcessGroup &group, uint64_t routing_key ) override;
+
+	private:
+
+		size_t NextIndex;
+};
+
+// Picks the member with the smallest backlog; ties rotate so an idle group still spreads its load
+class CLeastBacklogRoutingPolicy : public IProcessRoutingPolicy
+{
+	public:
+
+		CLeastBacklogRoutingPolicy( void );
+		virtual ~CLeastBacklogRoutingPolicy() = default;
+
+		virtual EProcessID Select_Process( const CProcessGroup &group, uint64_t routing_key ) override;
+
+	private:
+
+		size_t StartIndex;
+};
+
+// Maps the routing key onto a hash ring of the members, so a key keeps going to the same process for as long as that
+// process is a member.  A member joining or leaving only moves the keys adjacent to its points on the ring.
+class CConsistentHashRoutingPolicy : public IProcessRoutingPolicy
+{
+	public:
+
+		static const uint32_t DEFAULT_POINTS_PER_MEMBER = 64;
+
+		CConsistentHashRoutingPolicy( uint32_t points_per_member = DEFAULT_POINTS_PER_MEMBER );
+		virtual ~CConsistentHashRoutingPolicy() = default;
+
+		virtual void On_Member_Added( EProcessID process_id ) override;
+		virtual void On_Member_Removed( EProcessID process_id ) override;
+
+		virtual EProcessID Select_Process( const CProcessGroup &group, uint64_t routing_key ) override;
+
+	private:
+
+		using RingEntryType = std::pair< uint64_t, EProcessID >;
+
+		uint32_t PointsPerMember;
+
+		// sorted by hash
+		std::vector< RingEntryType > Ring;
+};
+
+} // namespace Execution
+} // namespace IP
@@ -0,0 +1,276 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+#pragma once
+
+#include "ProcessID.h"
+
+namespace IP
+{
+namespace Execution
+{
+
+// Describes how a slot-encoded ID splits into slot and generation; specialized alongside each ID type
+template< typename KeyType >
+struct TSlotKeyTraits;
+
+template<>
+struct TSlotKeyTraits< EProcessID >
+{
+	static uint32_t Get_Slot( EProcessID process_id ) { return Get_Process_ID_Slot( process_id ); }
+	static uint32_t Get_Generation( EProcessID process_id ) { return Get_Process_ID_Generation( process_id ); }
+	static EProcessID Make_Key( uint32_t slot, uint32_t generation ) { return Make_Process_ID( slot, generation ); }
+
+	static EProcessID Get_Invalid_Key( void ) { return EProcessID::INVALID; }
+	static uint32_t Get_First_Free_Slot( void ) { return Get_Process_ID_Slot( EProcessID::FIRST_FREE_ID ); }
+};
+
+// A dense table of per-process values, indexed by the slot encoded in a process ID.  A lookup is a bounds check, an array
+// index and a generation compare; an ID whose slot has since been released, and possibly reused, finds nothing.
+// The interface mirrors the subset of std::unordered_map< EProcessID, T > that the process tables use.
+//
+// Every table can store values for any ID, but only the table that allocates IDs (the concurrency manager's record table)
+// hands out slots; all other tables are keyed by the IDs it produced.
+//
+// Other slot-encoded IDs (see TSlotKeyTraits) can key a table as well; a process's outstanding requests are one.
+template< typename T, typename KeyType = EProcessID >
+class TProcessSlotTable
+{
+	private:
+
+		using KeyTraits = TSlotKeyTraits< KeyType >;
+
+		struct SSlot
+		{
+			SSlot( void ) :
+				Entry( KeyTraits::Get_Invalid_Key(), T() ),
+				Occupied( false )
+			{}
+
+			std::pair< KeyType, T > Entry;
+			bool Occupied;
+		};
+
+		using SlotVectorType = std::vector< SSlot >;
+
+	public:
+
+		using value_type = std::pair< KeyType, T >;
+
+		// Iterates occupied slots in slot order
+		template< typename SlotIterator, typename Value >
+		class TIterator
+		{
+			public:
+
+				TIterator( SlotIterator current, SlotIterator end ) :
+					Current( current ),
+					End( end )
+				{
+					Skip_Empty_Slots();
+				}
+
+				// Mutable iterators convert to const ones, as with the standard containers
+				template< typename OtherSlotIterator, typename OtherValue >
+				TIterator( const TIterator< OtherSlotIterator, OtherValue > &rhs ) :
+					Current( rhs.Current ),
+					End( rhs.End )
+				{}
+
+				Value &operator *( void ) const { return Current->Entry; }
+				Value *operator ->( void ) const { return &Current->Entry; }
+
+				TIterator &operator ++( void )
+				{
+					++Current;
+					Skip_Empty_Slots();
+
+					return *this;
+				}
+
+				template< typename OtherSlotIterator, typename OtherValue >
+				bool operator ==( const TIterator< OtherSlotIterator, OtherValue > &rhs ) const { return Current == rhs.Current; }
+
+				template< typename OtherSlotIterator, typename OtherValue >
+				bool operator !=( const TIterator< OtherSlotIterator, OtherValue > &rhs ) const { return Current != rhs.Current; }
+
+			private:
+
+				friend class TProcessSlotTable;
+
+				template< typename OtherSlotIterator, typename OtherValue >
+				friend class TIterator;
+
+				void Skip_Empty_Slots( void )
+				{
+					while ( Current != End && !Current->Occupied )
+					{
+						++Current;
+					}
+				}
+
+				SlotIterator Current;
+				SlotIterator End;
+		};
+
+		using iterator = TIterator< typename SlotVectorType::iterator, value_type >;
+		using const_iterator = TIterator< typename SlotVectorType::const_iterator, const value_type >;
+
+		TProcessSlotTable( void ) :
+			Slots(),
+			FreeSlots(),
+			NextFreshSlot( KeyTraits::Get_First_Free_Slot() ),
+			Count( 0 )
+		{}
+
+		// Returns an ID for an unused slot, preferring released ones; the caller is expected to insert under it
+		KeyType Allocate_ID( void )
+		{
+			if ( FreeSlots.empty() )
+			{
+				return KeyTraits::Make_Key( NextFreshSlot++, 0 );
+			}
+
+			uint32_t slot_index = FreeSlots.back();
+			FreeSlots.pop_back();
+
+			// Released slots keep their last ID, so the next generation follows from it
+			return KeyTraits::Make_Key( slot_index, KeyTraits::Get_Generation( Slots[ slot_index ].Entry.first ) + 1 );
+		}
+
+		std::pair< iterator, bool > insert( const value_type &value )
+		{
+			uint32_t slot_index = KeyTraits::Get_Slot( value.first );
+			FATAL_ASSERT( value.first != KeyTraits::Get_Invalid_Key() );
+
+			if ( slot_index >= Slots.size() )
+			{
+				Slots.resize( slot_index + 1 );
+			}
+
+			SSlot &slot = Slots[ slot_index ];
+			if ( slot.Occupied )
+			{
+				// a live slot must never be claimed by another generation
+				FATAL_ASSERT( slot.Entry.first == value.first );
+				return std::make_pair( iterator( Slots.begin() + slot_index, Slots.end() ), false );
+			}
+
+			slot.Entry = value;
+			slot.Occupied = true;
+			++Count;
+
+			return std::make_pair( iterator( Slots.begin() + slot_index, Slots.end() ), true );
+		}
+
+		T &operator []( KeyType key )
+		{
+			return insert( value_type( key, T() ) ).first->second;
+		}
+
+		iterator find( KeyType key )
+		{
+			uint32_t slot_index = KeyTraits::Get_Slot( key );
+			if ( slot_index < Slots.size() && Slots[ slot_index ].Occupied && Slots[ slot_index ].Entry.first == key )
+			{
+				return iterator( Slots.begin() + slot_index, Slots.end() );
+			}
+
+			return end();
+		}
+
+		const_iterator find( KeyType key ) const
+		{
+			uint32_t slot_index = KeyTraits::Get_Slot( key );
+			if ( slot_index < Slots.size() && Slots[ slot_index ].Occupied && Slots[ slot_index ].Entry.first == key )
+			{
+				return const_iterator( Slots.cbegin() + slot_index, Slots.cend() );
+			}
+
+			return cend();
+		}
+
+		void erase( iterator iter )
+		{
+			Release_Slot( *iter.Current );
+		}
+
+		size_t erase( KeyType key )
+		{
+			auto iter = find( key );
+			if ( iter == end() )
+			{
+				return 0;
+			}
+
+			erase( iter );
+			return 1;
+		}
+
+		void clear( void )
+		{
+			for ( auto iter = Slots.begin(), end = Slots.end(); iter != end; ++iter )
+			{
+				if ( iter->Occupied )
+				{
+					Release_Slot( *iter );
+				}
+			}
+		}
+
+		size_t size( void ) const { return Count; }
+		bool empty( void ) const { return Count == 0; }
+
+		iterator begin( void ) { return iterator( Slots.begin(), Slots.end() ); }
+		iterator end( void ) { return iterator( Slots.end(), Slots.end() ); }
+		const_iterator begin( void ) const { return cbegin(); }
+		const_iterator end( void ) const { return cend(); }
+		const_iterator cbegin( void ) const { return const_iterator( Slots.cbegin(), Slots.cend() ); }
+		const_iterator cend( void ) const { return const_iterator( Slots.cend(), Slots.cend() ); }
+
+	private:
+
+		void Release_Slot( SSlot &slot )
+		{
+			FATAL_ASSERT( slot.Occupied );
+
+			// keep the ID so the slot's next generation can be derived from it, but let go of the value now
+			slot.Entry.second = T();
+			slot.Occupied = false;
+			--Count;
+
+			// only slots this table handed out go back on its free list
+			uint32_t slot_index = KeyTraits::Get_Slot( slot.Entry.first );
+			if ( slot_index >= KeyTraits::Get_First_Free_Slot() && slot_index < NextFreshSlot )
+			{
+				FreeSlots.push_back( slot_index );
+			}
+		}
+
+		SlotVectorType Slots;
+
+		// Released slots, reused most recently released first
+		std::vector< uint32_t > FreeSlots;
+		uint32_t NextFreshSlot;
+
+		size_t Count;
+};
+
+} // namespace Execution
+} // namespace IP
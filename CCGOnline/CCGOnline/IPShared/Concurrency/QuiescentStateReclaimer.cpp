@@ -0,0 +1,140 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "QuiescentStateReclaimer.h"
+
+namespace IP
+{
+namespace Execution
+{
+
+CQuiescentStateReclaimer::CQuiescentStateReclaimer( void ) :
+	Epoch( 0 ),
+	RetiredLock(),
+	RetiredEntries()
+{
+	ActiveReaders[ 0 ].store( 0 );
+	ActiveReaders[ 1 ].store( 0 );
+}
+
+
+CQuiescentStateReclaimer::~CQuiescentStateReclaimer()
+{
+	FATAL_ASSERT( ActiveReaders[ 0 ].load() == 0 && ActiveReaders[ 1 ].load() == 0 );
+
+	for ( auto &entry : RetiredEntries )
+	{
+		entry.Reclaimer();
+	}
+
+	RetiredEntries.clear();
+}
+
+
+uint64_t CQuiescentStateReclaimer::Enter_Read_Section( void )
+{
+	for ( ;; )
+	{
+		uint64_t epoch = Epoch.load();
+		ActiveReaders[ epoch & 1 ].fetch_add( 1 );
+
+		// if the epoch moved on in between, the advancing writer may not have seen us; back out and join the new epoch
+		if ( Epoch.load() == epoch )
+		{
+			return epoch;
+		}
+
+		ActiveReaders[ epoch & 1 ].fetch_sub( 1 );
+	}
+}
+
+
+void CQuiescentStateReclaimer::Exit_Read_Section( uint64_t epoch )
+{
+	uint64_t previous = ActiveReaders[ epoch & 1 ].fetch_sub( 1 );
+	FATAL_ASSERT( previous > 0 );
+}
+
+
+void CQuiescentStateReclaimer::Retire( const ReclaimDelegateType &reclaimer )
+{
+	std::lock_guard< std::mutex > lock( RetiredLock );
+
+	RetiredEntries.push_back( SRetiredEntry( Epoch.load(), reclaimer ) );
+}
+
+
+bool CQuiescentStateReclaimer::Try_Advance_Epoch( void )
+{
+	uint64_t epoch = Epoch.load();
+
+	// the previous epoch shares a counter with the next one; it must drain before the epoch can move
+	if ( ActiveReaders[ ( epoch + 1 ) & 1 ].load() != 0 )
+	{
+		return false;
+	}
+
+	return Epoch.compare_exchange_strong( epoch, epoch + 1 );
+}
+
+
+uint32_t CQuiescentStateReclaimer::Reclaim( void )
+{
+	std::vector< SRetiredEntry > reclaimable;
+
+	{
+		std::lock_guard< std::mutex > lock( RetiredLock );
+		if ( RetiredEntries.empty() )
+		{
+			return 0;
+		}
+
+		// anything retired during epoch N was unreachable to readers entering N + 1, and those of N have drained once the epoch reaches N + 2
+		Try_Advance_Epoch();
+		Try_Advance_Epoch();
+
+		uint64_t epoch = Epoch.load();
+		auto partition_iter = std::partition( RetiredEntries.begin(), RetiredEntries.end(), [ epoch ]( const SRetiredEntry &entry ) { return entry.Epoch + 2 > epoch; } );
+
+		std::move( partition_iter, RetiredEntries.end(), std::back_inserter( reclaimable ) );
+		RetiredEntries.erase( partition_iter, RetiredEntries.end() );
+	}
+
+	// destroy outside the lock; reclaimers may retire further objects
+	for ( auto &entry : reclaimable )
+	{
+		entry.Reclaimer();
+	}
+
+	return static_cast< uint32_t >( reclaimable.size() );
+}
+
+
+size_t CQuiescentStateReclaimer::Get_Pending_Count( void ) const
+{
+	std::lock_guard< std::mutex > lock( RetiredLock );
+
+	return RetiredEntries.size();
+}
+
+} // namespace Execution
+} // namespace IP
@@ -0,0 +1,111 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+namespace IP
+{
+namespace Execution
+{
+
+// Defers the destruction of shared, read-mostly objects until no reader can still hold them.
+//
+// Readers bracket their use with Enter_Read_Section/Exit_Read_Section; both are a pair of atomic operations and never block.
+// The concurrency manager brackets every process service call this way, so a process that keeps no pointers across
+// frames is quiescent whenever it is not being serviced.  A writer swaps the published pointer and retires the old
+// object; the object is destroyed by a later Reclaim call once every read section that could have seen it has ended.
+class CQuiescentStateReclaimer
+{
+	public:
+
+		using ReclaimDelegateType = std::function< void( void ) >;
+
+		CQuiescentStateReclaimer( void );
+		~CQuiescentStateReclaimer();
+
+		uint64_t Enter_Read_Section( void );
+		void Exit_Read_Section( uint64_t epoch );
+
+		// Must be called after the retired object has been unpublished
+		void Retire( const ReclaimDelegateType &reclaimer );
+
+		template< typename T >
+		void Retire_Object( const T *object )
+		{
+			Retire( [ object ]( void ) { delete object; } );
+		}
+
+		// Destroys everything that is safe to destroy; returns the number of objects reclaimed
+		uint32_t Reclaim( void );
+
+		size_t Get_Pending_Count( void ) const;
+
+	private:
+
+		CQuiescentStateReclaimer( const CQuiescentStateReclaimer &rhs ) = delete;
+		CQuiescentStateReclaimer & operator =( const CQuiescentStateReclaimer &rhs ) = delete;
+
+		bool Try_Advance_Epoch( void );
+
+		struct SRetiredEntry
+		{
+			SRetiredEntry( uint64_t epoch, const ReclaimDelegateType &reclaimer ) :
+				Epoch( epoch ),
+				Reclaimer( reclaimer )
+			{}
+
+			uint64_t Epoch;
+			ReclaimDelegateType Reclaimer;
+		};
+
+		// readers announce themselves in the counter for the parity of the epoch they entered under
+		std::atomic< uint64_t > Epoch;
+		std::atomic< uint64_t > ActiveReaders[ 2 ];
+
+		mutable std::mutex RetiredLock;
+		std::vector< SRetiredEntry > RetiredEntries;
+};
+
+// Scoped read section
+class CQuiescentStateReadGuard
+{
+	public:
+
+		CQuiescentStateReadGuard( CQuiescentStateReclaimer *reclaimer ) :
+			Reclaimer( reclaimer ),
+			Epoch( reclaimer->Enter_Read_Section() )
+		{}
+
+		~CQuiescentStateReadGuard()
+		{
+			Reclaimer->Exit_Read_Section( Epoch );
+		}
+
+	private:
+
+		CQuiescentStateReadGuard( const CQuiescentStateReadGuard &rhs ) = delete;
+		CQuiescentStateReadGuard & operator =( const CQuiescentStateReadGuard &rhs ) = delete;
+
+		CQuiescentStateReclaimer *Reclaimer;
+		uint64_t Epoch;
+};
+
+} // namespace Execution
+} // namespace IP
@@ -56,8 +56,8 @@ class CTaskProcessBase : public CProcessBase
 
 	private:
 
-		friend class CTaskProcessBaseTester;
-		friend class CTaskProcessBaseExaminer;
+		friend class ::CTaskProcessBaseTester;
+		friend class ::CTaskProcessBaseExaminer;
 
 		// Private Data
 		// Timing
@@ -21,10 +21,12 @@
 
 #include "ThreadProcessBase.h"
 
+#include "IPPlatform/PlatformExceptionHandler.h"
 #include "IPPlatform/PlatformProcess.h"
 #include "IPPlatform/PlatformTime.h"
 #include "ProcessExecutionContext.h"
 #include "ProcessStatics.h"
+#include "QuiescentStateReclaimer.h"
 
 namespace IP
 {
@@ -34,7 +36,9 @@ namespace Execution
 CThreadProcessBase::CThreadProcessBase( const SProcessProperties &properties ) :
 	BASECLASS( properties ),
 	StartLock(),
-	ExecutionThread( nullptr )
+	ExecutionThread( nullptr ),
+	Reclaimer( nullptr ),
+	CurrentTimeSeconds( 0.0 )
 {
 }
 
@@ -44,12 +48,11 @@ CThreadProcessBase::~CThreadProcessBase()
 
 void CThreadProcessBase::Run( const CProcessExecutionContext &context )
 {
-	IP_UNREFERENCED_PARAM( context );
-
 	std::lock_guard< std::mutex > startLock( StartLock );
 
 	if ( ExecutionThread == nullptr )
 	{
+		Reclaimer = context.Get_Reclaimer();
 		ExecutionThread = std::make_unique< std::thread >( std::bind( &CThreadProcessBase::Thread_Function, this ) );
 	}
 }
@@ -64,23 +67,39 @@ void CThreadProcessBase::Finalize( void )
 
 void CThreadProcessBase::Thread_Function( void )
 {
+	IP::Debug::CPlatformExceptionHandler::Install_Thread_Signal_Stack();
+
 	while ( !Is_Shutting_Down() )
 	{
 		CProcessExecutionContext context;
 
+		// Sample the clock once per run; Get_Current_Process_Time() reads the cached value
+		CurrentTimeSeconds = IP::Time::Convert_Duration_To_Seconds( IP::Time::Get_Elapsed_Monotonic_Time() );
+
 		CProcessStatics::Set_Current_Process( this );
-		BASECLASS::Run( context );
+		if ( Reclaimer != nullptr )
+		{
+			// the process may read shared, reloadable data only while it is being serviced
+			CQuiescentStateReadGuard read_guard( Reclaimer );
+			BASECLASS::Run( context );
+		}
+		else
+		{
+			BASECLASS::Run( context );
+		}
 		CProcessStatics::Set_Current_Process( nullptr );
 		Flush_System_Messages();
 
 		std::this_thread::sleep_for( std::chrono::milliseconds( Get_Sleep_Interval_In_Milliseconds() ) );
 	}
+
+	IP::Debug::CPlatformExceptionHandler::Remove_Thread_Signal_Stack();
 }
 
 
 double CThreadProcessBase::Get_Current_Process_Time( void ) const
 {
-	return IP::Time::Convert_Duration_To_Seconds( IP::Time::Get_Elapsed_System_Time() );
+	return CurrentTimeSeconds;
 }
 
 } // namespace Execution
@@ -26,6 +26,8 @@ namespace IP
 namespace Execution
 {
 
+class CQuiescentStateReclaimer;
+
 // The shared logic level of all thread-based virtual processes; not instantiable
 class CThreadProcessBase : public CProcessBase
 {
@@ -53,13 +55,18 @@ class CThreadProcessBase : public CProcessBase
 
 		void Thread_Function( void );
 
-		friend class CProcessBaseTester;
-		friend class CProcessBaseExaminer;
+		friend class ::CProcessBaseTester;
+		friend class ::CProcessBaseExaminer;
 
 		// Private Data
 
 		std::mutex StartLock;
 		std::unique_ptr< std::thread > ExecutionThread;
+
+		CQuiescentStateReclaimer *Reclaimer;
+
+		// Timing
+		double CurrentTimeSeconds;
 };
 
 } // namespace Execution
@@ -22,6 +22,9 @@
 #include "EnumConversion.h"
 #include "IPPlatform/EnumUtils.h"
 #include "IPPlatform/StringUtils.h"
+#include "InternedString.h"
+
+using namespace IP::String;
 
 namespace IP
 {
@@ -35,6 +38,7 @@ class CConvertibleEnum
 
 		// Construction
 		CConvertibleEnum( const std::string &name, EConvertibleEnumProperties properties );
+		CConvertibleEnum( const SEnumTable &table );
 
 		// Accessors
 		const std::string &Get_Name( void ) const { return Name; }
@@ -49,9 +53,13 @@ class CConvertibleEnum
 
 	private:
 
-		bool Convert_Internal( const std::string &entry_name, uint64_t &output_value ) const;
+		bool Convert_Internal( const char *entry_name, uint32_t entry_length, uint64_t &output_value ) const;
 		bool Convert_Internal( uint64_t value, std::string &entry_name ) const;
 
+		const SEnumTableEntry *Find_Static_Entry( const char *entry_name, uint32_t entry_length ) const;
+		const SEnumTableEntry *Find_Static_Entry( uint64_t value ) const;
+		bool Decompose_Static_Bitfield( uint64_t value, std::string &mask_name ) const;
+
 		bool Convert_Bitfield_Internal( const std::string &mask_name, uint64_t &output_value ) const;
 		bool Convert_Bitfield_Internal( uint64_t value, std::string &mask_name ) const;
 
@@ -60,20 +68,46 @@ class CConvertibleEnum
 
 		EConvertibleEnumProperties Properties;
 
-		std::unordered_map< std::string, uint64_t > NameToValueTable;
-		std::unordered_map< uint64_t, std::string > ValueToNameTable;
+		// generated, sorted entries; entries registered at runtime go into the hash tables below
+		const SEnumTable *StaticTable;
+
+		// upper-cased entry names are interned, so both directions share one copy and name lookups hash by address
+		std::unordered_map< CInternedString, uint64_t, SInternedStringContainerHelper > NameToValueTable;
+		std::unordered_map< uint64_t, CInternedString > ValueToNameTable;
 };
 
 
 CConvertibleEnum::CConvertibleEnum( const std::string &name, EConvertibleEnumProperties properties ) :
 	Name( name ),
 	Properties( properties ),
+	StaticTable( nullptr ),
 	NameToValueTable(),
 	ValueToNameTable()
 {
 }
 
 
+CConvertibleEnum::CConvertibleEnum( const SEnumTable &table ) :
+	Name( table.Name ),
+	Properties( table.Properties ),
+	StaticTable( &table ),
+	NameToValueTable(),
+	ValueToNameTable()
+{
+	// the searches below depend on the generator's ordering; catch hand-edited or stale tables here rather than as missed lookups
+	for ( uint32_t i = 1; i < table.EntryCount; ++i )
+	{
+		FATAL_ASSERT( strcmp( table.EntriesByName[ i - 1 ].Name, table.EntriesByName[ i ].Name ) < 0 );
+		FATAL_ASSERT( table.EntriesByValue[ i - 1 ].Value < table.EntriesByValue[ i ].Value );
+	}
+
+	for ( uint32_t i = 1; i < table.BitEntryCount; ++i )
+	{
+		FATAL_ASSERT( table.BitEntries[ i - 1 ].Value < table.BitEntries[ i ].Value );
+	}
+}
+
+
 bool CConvertibleEnum::Convert( const std::string &entry_name, uint64_t &output_value ) const
 {
 	if ( Is_An_Enum_Flag_Set( Properties, EConvertibleEnumProperties::CEP_BITFIELD ) )
@@ -82,7 +116,7 @@ bool CConvertibleEnum::Convert( const std::string &entry_name, uint64_t &output_
 	}
 	else
 	{
-		return Convert_Internal( entry_name, output_value );
+		return Convert_Internal( entry_name.c_str(), static_cast< uint32_t >( entry_name.size() ), output_value );
 	}
 }
 
@@ -105,23 +139,111 @@ void CConvertibleEnum::Register_Entry( const std::string &entry_name, uint64_t v
 	std::string upper_entry_name;
 	IP::String::To_Upper_Case( entry_name, upper_entry_name );
 
-	auto name_iter = NameToValueTable.find( upper_entry_name );
+	if ( StaticTable != nullptr )
+	{
+		FATAL_ASSERT( Find_Static_Entry( upper_entry_name.c_str(), static_cast< uint32_t >( upper_entry_name.size() ) ) == nullptr );
+		FATAL_ASSERT( Find_Static_Entry( value ) == nullptr );
+	}
+
+	CInternedString interned_entry_name( upper_entry_name );
+
+	auto name_iter = NameToValueTable.find( interned_entry_name );
 	FATAL_ASSERT( name_iter == NameToValueTable.cend() );
 
 	auto value_iter = ValueToNameTable.find( value );
 	FATAL_ASSERT( value_iter == ValueToNameTable.cend() );
 
-	NameToValueTable[ upper_entry_name ] = value;
-	ValueToNameTable[ value ] = upper_entry_name;
+	NameToValueTable[ interned_entry_name ] = value;
+	ValueToNameTable[ value ] = interned_entry_name;
+}
+
+
+// Orders a case-insensitive, non-terminated name against an upper-cased table name the same way strcmp would
+static int32_t Compare_Entry_Name( const char *entry_name, uint32_t entry_length, const char *table_name )
+{
+	for ( uint32_t i = 0; i < entry_length; ++i )
+	{
+		unsigned char entry_char = static_cast< unsigned char >( ::toupper( static_cast< unsigned char >( entry_name[ i ] ) ) );
+		unsigned char table_char = static_cast< unsigned char >( table_name[ i ] );
+		if ( entry_char != table_char )
+		{
+			return entry_char < table_char ? -1 : 1;
+		}
+	}
+
+	return table_name[ entry_length ] == 0 ? 0 : -1;
+}
+
+
+const SEnumTableEntry *CConvertibleEnum::Find_Static_Entry( const char *entry_name, uint32_t entry_length ) const
+{
+	uint32_t lower = 0;
+	uint32_t upper = StaticTable->EntryCount;
+	while ( lower < upper )
+	{
+		uint32_t middle = lower + ( upper - lower ) / 2;
+		const SEnumTableEntry &entry = StaticTable->EntriesByName[ middle ];
+
+		int32_t comparison = Compare_Entry_Name( entry_name, entry_length, entry.Name );
+		if ( comparison == 0 )
+		{
+			return &entry;
+		}
+		else if ( comparison < 0 )
+		{
+			upper = middle;
+		}
+		else
+		{
+			lower = middle + 1;
+		}
+	}
+
+	return nullptr;
 }
 
 
-bool CConvertibleEnum::Convert_Internal( const std::string &entry_name, uint64_t &output_value ) const
+const SEnumTableEntry *CConvertibleEnum::Find_Static_Entry( uint64_t value ) const
 {
+	const SEnumTableEntry *entries_end = StaticTable->EntriesByValue + StaticTable->EntryCount;
+	const SEnumTableEntry *entry = std::lower_bound( StaticTable->EntriesByValue, entries_end, value, []( const SEnumTableEntry &lhs, uint64_t rhs ){ return lhs.Value < rhs; } );
+	if ( entry == entries_end || entry->Value != value )
+	{
+		return nullptr;
+	}
+
+	return entry;
+}
+
+
+bool CConvertibleEnum::Convert_Internal( const char *entry_name, uint32_t entry_length, uint64_t &output_value ) const
+{
+	if ( StaticTable != nullptr )
+	{
+		const SEnumTableEntry *entry = Find_Static_Entry( entry_name, entry_length );
+		if ( entry != nullptr )
+		{
+			output_value = entry->Value;
+			return true;
+		}
+	}
+
+	if ( NameToValueTable.empty() )
+	{
+		return false;
+	}
+
 	std::string upper_entry_name;
-	IP::String::To_Upper_Case( entry_name, upper_entry_name );
+	IP::String::To_Upper_Case( std::string( entry_name, entry_name + entry_length ), upper_entry_name );
 
-	auto iter = NameToValueTable.find( upper_entry_name );
+	// a name that was never interned cannot be an entry of any enum
+	CInternedString interned_entry_name;
+	if ( !CInternedString::Find( upper_entry_name, interned_entry_name ) )
+	{
+		return false;
+	}
+
+	auto iter = NameToValueTable.find( interned_entry_name );
 	if ( iter == NameToValueTable.cend() )
 	{
 		return false;
@@ -134,13 +256,23 @@ bool CConvertibleEnum::Convert_Internal( const std::string &entry_name, uint64_t
 
 bool CConvertibleEnum::Convert_Internal( uint64_t value, std::string &entry_name ) const
 {
+	if ( StaticTable != nullptr )
+	{
+		const SEnumTableEntry *entry = Find_Static_Entry( value );
+		if ( entry != nullptr )
+		{
+			entry_name = entry->Name;
+			return true;
+		}
+	}
+
 	auto iter = ValueToNameTable.find( value );
 	if ( iter == ValueToNameTable.cend() )
 	{
 		return false;
 	}
 
-	entry_name = iter->second;
+	entry_name = iter->second.Get();
 	return true;
 }
 
@@ -179,10 +311,8 @@ bool CConvertibleEnum::Convert_Bitfield_Internal( const std::string &mask_name,
 	{
 		uint32_t entry_end = Skip_Non_Separators( raw_characters, entry_start );
 
-		std::string entry( raw_characters + entry_start, raw_characters + entry_end );
 		uint64_t entry_value = 0;
-
-		if ( !Convert_Internal( entry, entry_value ) )
+		if ( !Convert_Internal( raw_characters + entry_start, entry_end - entry_start, entry_value ) )
 		{
 			return false;
 		}
@@ -203,6 +333,11 @@ bool CConvertibleEnum::Convert_Bitfield_Internal( uint64_t value, std::string &m
 		return Convert_Internal( value, mask_name );
 	}
 
+	if ( StaticTable != nullptr && ValueToNameTable.empty() )
+	{
+		return Decompose_Static_Bitfield( value, mask_name );
+	}
+
 	mask_name = "";
 	uint64_t value_iterator = value;
 	bool first_entry = true;
@@ -235,10 +370,37 @@ bool CConvertibleEnum::Convert_Bitfield_Internal( uint64_t value, std::string &m
 	return true;
 }
 
+bool CConvertibleEnum::Decompose_Static_Bitfield( uint64_t value, std::string &mask_name ) const
+{
+	if ( ( value & ~StaticTable->BitfieldMask ) != 0 )
+	{
+		return false;
+	}
+
+	mask_name.clear();
+	for ( uint32_t i = 0; i < StaticTable->BitEntryCount; ++i )
+	{
+		const SEnumTableEntry &bit_entry = StaticTable->BitEntries[ i ];
+		if ( ( value & bit_entry.Value ) == 0 )
+		{
+			continue;
+		}
+
+		if ( !mask_name.empty() )
+		{
+			mask_name.append( " | " );
+		}
+
+		mask_name.append( bit_entry.Name );
+	}
+
+	return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 CEnumConverter::EnumTableType CEnumConverter::Enums;
-std::unordered_map< std::string, CConvertibleEnum * > CEnumConverter::EnumsByName;
+CEnumConverter::EnumNameTableType CEnumConverter::EnumsByName;
 
 
 void CEnumConverter::Cleanup( void )
@@ -250,16 +412,29 @@ void CEnumConverter::Cleanup( void )
 
 
 void CEnumConverter::Register_Enum_Internal( const Loki::TypeInfo &enum_type_info, const std::string &enum_name, EConvertibleEnumProperties properties )
+{
+	Add_Enum( enum_type_info, new CConvertibleEnum( enum_name, properties ) );
+}
+
+
+void CEnumConverter::Register_Enum_Table_Internal( const Loki::TypeInfo &enum_type_info, const SEnumTable &table )
+{
+	Add_Enum( enum_type_info, new CConvertibleEnum( table ) );
+}
+
+
+void CEnumConverter::Add_Enum( const Loki::TypeInfo &enum_type_info, CConvertibleEnum *enum_object )
 {
 	FATAL_ASSERT( Enums.find( enum_type_info ) == Enums.cend() );
 
 	std::string upper_enum_name;
-	IP::String::To_Upper_Case( enum_name, upper_enum_name );
-	FATAL_ASSERT( EnumsByName.find( upper_enum_name ) == EnumsByName.cend() );
+	IP::String::To_Upper_Case( enum_object->Get_Name(), upper_enum_name );
+
+	CInternedString interned_enum_name( upper_enum_name );
+	FATAL_ASSERT( EnumsByName.find( interned_enum_name ) == EnumsByName.cend() );
 
-	CConvertibleEnum *enum_object = new CConvertibleEnum( enum_name, properties );
 	Enums[ enum_type_info ] = enum_object;
-	EnumsByName[ upper_enum_name ] = enum_object;
+	EnumsByName[ interned_enum_name ] = enum_object;
 }
 
 		
@@ -289,7 +464,13 @@ CConvertibleEnum *CEnumConverter::Find_Enum( const std::string &enum_name )
 	std::string upper_enum_name;
 	IP::String::To_Upper_Case( enum_name, upper_enum_name );
 
-	auto iter = EnumsByName.find( upper_enum_name );
+	CInternedString interned_enum_name;
+	if ( !CInternedString::Find( upper_enum_name, interned_enum_name ) )
+	{
+		return nullptr;
+	}
+
+	auto iter = EnumsByName.find( interned_enum_name );
 	if ( iter == EnumsByName.end() )
 	{
 		return nullptr;
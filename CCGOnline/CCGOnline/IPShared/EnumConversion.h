@@ -19,6 +19,9 @@
 
 #pragma once
 
+#include "IPShared/InternedString.h"
+#include "IPPlatform/StringUtils.h"
+
 namespace IP
 {
 namespace Enum
@@ -30,6 +33,31 @@ enum class EConvertibleEnumProperties
 	CEP_BITFIELD				= 1 << 0,
 };
 
+// One entry of a generated enum table; names are stored upper-cased
+struct SEnumTableEntry
+{
+	const char *Name;
+	uint64_t Value;
+};
+
+// Statically-initialized conversion data for a single enum, emitted by the EnumReflector.
+// EntriesByName is sorted by (byte-wise) name and EntriesByValue by value so that both directions are binary searches.
+// For bitfields, BitEntries lists the single-bit entries in ascending bit order and BitfieldMask is their union,
+// which lets a mask be decomposed into names without any searching.
+struct SEnumTable
+{
+	const char *Name;
+	EConvertibleEnumProperties Properties;
+
+	const SEnumTableEntry *EntriesByName;
+	const SEnumTableEntry *EntriesByValue;
+	uint32_t EntryCount;
+
+	const SEnumTableEntry *BitEntries;
+	uint32_t BitEntryCount;
+	uint64_t BitfieldMask;
+};
+
 class CConvertibleEnum;
 
 // A simple static class with registration and conversion functions for enums
@@ -49,6 +77,13 @@ class CEnumConverter
 			Register_Enum_Internal( Loki::TypeInfo( typeid( T ) ), enum_name, properties );
 		}
 
+		// The table is referenced, not copied, and must outlive the converter
+		template < typename T >
+		static void Register_Enum_Table( const SEnumTable &table )
+		{
+			Register_Enum_Table_Internal( Loki::TypeInfo( typeid( T ) ), table );
+		}
+
 		template < typename T >
 		static void Register_Enum_Entry( const std::string &entry_name, T entry_value )
 		{
@@ -98,6 +133,9 @@ class CEnumConverter
 		static CConvertibleEnum *Find_Enum( const std::string &enum_name );
 
 		static void Register_Enum_Internal( const Loki::TypeInfo &enum_type_info, const std::string &upper_enum_name, EConvertibleEnumProperties properties );
+		static void Add_Enum( const Loki::TypeInfo &enum_type_info, CConvertibleEnum *enum_object );
+
+		static void Register_Enum_Table_Internal( const Loki::TypeInfo &enum_type_info, const SEnumTable &table );
 		static void Register_Enum_Entry_Internal( const Loki::TypeInfo &enum_type_info, const std::string &entry_name, uint64_t entry_value );
 
 		static bool Convert_Internal( const Loki::TypeInfo &enum_type_info, uint64_t value, std::string &entry_name );
@@ -105,9 +143,10 @@ class CEnumConverter
 		static bool Convert_Internal( const Loki::TypeInfo &enum_type_info, const std::string &entry_name, uint64_t &output_value );
 
 		using EnumTableType = std::unordered_map< Loki::TypeInfo, CConvertibleEnum *, STypeInfoContainerHelper >;
+		using EnumNameTableType = std::unordered_map< IP::String::CInternedString, CConvertibleEnum *, IP::String::SInternedStringContainerHelper >;
 
 		static EnumTableType Enums;
-		static std::unordered_map< std::string, CConvertibleEnum * > EnumsByName;
+		static EnumNameTableType EnumsByName;
 };
 
 } // namespace Enum
@@ -0,0 +1,205 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "InternedString.h"
+
+namespace IP
+{
+namespace String
+{
+
+// An insert-only hash set of strings.  Buckets are singly-linked lists whose nodes are never modified or freed once
+// published, so readers walk them with plain acquire loads; writers publish new nodes at the head with a
+// compare-and-swap and re-check anything that raced in ahead of them.
+template< typename C >
+class TStringInternTable
+{
+	public:
+
+		using StringType = std::basic_string< C >;
+
+		TStringInternTable( void ) :
+			Count( 0 )
+		{
+			for ( uint32_t i = 0; i < BUCKET_COUNT; ++i )
+			{
+				Buckets[ i ].store( nullptr );
+			}
+		}
+
+		// process lifetime; nothing is released
+
+		const StringType *Intern( const C *characters, size_t length )
+		{
+			uint64_t hash = Hash( characters, length );
+			std::atomic< SNode * > &bucket = Buckets[ hash & ( BUCKET_COUNT - 1 ) ];
+
+			SNode *head = bucket.load( std::memory_order_acquire );
+			const StringType *existing = Find_In_Chain( head, nullptr, hash, characters, length );
+			if ( existing != nullptr )
+			{
+				return existing;
+			}
+
+			SNode *node = new SNode( hash, characters, length );
+			for ( ;; )
+			{
+				node->Next = head;
+
+				SNode *expected = head;
+				if ( bucket.compare_exchange_weak( expected, node, std::memory_order_release, std::memory_order_acquire ) )
+				{
+					Count.fetch_add( 1 );
+					return &node->Value;
+				}
+
+				// only the nodes pushed since our last look can hold a match
+				existing = Find_In_Chain( expected, head, hash, characters, length );
+				if ( existing != nullptr )
+				{
+					delete node;
+					return existing;
+				}
+
+				head = expected;
+			}
+		}
+
+		const StringType *Find( const C *characters, size_t length ) const
+		{
+			uint64_t hash = Hash( characters, length );
+
+			return Find_In_Chain( Buckets[ hash & ( BUCKET_COUNT - 1 ) ].load( std::memory_order_acquire ), nullptr, hash, characters, length );
+		}
+
+		size_t Get_Count( void ) const { return Count.load(); }
+
+	private:
+
+		static const uint32_t BUCKET_COUNT = 1 << 14;
+
+		struct SNode
+		{
+			SNode( uint64_t hash, const C *characters, size_t length ) :
+				Hash( hash ),
+				Value( characters, length ),
+				Next( nullptr )
+			{}
+
+			uint64_t Hash;
+			StringType Value;
+			SNode *Next;
+		};
+
+		static uint64_t Hash( const C *characters, size_t length )
+		{
+			uint64_t hash = 0xCBF29CE484222325ULL;
+			for ( size_t i = 0; i < length; ++i )
+			{
+				hash ^= static_cast< uint64_t >( static_cast< typename std::make_unsigned< C >::type >( characters[ i ] ) );
+				hash *= 0x100000001B3ULL;
+			}
+
+			return hash ^ ( hash >> 32 );
+		}
+
+		static const StringType *Find_In_Chain( const SNode *node, const SNode *stop, uint64_t hash, const C *characters, size_t length )
+		{
+			for ( ; node != stop; node = node->Next )
+			{
+				if ( node->Hash == hash && node->Value.size() == length && std::char_traits< C >::compare( node->Value.data(), characters, length ) == 0 )
+				{
+					return &node->Value;
+				}
+			}
+
+			return nullptr;
+		}
+
+		std::atomic< SNode * > Buckets[ BUCKET_COUNT ];
+		std::atomic< size_t > Count;
+};
+
+// Function-local so that strings interned by static initializers in other translation units find a constructed table
+static TStringInternTable< char > &Get_Intern_Table( const char * )
+{
+	static TStringInternTable< char > NarrowInternTable;
+
+	return NarrowInternTable;
+}
+
+static TStringInternTable< wchar_t > &Get_Intern_Table( const wchar_t * )
+{
+	static TStringInternTable< wchar_t > WideInternTable;
+
+	return WideInternTable;
+}
+
+
+template< typename C >
+const typename TInternedString< C >::StringType TInternedString< C >::EmptyString;
+
+
+template< typename C >
+const typename TInternedString< C >::StringType *TInternedString< C >::Intern( const C *characters, size_t length )
+{
+	if ( length == 0 )
+	{
+		return nullptr;
+	}
+
+	return Get_Intern_Table( characters ).Intern( characters, length );
+}
+
+
+template< typename C >
+bool TInternedString< C >::Find( const StringType &value, TInternedString &handle )
+{
+	if ( value.empty() )
+	{
+		handle = TInternedString();
+		return true;
+	}
+
+	const StringType *interned_value = Get_Intern_Table( value.c_str() ).Find( value.c_str(), value.size() );
+	if ( interned_value == nullptr )
+	{
+		return false;
+	}
+
+	handle.Value = interned_value;
+	return true;
+}
+
+
+template< typename C >
+size_t TInternedString< C >::Get_Interned_Count( void )
+{
+	return Get_Intern_Table( static_cast< const C * >( nullptr ) ).Get_Count();
+}
+
+
+template class TInternedString< char >;
+template class TInternedString< wchar_t >;
+
+} // namespace String
+} // namespace IP
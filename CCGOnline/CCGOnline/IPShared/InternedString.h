@@ -0,0 +1,91 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+namespace IP
+{
+namespace String
+{
+
+// A handle to an immutable string shared by every holder of an equal value.  Interned strings live for the rest of the
+// process, so handles may be copied freely and compared or hashed by address.  Looking up an already-interned value
+// never blocks; adding a new one is lock-free as well, so handles may be created from any thread.
+template< typename C >
+class TInternedString
+{
+	public:
+
+		using StringType = std::basic_string< C >;
+
+		TInternedString( void ) :
+			Value( nullptr )
+		{}
+
+		explicit TInternedString( const StringType &value ) :
+			Value( Intern( value.c_str(), value.size() ) )
+		{}
+
+		explicit TInternedString( const C *value ) :
+			Value( Intern( value, std::char_traits< C >::length( value ) ) )
+		{}
+
+		TInternedString( const C *characters, size_t length ) :
+			Value( Intern( characters, length ) )
+		{}
+
+		// Looks the value up without interning it; returns false if no handle to it has ever been created
+		static bool Find( const StringType &value, TInternedString &handle );
+
+		static size_t Get_Interned_Count( void );
+
+		const StringType &Get( void ) const { return Value != nullptr ? *Value : EmptyString; }
+		const C *c_str( void ) const { return Get().c_str(); }
+		bool Is_Empty( void ) const { return Value == nullptr; }
+
+		size_t Get_Hash( void ) const { return reinterpret_cast< size_t >( Value ); }
+
+		bool operator ==( const TInternedString &rhs ) const { return Value == rhs.Value; }
+		bool operator !=( const TInternedString &rhs ) const { return Value != rhs.Value; }
+
+	private:
+
+		// the empty string is never stored; every empty handle is null
+		static const StringType *Intern( const C *characters, size_t length );
+
+		const StringType *Value;
+
+		static const StringType EmptyString;
+};
+
+using CInternedString = TInternedString< char >;
+using CInternedWideString = TInternedString< wchar_t >;
+
+// A helper policy class that allows interned strings to key STL hash containers.
+struct SInternedStringContainerHelper
+{
+	public:
+
+		template< typename C >
+		size_t operator()( const TInternedString< C > &key_value ) const { return key_value.Get_Hash(); }
+};
+
+} // namespace String
+} // namespace IP
@@ -34,6 +34,7 @@
 #include "LogInterface.h"
 #include "IPPlatform/PlatformTime.h"
 #include "IPPlatform/PlatformProcess.h"
+#include "IPPlatform/PlatformFileSystem.h"
 
 using namespace IP::Enum;
 using namespace IP::Logging;
@@ -62,7 +63,7 @@ class CLogFile
 
 		void Initialize( void )
 		{
-			File = new std::basic_ofstream< wchar_t >( FileName.c_str(), std::ios_base::out | std::ios_base::trunc );
+			File = new std::basic_ofstream< wchar_t >( IP::File::Get_Native_Path( FileName ).c_str(), std::ios_base::out | std::ios_base::trunc );
 		}
 
 		void Shutdown( void )
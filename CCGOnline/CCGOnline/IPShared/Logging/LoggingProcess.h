@@ -23,10 +23,7 @@
 
 #include "IPPlatform/PlatformTime.h"
 
-namespace EProcessSubject
-{
-	enum Enum;
-}
+#include "IPShared/Concurrency/ProcessSubject.h"
 
 namespace IP
 {
@@ -26,7 +26,7 @@ namespace IP
 namespace Execution
 {
 
-enum class EProcessID;
+enum class EProcessID : uint64_t;
 
 namespace Messaging
 {
@@ -67,6 +67,44 @@ class TProcessMessageHandler : public IProcessMessageHandler
 			MessageHandler( source_process_id, down_cast_message );
 		}
 
+		virtual void Handle_Shared_Message( EProcessID /*source_process_id*/, const std::shared_ptr< const IProcessMessage > & /*message*/ ) const override
+		{
+			// this handler takes ownership of its messages; multicast message types must use a shared handler
+			FATAL_ASSERT( false );
+		}
+
+	private:
+
+		HandlerFunctorType MessageHandler;
+};
+
+// Handler for message types that may be multicast; unicast messages are converted to shared ownership on the way in
+template< typename MessageType >
+class TSharedProcessMessageHandler : public IProcessMessageHandler
+{
+	public:
+
+		// signature of the actual handling function for a specific message type
+		using HandlerFunctorType = FastDelegate2< IP::Execution::EProcessID, const std::shared_ptr< const MessageType > &, void >;
+
+		using BASECLASS = IProcessMessageHandler;
+
+		TSharedProcessMessageHandler( const HandlerFunctorType &message_handler ) :
+			BASECLASS(),
+			MessageHandler( message_handler )
+		{}
+
+		virtual void Handle_Message( EProcessID source_process_id, std::unique_ptr< const IProcessMessage > &message ) const override
+		{
+			std::shared_ptr< const MessageType > shared_message( static_cast< const MessageType * >( message.release() ) );
+			MessageHandler( source_process_id, shared_message );
+		}
+
+		virtual void Handle_Shared_Message( EProcessID source_process_id, const std::shared_ptr< const IProcessMessage > &message ) const override
+		{
+			MessageHandler( source_process_id, std::static_pointer_cast< const MessageType >( message ) );
+		}
+
 	private:
 
 		HandlerFunctorType MessageHandler;
@@ -75,7 +113,14 @@ class TProcessMessageHandler : public IProcessMessageHandler
 template < typename T, typename U >
 void Register_This_Handler( U* registry, void (U::*handler_function)( IP::Execution::EProcessID, std::unique_ptr< const T > & ) )
 {
-	std::unique_ptr< IProcessMessageHandler > handler( new TProcessMessageHandler< T >( TProcessMessageHandler< T >::HandlerFunctorType( registry, handler_function ) ) );
+	std::unique_ptr< IProcessMessageHandler > handler( new TProcessMessageHandler< T >( typename TProcessMessageHandler< T >::HandlerFunctorType( registry, handler_function ) ) );
+	registry->Register_Handler( typeid( T ), handler );
+}
+
+template < typename T, typename U >
+void Register_This_Handler( U* registry, void (U::*handler_function)( IP::Execution::EProcessID, const std::shared_ptr< const T > & ) )
+{
+	std::unique_ptr< IProcessMessageHandler > handler( new TSharedProcessMessageHandler< T >( typename TSharedProcessMessageHandler< T >::HandlerFunctorType( registry, handler_function ) ) );
 	registry->Register_Handler( typeid( T ), handler );
 }
 
@@ -26,7 +26,7 @@ namespace IP
 namespace Execution
 {
 
-enum class EProcessID;
+enum class EProcessID : uint64_t;
 
 namespace Messaging
 {
@@ -46,6 +46,9 @@ class IProcessMessageHandler : public IP::IMessageHandler< EProcessID, IProcessM
 
 		virtual ~IProcessMessageHandler() = default;
 
+		// Multicast payloads are shared by every destination, so they cannot be handed over by unique_ptr
+		virtual void Handle_Shared_Message( EProcessID source_process_id, const std::shared_ptr< const IProcessMessage > &message ) const = 0;
+
 };
 
 } // namespace Messaging
@@ -0,0 +1,266 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include <cwctype>
+
+namespace IP
+{
+namespace Algorithm
+{
+
+// A read-mostly map from case-insensitive wide string keys to values, built as a minimal perfect hash (hash and displace).
+// Every key hashes to its own slot, so a lookup is one pass over the probe string to hash it plus one in-place,
+// case-folding comparison against the single candidate; nothing is allocated.  Insertion rebuilds the whole table and is
+// intended for small key sets that are fixed once registration finishes.
+template< typename V >
+class TCaseInsensitivePerfectHashTable
+{
+	public:
+
+		TCaseInsensitivePerfectHashTable( void ) :
+			Entries(),
+			Displacements(),
+			Slots()
+		{}
+
+		void Insert( const std::wstring &key, const V &value )
+		{
+			FATAL_ASSERT( Find( key.c_str() ) == nullptr );
+
+			std::wstring folded_key( key );
+			std::transform( folded_key.begin(), folded_key.end(), folded_key.begin(), Fold_Character );
+
+			Entries.push_back( SEntry( folded_key, value ) );
+
+			Rebuild();
+		}
+
+		const V *Find( const wchar_t *key ) const
+		{
+			if ( Entries.empty() )
+			{
+				return nullptr;
+			}
+
+			size_t key_length = 0;
+			uint64_t hash = Hash( key, key_length );
+
+			const SEntry &entry = Entries[ Slots[ Get_Slot( hash ) ] ];
+			if ( entry.Key.size() != key_length )
+			{
+				return nullptr;
+			}
+
+			for ( size_t i = 0; i < key_length; ++i )
+			{
+				if ( entry.Key[ i ] != Fold_Character( key[ i ] ) )
+				{
+					return nullptr;
+				}
+			}
+
+			return &entry.Value;
+		}
+
+		size_t Size( void ) const { return Entries.size(); }
+
+		static bool Equals_Case_Insensitive( const wchar_t *lhs, const wchar_t *rhs )
+		{
+			for ( ; *lhs != 0 && *rhs != 0; ++lhs, ++rhs )
+			{
+				if ( Fold_Character( *lhs ) != Fold_Character( *rhs ) )
+				{
+					return false;
+				}
+			}
+
+			return *lhs == *rhs;
+		}
+
+	private:
+
+		struct SEntry
+		{
+			public:
+
+				SEntry( const std::wstring &key, const V &value ) :
+					Key( key ),
+					Value( value )
+				{}
+
+				std::wstring Key;
+				V Value;
+		};
+
+		static wchar_t Fold_Character( wchar_t character )
+		{
+			if ( character < 0x80 )
+			{
+				return ( character >= L'a' && character <= L'z' ) ? static_cast< wchar_t >( character - L'a' + L'A' ) : character;
+			}
+
+			return static_cast< wchar_t >( towupper( character ) );
+		}
+
+		// 64 bit FNV-1a over the folded characters; the high half picks a bucket and the low half seeds the slot hash
+		static uint64_t Hash( const wchar_t *key, size_t &length )
+		{
+			uint64_t hash = 14695981039346656037ULL;
+
+			const wchar_t *current = key;
+			for ( ; *current != 0; ++current )
+			{
+				hash ^= static_cast< uint64_t >( Fold_Character( *current ) );
+				hash *= 1099511628211ULL;
+			}
+
+			length = static_cast< size_t >( current - key );
+
+			// FNV leaves the high bits poorly mixed for keys that differ only near the end, so finish with an avalanche step
+			hash ^= hash >> 33;
+			hash *= 0xFF51AFD7ED558CCDULL;
+			hash ^= hash >> 33;
+			hash *= 0xC4CEB9FE1A85EC53ULL;
+			hash ^= hash >> 33;
+
+			return hash;
+		}
+
+		static uint32_t Displace( uint64_t hash, int32_t displacement )
+		{
+			uint32_t value = static_cast< uint32_t >( hash ) ^ ( static_cast< uint32_t >( displacement ) * 0x9E3779B9U );
+
+			value ^= value >> 16;
+			value *= 0x85EBCA6BU;
+			value ^= value >> 13;
+			value *= 0xC2B2AE35U;
+			value ^= value >> 16;
+
+			return value;
+		}
+
+		uint32_t Get_Bucket( uint64_t hash ) const
+		{
+			return static_cast< uint32_t >( ( hash >> 32 ) % Displacements.size() );
+		}
+
+		// Negative displacements place a single-key bucket directly into slot ( -displacement - 1 )
+		uint32_t Get_Slot( uint64_t hash ) const
+		{
+			int32_t displacement = Displacements[ Get_Bucket( hash ) ];
+			if ( displacement < 0 )
+			{
+				return static_cast< uint32_t >( -displacement - 1 );
+			}
+
+			return Displace( hash, displacement ) % static_cast< uint32_t >( Slots.size() );
+		}
+
+		void Rebuild( void )
+		{
+			static const uint32_t INVALID_SLOT_ENTRY = 0xFFFFFFFF;
+			static const int32_t MAX_DISPLACEMENT = 1 << 24;
+
+			uint32_t entry_count = static_cast< uint32_t >( Entries.size() );
+
+			Displacements.assign( entry_count, 0 );
+			Slots.assign( entry_count, INVALID_SLOT_ENTRY );
+
+			std::vector< uint64_t > hashes( entry_count );
+			std::vector< std::vector< uint32_t > > buckets( entry_count );
+			for ( uint32_t i = 0; i < entry_count; ++i )
+			{
+				size_t key_length = 0;
+				hashes[ i ] = Hash( Entries[ i ].Key.c_str(), key_length );
+				buckets[ Get_Bucket( hashes[ i ] ) ].push_back( i );
+			}
+
+			std::vector< uint32_t > bucket_order( entry_count );
+			for ( uint32_t i = 0; i < entry_count; ++i )
+			{
+				bucket_order[ i ] = i;
+			}
+
+			// place the most crowded buckets first, while the table is still mostly empty
+			std::stable_sort( bucket_order.begin(), bucket_order.end(), [ & ]( uint32_t lhs, uint32_t rhs ){ return buckets[ lhs ].size() > buckets[ rhs ].size(); } );
+
+			std::vector< uint32_t > candidate_slots;
+			uint32_t next_free_slot = 0;
+			for ( auto bucket_index : bucket_order )
+			{
+				const auto &bucket = buckets[ bucket_index ];
+				if ( bucket.empty() )
+				{
+					break;
+				}
+
+				if ( bucket.size() == 1 )
+				{
+					while ( Slots[ next_free_slot ] != INVALID_SLOT_ENTRY )
+					{
+						++next_free_slot;
+					}
+
+					Slots[ next_free_slot ] = bucket[ 0 ];
+					Displacements[ bucket_index ] = -static_cast< int32_t >( next_free_slot ) - 1;
+					continue;
+				}
+
+				bool placed = false;
+				for ( int32_t displacement = 1; !placed && displacement < MAX_DISPLACEMENT; ++displacement )
+				{
+					candidate_slots.clear();
+					for ( auto entry_index : bucket )
+					{
+						uint32_t slot = Displace( hashes[ entry_index ], displacement ) % entry_count;
+						if ( Slots[ slot ] != INVALID_SLOT_ENTRY || std::find( candidate_slots.cbegin(), candidate_slots.cend(), slot ) != candidate_slots.cend() )
+						{
+							break;
+						}
+
+						candidate_slots.push_back( slot );
+					}
+
+					if ( candidate_slots.size() == bucket.size() )
+					{
+						for ( size_t i = 0; i < bucket.size(); ++i )
+						{
+							Slots[ candidate_slots[ i ] ] = bucket[ i ];
+						}
+
+						Displacements[ bucket_index ] = displacement;
+						placed = true;
+					}
+				}
+
+				FATAL_ASSERT( placed );
+			}
+		}
+
+		std::vector< SEntry > Entries;
+
+		std::vector< int32_t > Displacements;
+		std::vector< uint32_t > Slots;
+};
+
+} // namespace Algorithm
+} // namespace IP
@@ -0,0 +1,47 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+namespace IP
+{
+namespace Serialization
+{
+namespace Binary
+{
+
+class CBinaryReader;
+class CBinaryWriter;
+
+class IBinarySerializer
+{
+	public:
+
+		IBinarySerializer( void ) {}
+		virtual ~IBinarySerializer() {}
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const = 0;
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const = 0;
+
+};
+
+} // namespace Binary
+} // namespace Serialization
+} // namespace IP
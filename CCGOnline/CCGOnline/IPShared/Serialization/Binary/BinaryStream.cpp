@@ -0,0 +1,109 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPShared/Serialization/Binary/BinaryStream.h"
+
+namespace IP
+{
+namespace Serialization
+{
+namespace Binary
+{
+
+CBinaryWriter::CBinaryWriter( void ) :
+	Buffer()
+{
+}
+
+void CBinaryWriter::Write_Varint( uint64_t value )
+{
+	while ( value >= 0x80 )
+	{
+		Buffer.push_back( static_cast< uint8_t >( value | 0x80 ) );
+		value >>= 7;
+	}
+
+	Buffer.push_back( static_cast< uint8_t >( value ) );
+}
+
+void CBinaryWriter::Write_Bytes( const void *data, size_t length )
+{
+	const uint8_t *bytes = static_cast< const uint8_t * >( data );
+
+	Buffer.insert( Buffer.end(), bytes, bytes + length );
+}
+
+CBinaryReader::CBinaryReader( const void *data, size_t length ) :
+	Current( static_cast< const uint8_t * >( data ) ),
+	End( static_cast< const uint8_t * >( data ) + length ),
+	Failed( false )
+{
+}
+
+uint64_t CBinaryReader::Read_Varint( void )
+{
+	if ( Failed )
+	{
+		return 0;
+	}
+
+	uint64_t value = 0;
+	for ( uint32_t shift = 0; ; shift += 7 )
+	{
+		// truncated, or more continuation bytes than a 64-bit value can hold
+		if ( shift >= 64 || Current == End )
+		{
+			Fail();
+			return 0;
+		}
+
+		uint8_t byte = *Current++;
+		value |= static_cast< uint64_t >( byte & 0x7F ) << shift;
+		if ( ( byte & 0x80 ) == 0 )
+		{
+			return value;
+		}
+	}
+}
+
+const uint8_t *CBinaryReader::Read_Bytes( size_t length )
+{
+	if ( Failed )
+	{
+		return nullptr;
+	}
+
+	if ( length > Get_Remaining() )
+	{
+		Fail();
+		return nullptr;
+	}
+
+	const uint8_t *bytes = Current;
+	Current += length;
+
+	return bytes;
+}
+
+} // namespace Binary
+} // namespace Serialization
+} // namespace IP
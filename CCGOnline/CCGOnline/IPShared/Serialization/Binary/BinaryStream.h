@@ -0,0 +1,139 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+namespace IP
+{
+namespace Serialization
+{
+namespace Binary
+{
+
+// The unsigned integer type with the same width as a fixed-width value, used to move its bit pattern byte by byte
+template< size_t N > struct SFixedWidthBits;
+template<> struct SFixedWidthBits< 1 > { using Type = uint8_t; };
+template<> struct SFixedWidthBits< 2 > { using Type = uint16_t; };
+template<> struct SFixedWidthBits< 4 > { using Type = uint32_t; };
+template<> struct SFixedWidthBits< 8 > { using Type = uint64_t; };
+
+// Appends values to a growable byte buffer; fixed-width values are written as little-endian bit patterns, varints as
+// little-endian base-128 groups with the high bit of each byte marking continuation, so the encoding is the same on every host
+class CBinaryWriter
+{
+	public:
+
+		CBinaryWriter( void );
+		~CBinaryWriter() {}
+
+		template< typename T >
+		void Write( T value )
+		{
+			static_assert( std::is_arithmetic< T >::value, "Only arithmetic types may be written directly" );
+			static_assert( !std::is_same< T, bool >::value, "bool has no fixed representation; write it as a uint8_t flag" );
+			static_assert( !std::is_floating_point< T >::value || std::numeric_limits< T >::is_iec559, "Floating point values must be IEEE 754" );
+
+			typename SFixedWidthBits< sizeof( T ) >::Type bits;
+			memcpy( &bits, &value, sizeof( T ) );
+
+			uint8_t bytes[ sizeof( T ) ];
+			for ( size_t i = 0; i < sizeof( T ); ++i )
+			{
+				bytes[ i ] = static_cast< uint8_t >( static_cast< uint64_t >( bits ) >> ( 8 * i ) );
+			}
+
+			Write_Bytes( bytes, sizeof( T ) );
+		}
+
+		void Write_Varint( uint64_t value );
+		void Write_Signed_Varint( int64_t value ) { Write_Varint( Zig_Zag_Encode( value ) ); }
+
+		void Write_Bytes( const void *data, size_t length );
+
+		// maps small magnitudes of either sign to small unsigned values so that they stay short as varints
+		static uint64_t Zig_Zag_Encode( int64_t value ) { return ( static_cast< uint64_t >( value ) << 1 ) ^ static_cast< uint64_t >( value >> 63 ); }
+		static int64_t Zig_Zag_Decode( uint64_t value ) { return static_cast< int64_t >( value >> 1 ) ^ -static_cast< int64_t >( value & 1 ); }
+
+		const std::vector< uint8_t > &Get_Buffer( void ) const { return Buffer; }
+		size_t Get_Size( void ) const { return Buffer.size(); }
+
+		void Clear( void ) { Buffer.clear(); }
+
+	private:
+
+		std::vector< uint8_t > Buffer;
+};
+
+// Reads values back out of a contiguous buffer that it does not own; byte runs are returned in place rather than copied.
+// Reading past the end, or a serializer finding the input malformed, fails the reader, after which every read yields zero
+// or nullptr; nothing read from the buffer is trusted enough to assert on.
+class CBinaryReader
+{
+	public:
+
+		CBinaryReader( const void *data, size_t length );
+		~CBinaryReader() {}
+
+		template< typename T >
+		T Read( void )
+		{
+			static_assert( std::is_arithmetic< T >::value, "Only arithmetic types may be read directly" );
+			static_assert( !std::is_same< T, bool >::value, "bool has no fixed representation; read it as a uint8_t flag" );
+			static_assert( !std::is_floating_point< T >::value || std::numeric_limits< T >::is_iec559, "Floating point values must be IEEE 754" );
+
+			T value = T();
+			const uint8_t *bytes = Read_Bytes( sizeof( T ) );
+			if ( bytes != nullptr )
+			{
+				uint64_t bits = 0;
+				for ( size_t i = 0; i < sizeof( T ); ++i )
+				{
+					bits |= static_cast< uint64_t >( bytes[ i ] ) << ( 8 * i );
+				}
+
+				typename SFixedWidthBits< sizeof( T ) >::Type sized_bits = static_cast< typename SFixedWidthBits< sizeof( T ) >::Type >( bits );
+				memcpy( &value, &sized_bits, sizeof( T ) );
+			}
+
+			return value;
+		}
+
+		uint64_t Read_Varint( void );
+		int64_t Read_Signed_Varint( void ) { return CBinaryWriter::Zig_Zag_Decode( Read_Varint() ); }
+
+		const uint8_t *Read_Bytes( size_t length );
+
+		size_t Get_Remaining( void ) const { return static_cast< size_t >( End - Current ); }
+		bool Is_Finished( void ) const { return !Failed && Current == End; }
+
+		void Fail( void ) { Failed = true; Current = End; }
+		bool Has_Failed( void ) const { return Failed; }
+
+	private:
+
+		const uint8_t *Current;
+		const uint8_t *End;
+
+		bool Failed;
+};
+
+} // namespace Binary
+} // namespace Serialization
+} // namespace IP
@@ -0,0 +1,147 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPShared/Serialization/Binary/BinaryTableImage.h"
+
+#include "IPShared/CRC.h"
+#include "IPShared/Serialization/SerializationRegistrar.h"
+#include "IPPlatform/StringUtils.h"
+
+#include <fstream>
+
+namespace IP
+{
+namespace Serialization
+{
+namespace Binary
+{
+
+static const uint32_t TABLE_IMAGE_MAGIC = 0x42474343;	// "CCGB"
+static const uint32_t TABLE_IMAGE_VERSION = 3;
+
+CBinaryTableImage::CBinaryTableImage( void ) :
+	MappedFile(),
+	Header( nullptr )
+{
+}
+
+bool CBinaryTableImage::Write( const std::string &file_name, uint32_t source_checksum, uint32_t record_count, const CBinaryWriter &payload )
+{
+	SBinaryTableImageHeader header;
+	header.Magic = TABLE_IMAGE_MAGIC;
+	header.Version = TABLE_IMAGE_VERSION;
+	header.SchemaChecksum = CSerializationRegistrar::Compute_Binary_Schema_Checksum();
+	header.SourceChecksum = source_checksum;
+	header.RecordCount = record_count;
+	header.Reserved = 0;
+	header.PayloadSize = payload.Get_Size();
+
+	std::ofstream image_file( file_name.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary );
+	if ( !image_file.is_open() )
+	{
+		return false;
+	}
+
+	image_file.write( reinterpret_cast< const char * >( &header ), sizeof( header ) );
+	if ( payload.Get_Size() > 0 )
+	{
+		image_file.write( reinterpret_cast< const char * >( payload.Get_Buffer().data() ), payload.Get_Size() );
+	}
+
+	image_file.close();
+
+	return !image_file.fail();
+}
+
+bool CBinaryTableImage::Compute_Source_Checksum( const std::string &file_name, uint32_t &checksum )
+{
+	std::wstring wide_file_name;
+	IP::String::String_To_WideString( file_name, wide_file_name );
+
+	IP::File::CMemoryMappedFile source_file;
+	if ( !source_file.Open( wide_file_name ) )
+	{
+		return false;
+	}
+
+	checksum = IP::CRC::CRC_Memory( source_file.Get_Data(), source_file.Get_Size() );
+
+	return true;
+}
+
+bool CBinaryTableImage::Open( const std::string &file_name, uint32_t source_checksum )
+{
+	Close();
+
+	std::wstring wide_file_name;
+	IP::String::String_To_WideString( file_name, wide_file_name );
+
+	if ( !MappedFile.Open( wide_file_name ) )
+	{
+		return false;
+	}
+
+	if ( MappedFile.Get_Size() < sizeof( SBinaryTableImageHeader ) )
+	{
+		Close();
+		return false;
+	}
+
+	const SBinaryTableImageHeader *header = reinterpret_cast< const SBinaryTableImageHeader * >( MappedFile.Get_Data() );
+	if ( header->Magic != TABLE_IMAGE_MAGIC ||
+		  header->Version != TABLE_IMAGE_VERSION ||
+		  header->SchemaChecksum != CSerializationRegistrar::Compute_Binary_Schema_Checksum() ||
+		  header->SourceChecksum != source_checksum ||
+		  header->PayloadSize != MappedFile.Get_Size() - sizeof( SBinaryTableImageHeader ) )
+	{
+		Close();
+		return false;
+	}
+
+	Header = header;
+
+	return true;
+}
+
+void CBinaryTableImage::Close( void )
+{
+	Header = nullptr;
+	MappedFile.Close();
+}
+
+uint32_t CBinaryTableImage::Get_Record_Count( void ) const
+{
+	FATAL_ASSERT( Header != nullptr );
+
+	return Header->RecordCount;
+}
+
+CBinaryReader CBinaryTableImage::Get_Payload_Reader( void ) const
+{
+	FATAL_ASSERT( Header != nullptr );
+
+	return CBinaryReader( MappedFile.Get_Data() + sizeof( SBinaryTableImageHeader ), static_cast< size_t >( Header->PayloadSize ) );
+}
+
+} // namespace Binary
+} // namespace Serialization
+} // namespace IP
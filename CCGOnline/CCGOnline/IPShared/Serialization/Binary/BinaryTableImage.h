@@ -0,0 +1,78 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include "IPPlatform/PlatformFileSystem.h"
+#include "IPShared/Serialization/Binary/BinaryStream.h"
+
+namespace IP
+{
+namespace Serialization
+{
+namespace Binary
+{
+
+// The fixed header at the start of every compiled table image; the record payload follows immediately after
+struct SBinaryTableImageHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint32_t SchemaChecksum;
+	uint32_t SourceChecksum;
+	uint32_t RecordCount;
+	uint32_t Reserved;
+	uint64_t PayloadSize;
+};
+
+// A compiled data table image, mapped read-only; records are deserialized directly out of the mapped view
+class CBinaryTableImage
+{
+	public:
+
+		CBinaryTableImage( void );
+		~CBinaryTableImage() {}
+
+		static bool Write( const std::string &file_name, uint32_t source_checksum, uint32_t record_count, const CBinaryWriter &payload );
+
+		static bool Compute_Source_Checksum( const std::string &file_name, uint32_t &checksum );
+
+		// Fails if the image is missing, malformed, or was compiled from a different source file or registrar schema
+		bool Open( const std::string &file_name, uint32_t source_checksum );
+		void Close( void );
+
+		bool Is_Open( void ) const { return Header != nullptr; }
+
+		uint32_t Get_Record_Count( void ) const;
+		CBinaryReader Get_Payload_Reader( void ) const;
+
+	private:
+
+		CBinaryTableImage( const CBinaryTableImage &rhs ) = delete;
+		CBinaryTableImage &operator =( const CBinaryTableImage &rhs ) = delete;
+
+		IP::File::CMemoryMappedFile MappedFile;
+
+		const SBinaryTableImageHeader *Header;
+};
+
+} // namespace Binary
+} // namespace Serialization
+} // namespace IP
@@ -0,0 +1,371 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPShared/Serialization/Binary/PrimitiveBinarySerializers.h"
+#include "IPShared/Serialization/SerializationRegistrar.h"
+#include "IPShared/InternedString.h"
+
+namespace IP
+{
+namespace Serialization
+{
+namespace Binary
+{
+
+// A serializer for a byte-wide integer or a floating point type, written as its little-endian bit pattern
+template < typename T >
+class CBinaryArithmeticSerializer : public IBinarySerializer
+{
+	public:
+		
+		CBinaryArithmeticSerializer( void ) {}
+		virtual ~CBinaryArithmeticSerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			writer.Write< T >( *reinterpret_cast< const T * >( source ) );
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			*reinterpret_cast< T * >( destination ) = reader.Read< T >();
+		}
+};
+
+// A serializer for an integer type wider than a byte, written as a varint; signed values are zig-zag encoded first
+template < typename T >
+class CBinaryVarintSerializer : public IBinarySerializer
+{
+	public:
+		
+		CBinaryVarintSerializer( void ) {}
+		virtual ~CBinaryVarintSerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			T value = *reinterpret_cast< const T * >( source );
+
+			if ( std::is_signed< T >::value )
+			{
+				writer.Write_Signed_Varint( static_cast< int64_t >( value ) );
+			}
+			else
+			{
+				writer.Write_Varint( static_cast< uint64_t >( value ) );
+			}
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			if ( std::is_signed< T >::value )
+			{
+				*reinterpret_cast< T * >( destination ) = static_cast< T >( reader.Read_Signed_Varint() );
+			}
+			else
+			{
+				*reinterpret_cast< T * >( destination ) = static_cast< T >( reader.Read_Varint() );
+			}
+		}
+};
+
+// A serializer for bool; a single byte that must be 0 or 1
+class CBinaryBoolSerializer : public IBinarySerializer
+{
+	public:
+		
+		CBinaryBoolSerializer( void ) {}
+		virtual ~CBinaryBoolSerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			writer.Write< uint8_t >( *reinterpret_cast< const bool * >( source ) ? 1 : 0 );
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			uint8_t value = reader.Read< uint8_t >();
+			if ( value > 1 )
+			{
+				reader.Fail();
+				value = 0;
+			}
+
+			*reinterpret_cast< bool * >( destination ) = value != 0;
+		}
+};
+
+// A serializer for std::string; a varint byte count followed by the raw bytes
+class CBinaryStringSerializer : public IBinarySerializer
+{
+	public:
+		
+		CBinaryStringSerializer( void ) {}
+		virtual ~CBinaryStringSerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			const std::string *value = reinterpret_cast< const std::string * >( source );
+
+			writer.Write_Varint( value->size() );
+			writer.Write_Bytes( value->data(), value->size() );
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			std::string *value = reinterpret_cast< std::string * >( destination );
+
+			uint64_t encoded_length = reader.Read_Varint();
+			if ( encoded_length > reader.Get_Remaining() )
+			{
+				value->clear();
+				reader.Fail();
+				return;
+			}
+
+			size_t length = static_cast< size_t >( encoded_length );
+			const uint8_t *characters = reader.Read_Bytes( length );
+
+			value->assign( reinterpret_cast< const char * >( characters ), length );
+		}
+};
+
+static const uint32_t REPLACEMENT_CODE_POINT = 0xFFFD;
+
+static bool Is_Surrogate( uint32_t code_point ) { return code_point >= 0xD800 && code_point <= 0xDFFF; }
+
+// wchar_t is UTF-16 on Windows and UTF-32 elsewhere; unpaired surrogates and out-of-range values become U+FFFD
+static void Wide_To_UTF8( const std::wstring &source, std::string &target )
+{
+	target.clear();
+	target.reserve( source.size() );
+
+	for ( size_t i = 0; i < source.size(); ++i )
+	{
+		uint32_t code_point = static_cast< uint32_t >( source[ i ] );
+		if ( sizeof( wchar_t ) == 2 && code_point >= 0xD800 && code_point <= 0xDBFF && i + 1 < source.size() )
+		{
+			uint32_t low = static_cast< uint32_t >( source[ i + 1 ] );
+			if ( low >= 0xDC00 && low <= 0xDFFF )
+			{
+				code_point = 0x10000 + ( ( code_point - 0xD800 ) << 10 ) + ( low - 0xDC00 );
+				++i;
+			}
+		}
+
+		if ( Is_Surrogate( code_point ) || code_point > 0x10FFFF )
+		{
+			code_point = REPLACEMENT_CODE_POINT;
+		}
+
+		if ( code_point < 0x80 )
+		{
+			target.push_back( static_cast< char >( code_point ) );
+		}
+		else if ( code_point < 0x800 )
+		{
+			target.push_back( static_cast< char >( 0xC0 | ( code_point >> 6 ) ) );
+			target.push_back( static_cast< char >( 0x80 | ( code_point & 0x3F ) ) );
+		}
+		else if ( code_point < 0x10000 )
+		{
+			target.push_back( static_cast< char >( 0xE0 | ( code_point >> 12 ) ) );
+			target.push_back( static_cast< char >( 0x80 | ( ( code_point >> 6 ) & 0x3F ) ) );
+			target.push_back( static_cast< char >( 0x80 | ( code_point & 0x3F ) ) );
+		}
+		else
+		{
+			target.push_back( static_cast< char >( 0xF0 | ( code_point >> 18 ) ) );
+			target.push_back( static_cast< char >( 0x80 | ( ( code_point >> 12 ) & 0x3F ) ) );
+			target.push_back( static_cast< char >( 0x80 | ( ( code_point >> 6 ) & 0x3F ) ) );
+			target.push_back( static_cast< char >( 0x80 | ( code_point & 0x3F ) ) );
+		}
+	}
+}
+
+// strict: truncated sequences, overlong forms, surrogates and values past U+10FFFF are all rejected
+static bool UTF8_To_Wide( const std::string &source, std::wstring &target )
+{
+	target.clear();
+	target.reserve( source.size() );
+
+	const uint8_t *current = reinterpret_cast< const uint8_t * >( source.data() );
+	const uint8_t *end = current + source.size();
+	while ( current < end )
+	{
+		uint32_t lead = *current++;
+		uint32_t continuation_count = 0;
+		uint32_t code_point = 0;
+		uint32_t minimum = 0;
+
+		if ( lead < 0x80 )
+		{
+			code_point = lead;
+		}
+		else if ( ( lead & 0xE0 ) == 0xC0 )
+		{
+			continuation_count = 1;
+			code_point = lead & 0x1F;
+			minimum = 0x80;
+		}
+		else if ( ( lead & 0xF0 ) == 0xE0 )
+		{
+			continuation_count = 2;
+			code_point = lead & 0x0F;
+			minimum = 0x800;
+		}
+		else if ( ( lead & 0xF8 ) == 0xF0 )
+		{
+			continuation_count = 3;
+			code_point = lead & 0x07;
+			minimum = 0x10000;
+		}
+		else
+		{
+			return false;
+		}
+
+		if ( static_cast< size_t >( end - current ) < continuation_count )
+		{
+			return false;
+		}
+
+		for ( uint32_t i = 0; i < continuation_count; ++i )
+		{
+			uint32_t continuation = *current++;
+			if ( ( continuation & 0xC0 ) != 0x80 )
+			{
+				return false;
+			}
+
+			code_point = ( code_point << 6 ) | ( continuation & 0x3F );
+		}
+
+		if ( code_point < minimum || Is_Surrogate( code_point ) || code_point > 0x10FFFF )
+		{
+			return false;
+		}
+
+		if ( sizeof( wchar_t ) == 2 && code_point >= 0x10000 )
+		{
+			code_point -= 0x10000;
+			target.push_back( static_cast< wchar_t >( 0xD800 + ( code_point >> 10 ) ) );
+			target.push_back( static_cast< wchar_t >( 0xDC00 + ( code_point & 0x3FF ) ) );
+		}
+		else
+		{
+			target.push_back( static_cast< wchar_t >( code_point ) );
+		}
+	}
+
+	return true;
+}
+
+// A serializer for std::wstring; encoded as UTF-8 so that the width of wchar_t does not leak into the data
+class CBinaryWideStringSerializer : public IBinarySerializer
+{
+	public:
+		
+		CBinaryWideStringSerializer( void ) {}
+		virtual ~CBinaryWideStringSerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			std::string encoded_value;
+			Wide_To_UTF8( *reinterpret_cast< const std::wstring * >( source ), encoded_value );
+
+			StringSerializer.Write_To_Binary( &encoded_value, writer );
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			std::wstring *value = reinterpret_cast< std::wstring * >( destination );
+
+			std::string encoded_value;
+			StringSerializer.Read_From_Binary( reader, &encoded_value );
+
+			if ( reader.Has_Failed() || !UTF8_To_Wide( encoded_value, *value ) )
+			{
+				value->clear();
+				reader.Fail();
+			}
+		}
+
+	private:
+
+		CBinaryStringSerializer StringSerializer;
+};
+
+// A serializer for an interned string; encoded exactly as the plain string, and interned again on the way back in
+template < typename T, typename S >
+class CBinaryInternedStringSerializer : public IBinarySerializer
+{
+	public:
+		
+		CBinaryInternedStringSerializer( void ) {}
+		virtual ~CBinaryInternedStringSerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			const IP::String::TInternedString< T > *value = reinterpret_cast< const IP::String::TInternedString< T > * >( source );
+
+			StringSerializer.Write_To_Binary( &value->Get(), writer );
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			std::basic_string< T > value;
+			StringSerializer.Read_From_Binary( reader, &value );
+
+			*reinterpret_cast< IP::String::TInternedString< T > * >( destination ) = IP::String::TInternedString< T >( value );
+		}
+
+	private:
+
+		S StringSerializer;
+};
+
+using CBinaryNarrowInternedStringSerializer = CBinaryInternedStringSerializer< char, CBinaryStringSerializer >;
+using CBinaryWideInternedStringSerializer = CBinaryInternedStringSerializer< wchar_t, CBinaryWideStringSerializer >;
+
+
+void Register_Primitive_Serializers( void )
+{
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( int8_t, new CBinaryArithmeticSerializer< int8_t > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( uint8_t, new CBinaryArithmeticSerializer< uint8_t > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( int16_t, new CBinaryVarintSerializer< int16_t > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( uint16_t, new CBinaryVarintSerializer< uint16_t > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( int32_t, new CBinaryVarintSerializer< int32_t > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( uint32_t, new CBinaryVarintSerializer< uint32_t > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( int64_t, new CBinaryVarintSerializer< int64_t > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( uint64_t, new CBinaryVarintSerializer< uint64_t > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( std::wstring, new CBinaryWideStringSerializer );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( std::string, new CBinaryStringSerializer );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( double, new CBinaryArithmeticSerializer< double > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( float, new CBinaryArithmeticSerializer< float > );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( bool, new CBinaryBoolSerializer );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( IP::String::CInternedString, new CBinaryNarrowInternedStringSerializer );
+	REGISTER_PRIMITIVE_BINARY_SERIALIZER( IP::String::CInternedWideString, new CBinaryWideInternedStringSerializer );
+}
+
+} // namespace Binary
+} // namespace Serialization
+} // namespace IP
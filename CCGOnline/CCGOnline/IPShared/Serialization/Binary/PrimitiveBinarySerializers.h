@@ -0,0 +1,277 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include "IPShared/Serialization/Binary/BinarySerializerInterface.h"
+#include "IPShared/Serialization/Binary/BinaryStream.h"
+#include "IPShared/Serialization/SerializationHelpers.h"
+
+namespace IP
+{
+namespace Serialization
+{
+namespace Binary
+{
+
+void Register_Primitive_Serializers( void );
+
+using BinaryMemberRecordType = std::pair< uint64_t, IBinarySerializer * >;
+
+// The serializer for compound types; members are written in binding order with no names or tags
+class CCompositeBinarySerializer : public IBinarySerializer
+{
+	public:
+
+		using BASECLASS = IBinarySerializer;
+
+		CCompositeBinarySerializer( void ) :
+			BASECLASS(),
+			MemberRecords()
+		{}
+
+		virtual ~CCompositeBinarySerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			const uint8_t *byte_base_ptr = reinterpret_cast< const uint8_t * >( source );
+
+			for ( const auto &member_record : MemberRecords )
+			{
+				member_record.second->Write_To_Binary( byte_base_ptr + member_record.first, writer );
+			}
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			uint8_t *byte_base_ptr = reinterpret_cast< uint8_t * >( destination );
+
+			for ( const auto &member_record : MemberRecords )
+			{
+				member_record.second->Read_From_Binary( reader, byte_base_ptr + member_record.first );
+			}
+		}
+
+		void Add( uint64_t offset, IBinarySerializer *serializer )
+		{
+			FATAL_ASSERT( serializer != nullptr );
+
+			MemberRecords.push_back( BinaryMemberRecordType( offset, serializer ) );
+		}
+
+	private:
+
+		std::vector< BinaryMemberRecordType > MemberRecords;
+};
+
+// A serializer for a std::vector of some type; a varint entry count followed by the entries
+template< typename T >
+class CVectorBinarySerializer : public IBinarySerializer
+{
+	public:
+
+		CVectorBinarySerializer( IBinarySerializer *entry_serializer ) :
+			EntrySerializer( entry_serializer )
+		{
+			FATAL_ASSERT( EntrySerializer != nullptr );
+		}
+
+		virtual ~CVectorBinarySerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			const std::vector< T > *entries = reinterpret_cast< const std::vector< T > * >( source );
+
+			writer.Write_Varint( entries->size() );
+			for ( const auto &entry : *entries )
+			{
+				EntrySerializer->Write_To_Binary( &entry, writer );
+			}
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			std::vector< T > *entries = reinterpret_cast< std::vector< T > * >( destination );
+
+			uint64_t entry_count = reader.Read_Varint();
+			entries->clear();
+
+			// every entry takes at least one byte, so a larger count is malformed input rather than something to allocate
+			if ( entry_count > reader.Get_Remaining() )
+			{
+				reader.Fail();
+				return;
+			}
+
+			entries->resize( static_cast< size_t >( entry_count ) );
+
+			for ( auto &entry : *entries )
+			{
+				EntrySerializer->Read_From_Binary( reader, &entry );
+			}
+		}
+
+	private:
+
+		IBinarySerializer *EntrySerializer;
+};
+
+// A serializer for a pointer to some type; a presence flag followed by the pointed-to object
+class CPointerBinarySerializer : public IBinarySerializer
+{
+	public:
+
+		CPointerBinarySerializer( IBinarySerializer *t_serializer, DPrepDestinationForRead prep_delegate ) :
+			TSerializer( t_serializer ),
+			PrepDelegate( prep_delegate )
+		{
+			FATAL_ASSERT( TSerializer != nullptr );
+			FATAL_ASSERT( PrepDelegate != nullptr );
+		}
+
+		virtual ~CPointerBinarySerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			const void *object = *reinterpret_cast< const void * const * >( source );
+
+			writer.Write< uint8_t >( object != nullptr ? 1 : 0 );
+			if ( object != nullptr )
+			{
+				TSerializer->Write_To_Binary( object, writer );
+			}
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			if ( reader.Read< uint8_t >() == 0 )
+			{
+				*reinterpret_cast< void ** >( destination ) = nullptr;
+				return;
+			}
+
+			TSerializer->Read_From_Binary( reader, PrepDelegate( destination ) );
+		}
+
+	private:
+
+		IBinarySerializer *TSerializer;
+		DPrepDestinationForRead PrepDelegate;
+};
+
+// A serializer for an enum; the underlying value is written as a signed varint, so entries may not be renumbered without recompiling
+template< typename T >
+class CEnumBinarySerializer : public IBinarySerializer
+{
+	public:
+
+		CEnumBinarySerializer( void ) {}
+
+		virtual ~CEnumBinarySerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			writer.Write_Signed_Varint( static_cast< int64_t >( *reinterpret_cast< const T * >( source ) ) );
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			*reinterpret_cast< T * >( destination ) = static_cast< T >( reader.Read_Signed_Varint() );
+		}
+};
+
+// A serializer for a pointer to the base class of a class hierarchy, where all leaves of the hierarchy have a corresponding enum entry
+class CEnumPolymorphicBinarySerializer : public IBinarySerializer
+{
+	public:
+
+		CEnumPolymorphicBinarySerializer( const DDynamicTypeResolver &type_resolver ) :
+			TypeResolver( type_resolver ),
+			Serializers(),
+			Keys()
+		{
+			FATAL_ASSERT( TypeResolver != nullptr );
+		}
+
+		virtual ~CEnumPolymorphicBinarySerializer() = default;
+
+		virtual void Write_To_Binary( const void *source, CBinaryWriter &writer ) const override
+		{
+			const void *object = *reinterpret_cast< const void * const * >( source );
+
+			writer.Write< uint8_t >( object != nullptr ? 1 : 0 );
+			if ( object == nullptr )
+			{
+				return;
+			}
+
+			auto key_iter = Keys.find( TypeResolver( object ) );
+			FATAL_ASSERT( key_iter != Keys.cend() );
+
+			uint64_t key = key_iter->second;
+			writer.Write_Varint( key );
+
+			Serializers.find( key )->second.first->Write_To_Binary( object, writer );
+		}
+
+		virtual void Read_From_Binary( CBinaryReader &reader, void *destination ) const override
+		{
+			if ( reader.Read< uint8_t >() == 0 )
+			{
+				*reinterpret_cast< void ** >( destination ) = nullptr;
+				return;
+			}
+
+			auto serializer_iter = Serializers.find( reader.Read_Varint() );
+			if ( reader.Has_Failed() || serializer_iter == Serializers.cend() )
+			{
+				*reinterpret_cast< void ** >( destination ) = nullptr;
+				reader.Fail();
+				return;
+			}
+
+			const auto &entry = serializer_iter->second;
+			entry.first->Read_From_Binary( reader, entry.second( destination ) );
+		}
+
+		void Add( uint64_t key, const Loki::TypeInfo &type_info, IBinarySerializer *serializer, const DPrepDestinationForRead &prep_delegate )
+		{
+			FATAL_ASSERT( Serializers.find( key ) == Serializers.cend() );
+			FATAL_ASSERT( serializer != nullptr );
+
+			Serializers[ key ] = SerializerEntryType( serializer, prep_delegate );
+			Keys[ type_info ] = key;
+		}
+
+	private:
+
+		using SerializerEntryType = std::pair< IBinarySerializer *, DPrepDestinationForRead >;
+		using SerializerTableType = std::unordered_map< uint64_t, SerializerEntryType >;
+		using KeyTableType = std::unordered_map< Loki::TypeInfo, uint64_t, STypeInfoContainerHelper >;
+
+		DDynamicTypeResolver TypeResolver;
+
+		SerializerTableType Serializers;
+		KeyTableType Keys;
+};
+
+} // namespace Binary
+} // namespace Serialization
+} // namespace IP
@@ -34,7 +34,9 @@ CTypeSerializationDefinition::CTypeSerializationDefinition( void ) :
 	DataBindings(),
 	VectorPrepDelegate(),
 	PointerPrepDelegate(),
-	FactoryDelegate()
+	FactoryDelegate(),
+	DynamicTypeDelegate(),
+	XMLCompositeFactory()
 {
 }
 
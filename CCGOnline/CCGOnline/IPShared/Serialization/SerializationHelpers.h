@@ -22,6 +22,7 @@
 #include <functional>
 
 #include "IPShared/Serialization/XML/XMLSerializerInterface.h"
+#include "IPShared/Serialization/Binary/BinarySerializerInterface.h"
 
 namespace IP
 {
@@ -29,6 +30,7 @@ namespace Serialization
 {
 
 using DPrepDestinationForRead = std::function< void *(void *) >;
+using DDynamicTypeResolver = std::function< Loki::TypeInfo( const void * ) >;
 
 template< typename T >
 void *Prep_Vector_For_Read( void *destination )
@@ -50,20 +52,25 @@ void *Prep_Pointer_For_Read( void *destination )
 }
 
 using XMLSerializerFactory = std::function< XML::IXMLSerializer*( bool ) >;
+using XMLCompositeSerializerFactory = std::function< XML::IXMLSerializer*( const std::vector< XML::SXMLMemberBinding > & ) >;
+using BinarySerializerFactory = std::function< Binary::IBinarySerializer*( bool ) >;
 
 class CSerializerFactorySet
 {
 	public:
-		CSerializerFactorySet(const XMLSerializerFactory &xml_factory) :
-			XMLFactory( xml_factory )
+		CSerializerFactorySet(const XMLSerializerFactory &xml_factory, const BinarySerializerFactory &binary_factory) :
+			XMLFactory( xml_factory ),
+			BinaryFactory( binary_factory )
 		{}
 
 		const XMLSerializerFactory &Get_XML_Factory( void ) const { return XMLFactory; }
+		const BinarySerializerFactory &Get_Binary_Factory( void ) const { return BinaryFactory; }
 
 
 	private:
 
 		XMLSerializerFactory XMLFactory;
+		BinarySerializerFactory BinaryFactory;
 };
 
 class IDataBinding
@@ -79,6 +86,17 @@ class IDataBinding
 
 };
 
+// Computes a member's byte offset from a pointer-to-member without constructing a T; only the member's address within
+// uninitialized storage is taken, nothing is read or written
+template< typename T, typename U >
+uint64_t Compute_Member_Offset( U T::* member )
+{
+	typename std::aligned_storage< sizeof( T ), std::alignment_of< T >::value >::type storage;
+	const T *object = reinterpret_cast< const T * >( &storage );
+
+	return reinterpret_cast< const char * >( &( object->*member ) ) - reinterpret_cast< const char * >( object );
+}
+
 template< typename T, typename U >
 class TDataBinding : public IDataBinding
 {
@@ -86,20 +104,14 @@ class TDataBinding : public IDataBinding
 
 		TDataBinding(const std::wstring& name, U T::* offset, bool allow_polymorphism ) :
 			Name( name ),
-			Offset( offset ),
+			Offset( Compute_Member_Offset( offset ) ),
 			MemberType( typeid( U ) ),
 			AllowPolymorphism( allow_polymorphism )
 		{
 		}
 
 		virtual const std::wstring& Get_Name() const override { return Name; }
-		virtual uint64_t Get_Member_Offset() const override
-		{
-			T dummy_object;
-			U *member_pointer = &( dummy_object.*Offset );
-
-			return reinterpret_cast< char * >( member_pointer ) - reinterpret_cast< char * >( &dummy_object );
-		}
+		virtual uint64_t Get_Member_Offset() const override { return Offset; }
 
 		virtual const Loki::TypeInfo&  Get_Member_Type() const override
 		{
@@ -111,7 +123,7 @@ class TDataBinding : public IDataBinding
 	private:
 
 		std::wstring Name;
-		U T::* Offset;
+		uint64_t Offset;
 		Loki::TypeInfo MemberType;
 		bool AllowPolymorphism;
 };
@@ -165,6 +177,11 @@ class CTypeSerializationDefinition
 		const DPrepDestinationForRead &Get_Vector_Prep_Delegate( void ) const { return VectorPrepDelegate; }
 		const DPrepDestinationForRead &Get_Pointer_Prep_Delegate( void ) const { return PointerPrepDelegate; }
 		const VoidFactory &Get_Factory_Delegate( void ) const { return FactoryDelegate; }
+		const DDynamicTypeResolver &Get_Dynamic_Type_Delegate( void ) const { return DynamicTypeDelegate; }
+
+		// Replaces the generic composite XML serializer for this type, see TStaticCompositeXMLSerializer
+		const XMLCompositeSerializerFactory &Get_XML_Composite_Factory( void ) const { return XMLCompositeFactory; }
+		void Set_XML_Composite_Factory( const XMLCompositeSerializerFactory &factory ) { XMLCompositeFactory = factory; }
 
 	private:
 
@@ -178,6 +195,7 @@ class CTypeSerializationDefinition
 			type_definition->VectorPrepDelegate = Prep_Vector_For_Read< T >;
 			type_definition->PointerPrepDelegate = Prep_Pointer_For_Read< T >;
 			type_definition->FactoryDelegate = []( void ){ return static_cast< void * >( new T ); };
+			type_definition->DynamicTypeDelegate = []( const void *object ){ return Loki::TypeInfo( typeid( *static_cast< const T * >( object ) ) ); };
 		}
 
 		Loki::TypeInfo Type;
@@ -190,6 +208,8 @@ class CTypeSerializationDefinition
 		DPrepDestinationForRead VectorPrepDelegate;
 		DPrepDestinationForRead PointerPrepDelegate;
 		VoidFactory FactoryDelegate;
+		DDynamicTypeResolver DynamicTypeDelegate;
+		XMLCompositeSerializerFactory XMLCompositeFactory;
 };
 
 } // namespace Serialization
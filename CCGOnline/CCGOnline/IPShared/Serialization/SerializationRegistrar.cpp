@@ -21,7 +21,10 @@
 
 #include "IPShared/Serialization/SerializationRegistrar.h"
 
+#include "IPShared/CRC.h"
+
 #include <stack>
+#include <sstream>
 
 namespace IP
 {
@@ -35,6 +38,8 @@ CSerializationRegistrar::DerivedClassTableType CSerializationRegistrar::DerivedC
 CSerializationRegistrar::PolymorphicTypesTableType CSerializationRegistrar::PolymorphicTypes;
 CSerializationRegistrar::PolymorphicEnumTablesTableType CSerializationRegistrar::PolymorphicEnumTables;
 CSerializationRegistrar::XMLSerializerTableType CSerializationRegistrar::PolymorphicSerializers;
+CSerializationRegistrar::BinarySerializerTableType CSerializationRegistrar::BinarySerializers;
+CSerializationRegistrar::BinarySerializerTableType CSerializationRegistrar::PolymorphicBinarySerializers;
 
 void CSerializationRegistrar::Register_Primitive_XML_Serializer( const Loki::TypeInfo &type_info, XML::IXMLSerializer *serializer )
 {
@@ -43,6 +48,13 @@ void CSerializationRegistrar::Register_Primitive_XML_Serializer( const Loki::Typ
 	XMLSerializers[ type_info ] = serializer;
 }
 
+void CSerializationRegistrar::Register_Primitive_Binary_Serializer( const Loki::TypeInfo &type_info, Binary::IBinarySerializer *serializer )
+{
+	FATAL_ASSERT( serializer != nullptr );
+
+	BinarySerializers[ type_info ] = serializer;
+}
+
 void CSerializationRegistrar::Add_Inheritance_Relationship( const Loki::TypeInfo &derived_type_info, const Loki::TypeInfo &base_type_info )
 {
 	FATAL_ASSERT( derived_type_info != base_type_info );
@@ -95,6 +107,16 @@ void CSerializationRegistrar::Cleanup()
 	{
 		delete iter.second;
 	}
+
+	for ( auto iter : BinarySerializers )
+	{
+		delete iter.second;
+	}
+
+	for ( auto iter : PolymorphicBinarySerializers )
+	{
+		delete iter.second;
+	}
 }
 
 bool CSerializationRegistrar::Inherits_From( const Loki::TypeInfo &base_type_info, const Loki::TypeInfo &derived_type_info )
@@ -189,6 +211,51 @@ XML::IXMLSerializer *CSerializationRegistrar::Get_Or_Build_Polymorphic_Enum_Seri
 	return poly_serializer;
 }
 
+Binary::IBinarySerializer *CSerializationRegistrar::Get_Or_Build_Polymorphic_Enum_Binary_Serializer( const Loki::TypeInfo &type_info )
+{
+	auto iter = PolymorphicTypes.find( type_info );
+	FATAL_ASSERT( iter != PolymorphicTypes.end() );
+
+	const auto &enum_type_info = iter->second;
+	auto ser_iter = PolymorphicBinarySerializers.find( enum_type_info );
+	if ( ser_iter != PolymorphicBinarySerializers.end() )
+	{
+		return ser_iter->second;
+	}
+
+	auto table_iter = PolymorphicEnumTables.find( enum_type_info );
+	FATAL_ASSERT( table_iter != PolymorphicEnumTables.end() );
+
+	auto table = table_iter->second;
+	FATAL_ASSERT( table != nullptr );
+	FATAL_ASSERT( table->size() > 0 );
+
+	// the dynamic type of an object must be resolved through the root of the hierarchy, since any class in it may be the static type
+	CTypeSerializationDefinition *root_definition = Get_Type_Serialization_Definition( type_info );
+	FATAL_ASSERT( root_definition != nullptr );
+	while ( root_definition->Has_Base_Class() )
+	{
+		root_definition = Get_Type_Serialization_Definition( root_definition->Get_Base_Type_Info() );
+		FATAL_ASSERT( root_definition != nullptr );
+	}
+
+	auto poly_serializer = new Binary::CEnumPolymorphicBinarySerializer( root_definition->Get_Dynamic_Type_Delegate() );
+
+	for ( const auto &table_iter : *table )
+	{
+		const Loki::TypeInfo &entry_type_info = table_iter.second;
+		CTypeSerializationDefinition *type_definition = Get_Type_Serialization_Definition( entry_type_info );
+		FATAL_ASSERT( type_definition != nullptr );
+
+		auto entry_serializer = Get_Or_Build_Composite_Binary_Serializer( entry_type_info );
+		poly_serializer->Add( table_iter.first, entry_type_info, entry_serializer, type_definition->Get_Pointer_Prep_Delegate() );
+	}
+
+	PolymorphicBinarySerializers[ enum_type_info ] = poly_serializer;
+
+	return poly_serializer;
+}
+
 CTypeSerializationDefinition *CSerializationRegistrar::Get_Most_Derived_Type_Singleton( const Loki::TypeInfo &type_info )
 {
 	CTypeSerializationDefinition *most_derived = nullptr;
@@ -280,6 +347,61 @@ void CSerializationRegistrar::Finalize( void )
 		
 		XMLSerializers[ pointer_type_info ] = pointer_serializer;
 	}
+
+	for ( const auto &type_entry : TypeSerializationDefinitions )
+	{
+		CTypeSerializationDefinition *type_definition = type_entry.second;
+
+		const Loki::TypeInfo &pointer_type_info = type_definition->Get_Pointer_Type_Info();
+		if( BinarySerializers.find( pointer_type_info ) != BinarySerializers.end() )
+		{
+			continue;
+		}
+
+		auto serializer = Get_Or_Build_Composite_Binary_Serializer( type_definition->Get_Type_Info() );
+		
+		BinarySerializers[ pointer_type_info ] = new Binary::CPointerBinarySerializer( serializer, type_definition->Get_Pointer_Prep_Delegate() );
+	}
+}
+
+uint32_t CSerializationRegistrar::Compute_Binary_Schema_Checksum( void )
+{
+	std::vector< std::string > type_descriptions;
+	type_descriptions.reserve( TypeSerializationDefinitions.size() );
+
+	for ( const auto &type_entry : TypeSerializationDefinitions )
+	{
+		CTypeSerializationDefinition *type_definition = type_entry.second;
+
+		std::ostringstream description;
+		description << type_definition->Get_Type_Info().name();
+		if ( type_definition->Has_Base_Class() )
+		{
+			description << ":" << type_definition->Get_Base_Type_Info().name();
+		}
+
+		for ( const auto binding : type_definition->Get_Data_Bindings() )
+		{
+			std::string binding_name;
+			IP::String::WideString_To_String( binding->Get_Name(), binding_name );
+
+			description << "|" << binding_name << "," << binding->Get_Member_Type().name() << "," << binding->Get_Member_Offset() << "," << binding->Allow_Polymorphism();
+		}
+
+		type_descriptions.push_back( description.str() );
+	}
+
+	// hash iteration order is not stable between runs, so order the types by name
+	std::sort( type_descriptions.begin(), type_descriptions.end() );
+
+	std::ostringstream schema;
+	schema << sizeof( wchar_t ) << sizeof( void * );
+	for ( const auto &type_description : type_descriptions )
+	{
+		schema << ";" << type_description;
+	}
+
+	return IP::CRC::String_To_CRC( schema.str() );
 }
 
 } // namespace Serialization
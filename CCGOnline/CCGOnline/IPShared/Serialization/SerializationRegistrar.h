@@ -22,6 +22,7 @@
 #include "IPShared/Serialization/SerializationHelpers.h"
 #include "IPShared/Serialization/XML/XMLSerializerInterface.h"
 #include "IPShared/Serialization/XML/PrimitiveXMLSerializers.h"
+#include "IPShared/Serialization/Binary/PrimitiveBinarySerializers.h"
 
 namespace IP
 {
@@ -34,6 +35,7 @@ class CSerializationRegistrar
 		
 		// registration
 		static void Register_Primitive_XML_Serializer( const Loki::TypeInfo &type_info, XML::IXMLSerializer *serializer );
+		static void Register_Primitive_Binary_Serializer( const Loki::TypeInfo &type_info, Binary::IBinarySerializer *serializer );
 
 		template< typename T >
 		static void Register_Type_Serialization_Definition( CTypeSerializationDefinition *definition );
@@ -54,6 +56,12 @@ class CSerializationRegistrar
 		template< typename T >
 		static XML::IXMLSerializer *Get_XML_Serializer( bool allow_polymorphism = true );
 
+		template< typename T >
+		static Binary::IBinarySerializer *Get_Binary_Serializer( bool allow_polymorphism = true );
+
+		// A checksum over every registered type's layout and bindings; binary data written under a different checksum cannot be read back
+		static uint32_t Compute_Binary_Schema_Checksum( void );
+
 	private:
 
 		static void Add_Inheritance_Relationship( const Loki::TypeInfo &derived_type_info, const Loki::TypeInfo &base_type_info );
@@ -67,7 +75,7 @@ class CSerializationRegistrar
 				return;
 			}
 
-			CSerializerFactorySet *factory_set = new CSerializerFactorySet( CGetOrBuildXMLSerializer< T >() );
+			CSerializerFactorySet *factory_set = new CSerializerFactorySet( CGetOrBuildXMLSerializer< T >(), CGetOrBuildBinarySerializer< T >() );
 			FactorySets[ type_info ] = factory_set;
 		}
 
@@ -75,7 +83,61 @@ class CSerializationRegistrar
 
 		static void Register_XML_Serializer( const Loki::TypeInfo& type_info, XML::IXMLSerializer *serializer );
 
-		static void Add_Binding_Set_To_Serializer( XML::CCompositeXMLSerializer *serializer, CTypeSerializationDefinition *type_definition )
+		static void Add_Binding_Set_To_Binary_Serializer( Binary::CCompositeBinarySerializer *serializer, CTypeSerializationDefinition *type_definition )
+		{
+			auto binding_set = type_definition->Get_Data_Bindings();
+
+			for ( uint32_t i = 0; i < binding_set.size(); ++i )
+			{
+				IDataBinding *binding = binding_set[ i ];
+				auto factory_set = Get_Factory_Set( binding->Get_Member_Type() );
+				FATAL_ASSERT( factory_set != nullptr );
+
+				serializer->Add( binding->Get_Member_Offset(), factory_set->Get_Binary_Factory()( binding->Allow_Polymorphism() ) );
+			}
+		}
+
+		static Binary::IBinarySerializer *Build_Composite_Binary_Serializer( const Loki::TypeInfo &type_info )
+		{
+			auto type_definition_iter = TypeSerializationDefinitions.find( type_info );
+			FATAL_ASSERT( type_definition_iter != TypeSerializationDefinitions.end() );
+
+			CTypeSerializationDefinition *type_definition = type_definition_iter->second;
+			FATAL_ASSERT( type_definition != nullptr );
+
+			auto serializer = new Binary::CCompositeBinarySerializer;
+			Add_Binding_Set_To_Binary_Serializer( serializer, type_definition );
+
+			while( type_definition->Has_Base_Class() )
+			{
+				auto base_definition_iter = TypeSerializationDefinitions.find( type_definition->Get_Base_Type_Info() );
+				FATAL_ASSERT( base_definition_iter != TypeSerializationDefinitions.end() );
+
+				Add_Binding_Set_To_Binary_Serializer( serializer, base_definition_iter->second );
+
+				type_definition = base_definition_iter->second;
+			}
+
+			return serializer;
+		}
+
+		static Binary::IBinarySerializer *Get_Or_Build_Composite_Binary_Serializer( const Loki::TypeInfo &type_info )
+		{
+			auto iter = BinarySerializers.find( type_info );
+			if( iter != BinarySerializers.end() )
+			{
+				return iter->second;
+			}
+
+			auto serializer = Build_Composite_Binary_Serializer( type_info );
+			FATAL_ASSERT( serializer != nullptr );
+
+			BinarySerializers[ type_info ] = serializer;
+
+			return serializer;
+		}
+
+		static void Add_Binding_Set_To_Member_Bindings( std::vector< XML::SXMLMemberBinding > &member_bindings, CTypeSerializationDefinition *type_definition )
 		{
 			auto binding_set = type_definition->Get_Data_Bindings();
 
@@ -85,7 +147,8 @@ class CSerializationRegistrar
 				auto factory_set = Get_Factory_Set( binding->Get_Member_Type() );
 				FATAL_ASSERT( factory_set != nullptr );
 
-				serializer->Add( binding->Get_Name(), binding->Get_Member_Offset(), factory_set->Get_XML_Factory()( binding->Allow_Polymorphism() ) );
+				XML::IXMLSerializer *serializer = factory_set->Get_XML_Factory()( binding->Allow_Polymorphism() );
+				member_bindings.push_back( XML::SXMLMemberBinding( binding->Get_Name(), binding->Get_Member_Offset(), binding->Get_Member_Type(), serializer ) );
 			}
 		}
 
@@ -97,19 +160,32 @@ class CSerializationRegistrar
 			CTypeSerializationDefinition *type_definition = type_definition_iter->second;
 			FATAL_ASSERT( type_definition != nullptr );
 
-			auto serializer = new XML::CCompositeXMLSerializer;
-			Add_Binding_Set_To_Serializer( serializer, type_definition );
+			const XMLCompositeSerializerFactory &composite_factory = type_definition->Get_XML_Composite_Factory();
+
+			std::vector< XML::SXMLMemberBinding > member_bindings;
+			Add_Binding_Set_To_Member_Bindings( member_bindings, type_definition );
 
 			while( type_definition->Has_Base_Class() )
 			{
 				auto base_definition_iter = TypeSerializationDefinitions.find( type_definition->Get_Base_Type_Info() );
 				FATAL_ASSERT( base_definition_iter != TypeSerializationDefinitions.end() );
 
-				Add_Binding_Set_To_Serializer( serializer, base_definition_iter->second );
+				Add_Binding_Set_To_Member_Bindings( member_bindings, base_definition_iter->second );
 
 				type_definition = base_definition_iter->second;
 			}
 
+			if ( composite_factory != nullptr )
+			{
+				return composite_factory( member_bindings );
+			}
+
+			auto serializer = new XML::CCompositeXMLSerializer;
+			for ( const auto &member_binding : member_bindings )
+			{
+				serializer->Add( member_binding.Name, member_binding.Offset, member_binding.Serializer );
+			}
+
 			return serializer;
 		}
 
@@ -200,7 +276,7 @@ class CSerializationRegistrar
 							auto derived_serializer = derived_iter->second;
 							FATAL_ASSERT( derived_serializer != nullptr );
 
-							auto pointer_serializer = new CPointerXMLSerializer( derived_serializer, most_derived_type_definition->Get_Pointer_Prep_Delegate() );
+							auto pointer_serializer = new XML::CPointerXMLSerializer( derived_serializer, most_derived_type_definition->Get_Pointer_Prep_Delegate() );
 							FATAL_ASSERT( pointer_serializer != nullptr );
 
 							XMLSerializers[ most_derived_pointer_type_info ] = pointer_serializer;
@@ -218,7 +294,7 @@ class CSerializationRegistrar
 					}
 
 					XML::IXMLSerializer *serializer = CGetOrBuildXMLSerializer< T >()( allow_polymorphism );
-					XML::IXMLSerializer *pointer_serializer = new CPointerXMLSerializer( serializer, Prep_Pointer_For_Read< T > );
+					XML::IXMLSerializer *pointer_serializer = new XML::CPointerXMLSerializer( serializer, Prep_Pointer_For_Read< T > );
 
 					FATAL_ASSERT( pointer_serializer != nullptr );
 
@@ -228,10 +304,96 @@ class CSerializationRegistrar
 				}
 		};
 
+		template< typename T >
+		class CGetOrBuildBinarySerializer
+		{
+			public:
+
+				Binary::IBinarySerializer* operator()( bool allow_polymorphism ) const {
+					IP_UNREFERENCED_PARAM( allow_polymorphism );
+
+					return Get_Or_Build_Composite_Binary_Serializer( Loki::TypeInfo( typeid( T ) ) );
+				}
+		};
+
+		template< typename T >
+		class CGetOrBuildBinarySerializer< std::vector< T > >
+		{
+			public:
+
+				Binary::IBinarySerializer* operator()( bool allow_polymorphism ) const {
+					Loki::TypeInfo type_info( typeid( std::vector< T > ) );
+					auto iter = BinarySerializers.find( type_info );
+					if( iter != BinarySerializers.end() )
+					{
+						return iter->second;
+					}
+
+					Binary::IBinarySerializer *serializer = CGetOrBuildBinarySerializer< T >()( allow_polymorphism );
+					Binary::IBinarySerializer *vector_serializer = new Binary::CVectorBinarySerializer< T >( serializer );
+					BinarySerializers[ type_info ] = vector_serializer;
+
+					return vector_serializer;
+				}
+		};
+
+		template< typename T >
+		class CGetOrBuildBinarySerializer< T * >
+		{
+			public:
+
+				Binary::IBinarySerializer* operator()( bool allow_polymorphism ) const {
+					Loki::TypeInfo type_info( typeid( T ) );
+					auto type_iter = TypeSerializationDefinitions.find( type_info );
+
+					if ( allow_polymorphism && type_iter != TypeSerializationDefinitions.end() )
+					{
+						if ( Has_Polymorphic_Enum_Mapping( type_info ) )
+						{
+							return Get_Or_Build_Polymorphic_Enum_Binary_Serializer( type_info );
+						}
+
+						CTypeSerializationDefinition *most_derived_type_definition = Get_Most_Derived_Type_Singleton( type_info );
+						if ( most_derived_type_definition != nullptr )
+						{
+							const Loki::TypeInfo &most_derived_pointer_type_info = most_derived_type_definition->Get_Pointer_Type_Info();
+							auto pointer_derived_iter = BinarySerializers.find( most_derived_pointer_type_info );
+							if ( pointer_derived_iter != BinarySerializers.end() )
+							{
+								return pointer_derived_iter->second;
+							}
+
+							auto derived_serializer = Get_Or_Build_Composite_Binary_Serializer( most_derived_type_definition->Get_Type_Info() );
+							auto pointer_serializer = new Binary::CPointerBinarySerializer( derived_serializer, most_derived_type_definition->Get_Pointer_Prep_Delegate() );
+
+							BinarySerializers[ most_derived_pointer_type_info ] = pointer_serializer;
+
+							return pointer_serializer;
+						}
+					}
+
+					Loki::TypeInfo pointer_type_info( typeid( T * ) );
+
+					auto iter = BinarySerializers.find( pointer_type_info );
+					if( iter != BinarySerializers.end() )
+					{
+						return iter->second;
+					}
+
+					Binary::IBinarySerializer *serializer = CGetOrBuildBinarySerializer< T >()( allow_polymorphism );
+					Binary::IBinarySerializer *pointer_serializer = new Binary::CPointerBinarySerializer( serializer, Prep_Pointer_For_Read< T > );
+
+					BinarySerializers[ pointer_type_info ] = pointer_serializer;
+
+					return pointer_serializer;
+				}
+		};
+
 		static bool Inherits_From( const Loki::TypeInfo &base_type_info, const Loki::TypeInfo &derived_type_info );
 
 		static bool Has_Polymorphic_Enum_Mapping( const Loki::TypeInfo &type_info );
 		static XML::IXMLSerializer *Get_Or_Build_Polymorphic_Enum_Serializer( const Loki::TypeInfo &type_info );
+		static Binary::IBinarySerializer *Get_Or_Build_Polymorphic_Enum_Binary_Serializer( const Loki::TypeInfo &type_info );
 		static CTypeSerializationDefinition *Get_Most_Derived_Type_Singleton( const Loki::TypeInfo &type_info );
 
 		static void Build_Derived_Type_List( const Loki::TypeInfo &type_info, std::vector< Loki::TypeInfo > &derived_types );
@@ -239,6 +401,7 @@ class CSerializationRegistrar
 		using TypeSerializationDefinitionTableType = std::unordered_map< Loki::TypeInfo, CTypeSerializationDefinition *, STypeInfoContainerHelper >;
 		using FactorySetTableType = std::unordered_map< Loki::TypeInfo, CSerializerFactorySet *, STypeInfoContainerHelper >;
 		using XMLSerializerTableType = std::unordered_map< Loki::TypeInfo, XML::IXMLSerializer *, STypeInfoContainerHelper >;
+		using BinarySerializerTableType = std::unordered_map< Loki::TypeInfo, Binary::IBinarySerializer *, STypeInfoContainerHelper >;
 		using DerivedClassTableType = std::unordered_map< Loki::TypeInfo, std::vector< Loki::TypeInfo >, STypeInfoContainerHelper >;
 
 		using PolymorphicTypesTableType = std::unordered_map< Loki::TypeInfo, Loki::TypeInfo, STypeInfoContainerHelper >;
@@ -253,6 +416,9 @@ class CSerializationRegistrar
 		static PolymorphicTypesTableType PolymorphicTypes;
 		static PolymorphicEnumTablesTableType PolymorphicEnumTables;
 		static XMLSerializerTableType PolymorphicSerializers;
+
+		static BinarySerializerTableType BinarySerializers;
+		static BinarySerializerTableType PolymorphicBinarySerializers;
 };
 
 } // namespace Serialization
@@ -265,10 +431,13 @@ class CSerializationRegistrar
 #define END_TYPE_DEFINITION( t ) IP::Serialization::CSerializationRegistrar::Register_Type_Serialization_Definition< t >( definition ); 
 
 #define REGISTER_PRIMITIVE_XML_SERIALIZER( t, s ) IP::Serialization::CSerializationRegistrar::Register_Primitive_XML_Serializer( Loki::TypeInfo( typeid( t ) ), s );
+#define REGISTER_PRIMITIVE_BINARY_SERIALIZER( t, s ) IP::Serialization::CSerializationRegistrar::Register_Primitive_Binary_Serializer( Loki::TypeInfo( typeid( t ) ), s );
 
 #define REGISTER_POLYMORPHIC_ENUM_ENTRY( e, t ) IP::Serialization::CSerializationRegistrar::Register_Polymorphic_Enum_Entry( e, Loki::TypeInfo( typeid( t ) ) );
 
-#define REGISTER_ENUM_SERIALIZER( e ) IP::Serialization::CSerializationRegistrar::Register_Primitive_XML_Serializer( Loki::TypeInfo( typeid( e ) ), new IP::Serialization::XML::CEnumXMLSerializer< e > );
+#define REGISTER_ENUM_SERIALIZER( e ) \
+	IP::Serialization::CSerializationRegistrar::Register_Primitive_XML_Serializer( Loki::TypeInfo( typeid( e ) ), new IP::Serialization::XML::CEnumXMLSerializer< e > ); \
+	IP::Serialization::CSerializationRegistrar::Register_Primitive_Binary_Serializer( Loki::TypeInfo( typeid( e ) ), new IP::Serialization::Binary::CEnumBinarySerializer< e > );
 
 namespace IP
 {
@@ -305,6 +474,12 @@ XML::IXMLSerializer *CSerializationRegistrar::Get_XML_Serializer( bool allow_pol
 	return CGetOrBuildXMLSerializer< T >()( allow_polymorphism );
 }
 
+template< typename T >
+Binary::IBinarySerializer *CSerializationRegistrar::Get_Binary_Serializer( bool allow_polymorphism )
+{
+	return CGetOrBuildBinarySerializer< T >()( allow_polymorphism );
+}
+
 template < typename T >
 void CSerializationRegistrar::Register_Polymorphic_Enum_Entry( T enum_entry, const Loki::TypeInfo &type_info )
 {
@@ -0,0 +1,253 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include <tuple>
+
+namespace IP
+{
+namespace Serialization
+{
+namespace XML
+{
+
+// A secondary index over the contiguous rows of a CXMLFlatLoadableTable; built once, after every row is in place
+template< typename T >
+class IFlatTableIndex
+{
+	public:
+
+		IFlatTableIndex( void ) {}
+		virtual ~IFlatTableIndex() {}
+
+		virtual void Build( const std::vector< T > &rows ) = 0;
+		virtual void Clear( void ) = 0;
+};
+
+// Hashes a member value; enums hash by their underlying value
+template< typename U, typename Enable = void >
+struct SFlatTableIndexHasher
+{
+	size_t operator()( const U &value ) const { return std::hash< U >()( value ); }
+};
+
+template< typename U >
+struct SFlatTableIndexHasher< U, typename std::enable_if< std::is_enum< U >::value >::type >
+{
+	size_t operator()( const U &value ) const
+	{
+		using UnderlyingType = typename std::underlying_type< U >::type;
+
+		return std::hash< UnderlyingType >()( static_cast< UnderlyingType >( value ) );
+	}
+};
+
+// An equality index on one member.  Rows sharing a value are stored next to each other, so a lookup is one hash probe
+// followed by a walk over a contiguous run of row numbers.
+template< typename T, typename U >
+class TFlatTableHashIndex : public IFlatTableIndex< T >
+{
+	public:
+
+		using BASECLASS = IFlatTableIndex< T >;
+
+		TFlatTableHashIndex( U T::*member ) :
+			BASECLASS(),
+			Member( member ),
+			Rows( nullptr ),
+			RowNumbers(),
+			Runs()
+		{}
+
+		virtual ~TFlatTableHashIndex() = default;
+
+		virtual void Build( const std::vector< T > &rows ) override
+		{
+			Clear();
+			Rows = &rows;
+
+			RowNumbers.resize( rows.size() );
+			for ( uint32_t i = 0; i < RowNumbers.size(); ++i )
+			{
+				RowNumbers[ i ] = i;
+			}
+
+			U T::*member = Member;
+			std::stable_sort( RowNumbers.begin(), RowNumbers.end(), [ &rows, member ]( uint32_t lhs, uint32_t rhs ) { return rows[ lhs ].*member < rows[ rhs ].*member; } );
+
+			for ( uint32_t run_start = 0; run_start < RowNumbers.size(); )
+			{
+				const U &value = rows[ RowNumbers[ run_start ] ].*Member;
+
+				uint32_t run_end = run_start + 1;
+				while ( run_end < RowNumbers.size() && !( value < rows[ RowNumbers[ run_end ] ].*Member ) )
+				{
+					++run_end;
+				}
+
+				Runs[ value ] = SRun( run_start, run_end );
+				run_start = run_end;
+			}
+		}
+
+		virtual void Clear( void ) override
+		{
+			Rows = nullptr;
+			RowNumbers.clear();
+			Runs.clear();
+		}
+
+		void Find( const U &value, std::vector< const T * > &rows ) const
+		{
+			auto iter = Runs.find( value );
+			if ( iter == Runs.cend() )
+			{
+				return;
+			}
+
+			for ( uint32_t i = iter->second.Start; i < iter->second.End; ++i )
+			{
+				rows.push_back( &( *Rows )[ RowNumbers[ i ] ] );
+			}
+		}
+
+		uint32_t Count( const U &value ) const
+		{
+			auto iter = Runs.find( value );
+
+			return iter != Runs.cend() ? iter->second.End - iter->second.Start : 0;
+		}
+
+	private:
+
+		struct SRun
+		{
+			SRun( void ) : Start( 0 ), End( 0 ) {}
+			SRun( uint32_t start, uint32_t end ) : Start( start ), End( end ) {}
+
+			uint32_t Start;
+			uint32_t End;
+		};
+
+		U T::*Member;
+
+		const std::vector< T > *Rows;
+		std::vector< uint32_t > RowNumbers;
+		std::unordered_map< U, SRun, SFlatTableIndexHasher< U > > Runs;
+};
+
+// An ordered index on one or more members, compared lexicographically in the order given.  Range queries are inclusive
+// at both ends; with several members, "all cards of faction X with cost <= N" is Find_Range( ( X, min ), ( X, N ) ).
+template< typename T, typename... U >
+class TFlatTableSortedIndex : public IFlatTableIndex< T >
+{
+	public:
+
+		using BASECLASS = IFlatTableIndex< T >;
+		using KeyType = std::tuple< U... >;
+
+		TFlatTableSortedIndex( U T::*... members ) :
+			BASECLASS(),
+			Members( members... ),
+			Rows( nullptr ),
+			Entries()
+		{}
+
+		virtual ~TFlatTableSortedIndex() = default;
+
+		virtual void Build( const std::vector< T > &rows ) override
+		{
+			Clear();
+			Rows = &rows;
+
+			Entries.reserve( rows.size() );
+			for ( uint32_t i = 0; i < rows.size(); ++i )
+			{
+				Entries.push_back( SEntry( Extract_Key( rows[ i ], typename SMemberIndices< sizeof...( U ) >::Type() ), i ) );
+			}
+
+			std::stable_sort( Entries.begin(), Entries.end(), []( const SEntry &lhs, const SEntry &rhs ) { return lhs.Key < rhs.Key; } );
+		}
+
+		virtual void Clear( void ) override
+		{
+			Rows = nullptr;
+			Entries.clear();
+		}
+
+		void Find_Range( const KeyType &lower, const KeyType &upper, std::vector< const T * > &rows ) const
+		{
+			auto first = std::lower_bound( Entries.cbegin(), Entries.cend(), lower, []( const SEntry &entry, const KeyType &key ) { return entry.Key < key; } );
+			auto last = std::upper_bound( first, Entries.cend(), upper, []( const KeyType &key, const SEntry &entry ) { return key < entry.Key; } );
+
+			for ( ; first < last; ++first )
+			{
+				rows.push_back( &( *Rows )[ first->RowNumber ] );
+			}
+		}
+
+		void Find( const KeyType &key, std::vector< const T * > &rows ) const
+		{
+			Find_Range( key, key, rows );
+		}
+
+	private:
+
+		template< size_t... I >
+		struct SIndexSequence
+		{};
+
+		template< size_t N, size_t... I >
+		struct SMemberIndices : SMemberIndices< N - 1, N - 1, I... >
+		{};
+
+		template< size_t... I >
+		struct SMemberIndices< 0, I... >
+		{
+			using Type = SIndexSequence< I... >;
+		};
+
+		template< size_t... I >
+		KeyType Extract_Key( const T &row, SIndexSequence< I... > ) const
+		{
+			return KeyType( row.*std::get< I >( Members )... );
+		}
+
+		struct SEntry
+		{
+			SEntry( const KeyType &key, uint32_t row_number ) :
+				Key( key ),
+				RowNumber( row_number )
+			{}
+
+			KeyType Key;
+			uint32_t RowNumber;
+		};
+
+		std::tuple< U T::*... > Members;
+
+		const std::vector< T > *Rows;
+		std::vector< SEntry > Entries;
+};
+
+} // namespace XML
+} // namespace Serialization
+} // namespace IP
@@ -22,6 +22,7 @@
 #include "IPShared/Serialization/XML/PrimitiveXMLSerializers.h"
 #include "IPShared/Serialization/SerializationRegistrar.h"
 #include "pugixml/pugixml.h"
+#include "IPShared/InternedString.h"
 
 namespace IP
 {
@@ -34,9 +35,9 @@ class CPrimitiveXMLSerializer : public IXMLSerializer
 {
 	public:
 
-		virtual void Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
+		virtual bool Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
 		{
-			Load_From_String( xml_node.child_value(), destination );
+			return Load_From_String( xml_node.child_value(), destination );
 		}
 };
 
@@ -49,14 +50,18 @@ class CXMLIntegerSerializer : public CPrimitiveXMLSerializer
 		CXMLIntegerSerializer( void ) {}
 		virtual ~CXMLIntegerSerializer() = default;
 
-		virtual void Load_From_String( const wchar_t *value, void *destination ) const override
+		virtual bool Load_From_String( const wchar_t *value, void *destination ) const override
 		{
 			int64_t node_value = 0;
-			bool result = IP::String::Convert_Raw( value, node_value );
-			FATAL_ASSERT( result );
+			if ( !IP::String::Convert_Raw( value, node_value ) )
+			{
+				return false;
+			}
 
 			T *dest_ptr = reinterpret_cast< T * >( destination );
 			*dest_ptr = static_cast< T >( node_value );
+
+			return true;
 		}
 };
 
@@ -69,14 +74,18 @@ class CXMLUnsignedIntegerSerializer : public CPrimitiveXMLSerializer
 		CXMLUnsignedIntegerSerializer( void ) {}
 		virtual ~CXMLUnsignedIntegerSerializer() = default;
 
-		virtual void Load_From_String( const wchar_t *value, void *destination ) const override
+		virtual bool Load_From_String( const wchar_t *value, void *destination ) const override
 		{
 			uint64_t node_value = 0;
-			bool result = IP::String::Convert_Raw( value, node_value );
-			FATAL_ASSERT( result );
+			if ( !IP::String::Convert_Raw( value, node_value ) )
+			{
+				return false;
+			}
 
 			T *dest_ptr = reinterpret_cast< T * >( destination );
 			*dest_ptr = static_cast< T >( node_value );
+
+			return true;
 		}
 };
 
@@ -89,14 +98,18 @@ class CXMLDoubleSerializer : public CPrimitiveXMLSerializer
 		CXMLDoubleSerializer( void ) {}
 		virtual ~CXMLDoubleSerializer() = default;
 
-		virtual void Load_From_String( const wchar_t *value, void *destination ) const override
+		virtual bool Load_From_String( const wchar_t *value, void *destination ) const override
 		{
 			double node_value = 0;
-			bool result = IP::String::Convert_Raw( value, node_value );
-			FATAL_ASSERT( result );
+			if ( !IP::String::Convert_Raw( value, node_value ) )
+			{
+				return false;
+			}
 
 			T *dest_ptr = reinterpret_cast< T * >( destination );
 			*dest_ptr = static_cast< T >( node_value );
+
+			return true;
 		}
 };
 
@@ -108,12 +121,14 @@ class CXMLWideStringSerializer : public CPrimitiveXMLSerializer
 		CXMLWideStringSerializer( void ) {}
 		virtual ~CXMLWideStringSerializer() = default;
 
-		virtual void Load_From_String( const wchar_t *value, void *destination ) const override
+		virtual bool Load_From_String( const wchar_t *value, void *destination ) const override
 		{
 			std::wstring node_value( value );
 
 			std::wstring *dest_ptr = reinterpret_cast< std::wstring * >( destination );
 			*dest_ptr = node_value;
+
+			return true;
 		}
 };
 
@@ -125,13 +140,52 @@ class CXMLStringSerializer : public CPrimitiveXMLSerializer
 		CXMLStringSerializer( void ) {}
 		virtual ~CXMLStringSerializer() = default;
 
-		virtual void Load_From_String( const wchar_t *value, void *destination ) const override
+		virtual bool Load_From_String( const wchar_t *value, void *destination ) const override
 		{
 			std::string node_value;
 			IP::String::WideString_To_String( value, node_value );
 
 			std::string *dest_ptr = reinterpret_cast< std::string * >( destination );
 			*dest_ptr = node_value;
+
+			return true;
+		}
+};
+
+// A serializer for an interned narrow string
+class CXMLInternedStringSerializer : public CPrimitiveXMLSerializer
+{
+	public:
+		
+		CXMLInternedStringSerializer( void ) {}
+		virtual ~CXMLInternedStringSerializer() = default;
+
+		virtual bool Load_From_String( const wchar_t *value, void *destination ) const override
+		{
+			std::string node_value;
+			IP::String::WideString_To_String( value, node_value );
+
+			IP::String::CInternedString *dest_ptr = reinterpret_cast< IP::String::CInternedString * >( destination );
+			*dest_ptr = IP::String::CInternedString( node_value );
+
+			return true;
+		}
+};
+
+// A serializer for an interned wide string
+class CXMLInternedWideStringSerializer : public CPrimitiveXMLSerializer
+{
+	public:
+		
+		CXMLInternedWideStringSerializer( void ) {}
+		virtual ~CXMLInternedWideStringSerializer() = default;
+
+		virtual bool Load_From_String( const wchar_t *value, void *destination ) const override
+		{
+			IP::String::CInternedWideString *dest_ptr = reinterpret_cast< IP::String::CInternedWideString * >( destination );
+			*dest_ptr = IP::String::CInternedWideString( value );
+
+			return true;
 		}
 };
 
@@ -143,14 +197,18 @@ class CXMLBoolSerializer : public CPrimitiveXMLSerializer
 		CXMLBoolSerializer( void ) {}
 		virtual ~CXMLBoolSerializer() = default;
 
-		virtual void Load_From_String( const wchar_t *value, void *destination ) const override
+		virtual bool Load_From_String( const wchar_t *value, void *destination ) const override
 		{
 			bool node_value = false;
-			bool result = IP::String::Convert_Raw( value, node_value );
-			FATAL_ASSERT( result );
+			if ( !IP::String::Convert_Raw( value, node_value ) )
+			{
+				return false;
+			}
 
 			bool *dest_ptr = reinterpret_cast< bool * >( destination );
 			*dest_ptr = node_value;
+
+			return true;
 		}
 };
 
@@ -170,6 +228,8 @@ void Register_Primitive_Serializers( void )
 	REGISTER_PRIMITIVE_XML_SERIALIZER( double, new CXMLDoubleSerializer< double > );
 	REGISTER_PRIMITIVE_XML_SERIALIZER( float, new CXMLDoubleSerializer< float > );
 	REGISTER_PRIMITIVE_XML_SERIALIZER( bool, new CXMLBoolSerializer );
+	REGISTER_PRIMITIVE_XML_SERIALIZER( IP::String::CInternedString, new CXMLInternedStringSerializer );
+	REGISTER_PRIMITIVE_XML_SERIALIZER( IP::String::CInternedWideString, new CXMLInternedWideStringSerializer );
 }
 
 } // namespace XML
@@ -24,6 +24,7 @@
 #include "IPPlatform/StringUtils.h"
 #include "IPShared/EnumConversion.h"
 #include "IPShared/Serialization/SerializationHelpers.h"
+#include "IPShared/PerfectHashTable.h"
 
 namespace IP
 {
@@ -50,67 +51,66 @@ class CCompositeXMLSerializer : public IXMLSerializer
 
 		virtual ~CCompositeXMLSerializer() = default;
 
-		virtual void Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
+		virtual bool Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
 		{
 			uint8_t *byte_base_ptr = reinterpret_cast< uint8_t * >( destination );
 
 			for ( pugi::xml_node iter = xml_node.first_child(); iter; iter = iter.next_sibling() )
 			{
-				std::wstring node_name( iter.name() );
-				std::wstring upper_name;
-				IP::String::To_Upper_Case( node_name, upper_name );
-
-				auto member_iter = MemberRecords.find( upper_name );
-				FATAL_ASSERT( member_iter != MemberRecords.cend() );
+				const XMLMemberRecordType *member_record = MemberRecords.Find( iter.name() );
+				if ( member_record == nullptr )
+				{
+					return false;
+				}
 
-				IXMLSerializer *serializer = member_iter->second.second;
-				uint8_t *member_ptr = byte_base_ptr + member_iter->second.first;
+				IXMLSerializer *serializer = member_record->second;
+				uint8_t *member_ptr = byte_base_ptr + member_record->first;
 
-				serializer->Load_From_XML( iter, member_ptr );
+				if ( !serializer->Load_From_XML( iter, member_ptr ) )
+				{
+					return false;
+				}
 			}
 
 			for ( pugi::xml_attribute att_iter = xml_node.first_attribute(); att_iter; att_iter = att_iter.next_attribute() )
 			{
-				std::wstring attribute_name( att_iter.name() );
-				std::wstring upper_attribute_name;
-				IP::String::To_Upper_Case( attribute_name, upper_attribute_name );
-
-				auto record_iter = MemberRecords.find( upper_attribute_name );
-				if ( record_iter == MemberRecords.cend() )
+				const XMLMemberRecordType *member_record = MemberRecords.Find( att_iter.name() );
+				if ( member_record == nullptr )
 				{
-					if ( upper_attribute_name == L"TYPE" )
+					if ( MemberRecordTableType::Equals_Case_Insensitive( att_iter.name(), L"TYPE" ) )
 					{
 						continue;
 					}
 
-					FATAL_ASSERT( false );
+					return false;
 				}
 
-				IXMLSerializer *serializer = record_iter->second.second;
-				uint8_t *member_ptr = byte_base_ptr + record_iter->second.first;
+				IXMLSerializer *serializer = member_record->second;
+				uint8_t *member_ptr = byte_base_ptr + member_record->first;
 
-				serializer->Load_From_String( att_iter.value(), member_ptr );
+				if ( !serializer->Load_From_String( att_iter.value(), member_ptr ) )
+				{
+					return false;
+				}
 			}
+
+			return true;
 		}
 
 		void Add( const std::wstring &element_name, uint64_t offset, IXMLSerializer *serializer )
 		{
-			std::wstring upper_name;
-			IP::String::To_Upper_Case( element_name, upper_name );
-
-			Add_Member_Record( upper_name,  XMLMemberRecordType( offset, serializer ) );
+			Add_Member_Record( element_name,  XMLMemberRecordType( offset, serializer ) );
 		}
 
 	private:
 
 		virtual void Add_Member_Record( const std::wstring &member_name, const XMLMemberRecordType &member_record )
 		{
-			FATAL_ASSERT( MemberRecords.find( member_name ) == MemberRecords.cend() );
-
-			MemberRecords[ member_name ] = member_record;
+			MemberRecords.Insert( member_name, member_record );
 		}
 
-		using MemberRecordTableType = std::unordered_map< std::wstring, XMLMemberRecordType >;
+		// member names are matched case-insensitively; the set is fixed once the registrar finishes building this serializer
+		using MemberRecordTableType = IP::Algorithm::TCaseInsensitivePerfectHashTable< XMLMemberRecordType >;
 		MemberRecordTableType MemberRecords;
 };
 
@@ -124,7 +124,7 @@ class CVectorXMLSerializer : public IXMLSerializer
 			PrepDelegate( prep_delegate )
 		{
 			FATAL_ASSERT( EntrySerializer != nullptr );
-			FATAL_ASSERT( PrepDelegate != false );
+			FATAL_ASSERT( PrepDelegate != nullptr );
 		}
 
 		template< typename T >
@@ -135,12 +135,17 @@ class CVectorXMLSerializer : public IXMLSerializer
 
 		virtual ~CVectorXMLSerializer() = default;
 
-		virtual void Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
+		virtual bool Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
 		{
 			for ( pugi::xml_node iter = xml_node.first_child(); iter; iter = iter.next_sibling() )
 			{
-				EntrySerializer->Load_From_XML( iter, PrepDelegate( destination ) );
+				if ( !EntrySerializer->Load_From_XML( iter, PrepDelegate( destination ) ) )
+				{
+					return false;
+				}
 			}
+
+			return true;
 		}
 
 	private:
@@ -159,7 +164,7 @@ class CPointerXMLSerializer : public IXMLSerializer
 			PrepDelegate( prep_delegate )
 		{
 			FATAL_ASSERT( TSerializer != nullptr );
-			FATAL_ASSERT( PrepDelegate != false );
+			FATAL_ASSERT( PrepDelegate != nullptr );
 		}
 
 		template< typename T >
@@ -170,9 +175,9 @@ class CPointerXMLSerializer : public IXMLSerializer
 
 		virtual ~CPointerXMLSerializer() = default;
 
-		virtual void Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
+		virtual bool Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
 		{
-			TSerializer->Load_From_XML( xml_node, PrepDelegate( destination ) );
+			return TSerializer->Load_From_XML( xml_node, PrepDelegate( destination ) );
 		}
 
 	private:
@@ -191,19 +196,16 @@ class CEnumXMLSerializer : public IXMLSerializer
 
 		virtual ~CEnumXMLSerializer() = default;
 
-		virtual void Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
+		virtual bool Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
 		{
-			Load_From_String( xml_node.child_value(), destination );
+			return Load_From_String( xml_node.child_value(), destination );
 		}
 
-		virtual void Load_From_String( const wchar_t *value, void *destination ) const override
+		virtual bool Load_From_String( const wchar_t *value, void *destination ) const override
 		{
 			T *dest = reinterpret_cast< T * >( destination );
 
-			if ( !IP::Enum::CEnumConverter::Convert( value, *dest ) )
-			{
-				FATAL_ASSERT( false );
-			}
+			return IP::Enum::CEnumConverter::Convert( value, *dest );
 		}
 };
 
@@ -220,21 +222,24 @@ class CEnumPolymorphicXMLSerializer : public IXMLSerializer
 
 		virtual ~CEnumPolymorphicXMLSerializer() = default;
 
-		virtual void Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
+		// an unrecognized type fails the load and leaves the destination untouched
+		virtual bool Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
 		{
 			pugi::xml_attribute attrib = xml_node.attribute( L"Type" );
 
 			uint64_t type_value;
-			std::string attribute_value;
-
 			if ( !IP::Enum::CEnumConverter::Convert( EnumTypeInfo, std::wstring( attrib.value() ), type_value ) )
 			{
-				FATAL_ASSERT( false );
+				return false;
 			}
 
-			IXMLSerializer *serializer = Serializers.find( type_value )->second;
+			auto iter = Serializers.find( type_value );
+			if ( iter == Serializers.cend() )
+			{
+				return false;
+			}
 
-			serializer->Load_From_XML( xml_node, destination );
+			return iter->second->Load_From_XML( xml_node, destination );
 		}
 
 		void Add( uint64_t key, IXMLSerializer *serializer )
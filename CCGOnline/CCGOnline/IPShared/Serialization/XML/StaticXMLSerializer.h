@@ -0,0 +1,354 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include <type_traits>
+
+#include "IPShared/Serialization/XML/XMLSerializerInterface.h"
+#include "pugixml/pugixml.h"
+#include "IPPlatform/StringUtils.h"
+#include "IPShared/Serialization/SerializationHelpers.h"
+#include "IPShared/PerfectHashTable.h"
+#include "IPShared/InternedString.h"
+
+namespace IP
+{
+namespace Serialization
+{
+namespace XML
+{
+
+// Inline loaders for scalar member types (including interned strings); each parses exactly as the matching registered primitive serializer does.
+// Types without a specialization (enums, composites, vectors, pointers) are not scalar and keep the registrar path.
+template< typename U, typename Enable = void >
+struct TStaticXMLValueLoader
+{
+	static const bool IsScalar = false;
+
+	static bool Load_From_String( const wchar_t * /*value*/, U & /*destination*/ ) { FATAL_ASSERT( false ); return false; }
+};
+
+template< typename U >
+struct TStaticXMLValueLoader< U, typename std::enable_if< std::is_integral< U >::value && !std::is_same< U, bool >::value >::type >
+{
+	static const bool IsScalar = true;
+
+	static bool Load_From_String( const wchar_t *value, U &destination )
+	{
+		int64_t node_value = 0;
+		if ( !IP::String::Convert_Raw( value, node_value ) )
+		{
+			return false;
+		}
+
+		destination = static_cast< U >( node_value );
+
+		return true;
+	}
+};
+
+template< typename U >
+struct TStaticXMLValueLoader< U, typename std::enable_if< std::is_floating_point< U >::value >::type >
+{
+	static const bool IsScalar = true;
+
+	static bool Load_From_String( const wchar_t *value, U &destination )
+	{
+		double node_value = 0;
+		if ( !IP::String::Convert_Raw( value, node_value ) )
+		{
+			return false;
+		}
+
+		destination = static_cast< U >( node_value );
+
+		return true;
+	}
+};
+
+template<>
+struct TStaticXMLValueLoader< bool >
+{
+	static const bool IsScalar = true;
+
+	static bool Load_From_String( const wchar_t *value, bool &destination )
+	{
+		bool node_value = false;
+		if ( !IP::String::Convert_Raw( value, node_value ) )
+		{
+			return false;
+		}
+
+		destination = node_value;
+
+		return true;
+	}
+};
+
+template<>
+struct TStaticXMLValueLoader< std::wstring >
+{
+	static const bool IsScalar = true;
+
+	static bool Load_From_String( const wchar_t *value, std::wstring &destination )
+	{
+		destination = value;
+
+		return true;
+	}
+};
+
+template<>
+struct TStaticXMLValueLoader< std::string >
+{
+	static const bool IsScalar = true;
+
+	static bool Load_From_String( const wchar_t *value, std::string &destination )
+	{
+		IP::String::WideString_To_String( value, destination );
+
+		return true;
+	}
+};
+
+template<>
+struct TStaticXMLValueLoader< IP::String::CInternedString >
+{
+	static const bool IsScalar = true;
+
+	static bool Load_From_String( const wchar_t *value, IP::String::CInternedString &destination )
+	{
+		std::string node_value;
+		IP::String::WideString_To_String( value, node_value );
+
+		destination = IP::String::CInternedString( node_value );
+
+		return true;
+	}
+};
+
+template<>
+struct TStaticXMLValueLoader< IP::String::CInternedWideString >
+{
+	static const bool IsScalar = true;
+
+	static bool Load_From_String( const wchar_t *value, IP::String::CInternedWideString &destination )
+	{
+		destination = IP::String::CInternedWideString( value );
+
+		return true;
+	}
+};
+
+// A compile-time member descriptor; use XML_MEMBER( type, member ) rather than naming this directly
+template< typename P, P Member >
+struct TStaticXMLMember;
+
+template< typename O, typename U, U O::*Member >
+struct TStaticXMLMember< U O::*, Member >
+{
+	using OwnerType = O;
+	using MemberType = U;
+	using ValueLoaderType = TStaticXMLValueLoader< U >;
+
+	static const bool IsScalar = ValueLoaderType::IsScalar;
+
+	// offset of the member within T, where T is O or derives from it
+	template< typename T >
+	static uint64_t Get_Offset( void )
+	{
+		return Compute_Member_Offset< T, U >( static_cast< U T::* >( Member ) );
+	}
+
+	template< typename T >
+	static bool Load_From_String( const wchar_t *value, T *object )
+	{
+		return ValueLoaderType::Load_From_String( value, static_cast< O * >( object )->*Member );
+	}
+};
+
+// Resolves a descriptor index to its member's inline loader.  Each level compares against a constant, so the chain is
+// expanded in place within the owning serializer's load routine.
+template< typename T, uint32_t I, typename... Members >
+struct TStaticXMLMemberDispatch
+{
+	static bool Load_From_String( uint32_t /*index*/, const wchar_t * /*value*/, T * /*object*/ ) { FATAL_ASSERT( false ); return false; }
+};
+
+template< typename T, uint32_t I, typename Member, typename... Members >
+struct TStaticXMLMemberDispatch< T, I, Member, Members... >
+{
+	static bool Load_From_String( uint32_t index, const wchar_t *value, T *object )
+	{
+		if ( index == I )
+		{
+			return Member::Load_From_String( value, object );
+		}
+
+		return TStaticXMLMemberDispatch< T, I + 1, Members... >::Load_From_String( index, value, object );
+	}
+};
+
+// A composite serializer whose scalar members are listed at compile time.  Member names still come from the type's
+// registered bindings; a binding that matches a scalar descriptor (same offset and type) is loaded inline, everything
+// else (enums, polymorphic pointers, nested composites, vectors, unlisted members) goes through the registrar's serializer.
+template< typename T, typename... Members >
+class TStaticCompositeXMLSerializer : public IXMLSerializer
+{
+	public:
+
+		using BASECLASS = IXMLSerializer;
+
+		TStaticCompositeXMLSerializer( const std::vector< SXMLMemberBinding > &member_bindings ) :
+			BASECLASS(),
+			MemberRecords()
+		{
+			const uint64_t offsets[] = { Members::template Get_Offset< T >()... };
+			const Loki::TypeInfo member_types[] = { Loki::TypeInfo( typeid( typename Members::MemberType ) )... };
+			const bool is_scalar[] = { Members::IsScalar... };
+			const uint32_t member_count = static_cast< uint32_t >( sizeof...( Members ) );
+
+			std::vector< bool > matched( member_count, false );
+
+			for ( const auto &member_binding : member_bindings )
+			{
+				uint32_t static_index = INVALID_STATIC_INDEX;
+				for ( uint32_t i = 0; i < member_count; ++i )
+				{
+					if ( offsets[ i ] == member_binding.Offset && member_types[ i ] == member_binding.MemberType )
+					{
+						matched[ i ] = true;
+						if ( is_scalar[ i ] )
+						{
+							static_index = i;
+						}
+						break;
+					}
+				}
+
+				MemberRecords.Insert( member_binding.Name, SMemberRecord( static_index, member_binding.Offset, member_binding.Serializer ) );
+			}
+
+			// every descriptor must correspond to a registered binding
+			for ( uint32_t i = 0; i < member_count; ++i )
+			{
+				FATAL_ASSERT( matched[ i ] );
+			}
+		}
+
+		virtual ~TStaticCompositeXMLSerializer() = default;
+
+		static IXMLSerializer *Create( const std::vector< SXMLMemberBinding > &member_bindings )
+		{
+			return new TStaticCompositeXMLSerializer< T, Members... >( member_bindings );
+		}
+
+		virtual bool Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const override
+		{
+			T *object = reinterpret_cast< T * >( destination );
+			uint8_t *byte_base_ptr = reinterpret_cast< uint8_t * >( destination );
+
+			for ( pugi::xml_node iter = xml_node.first_child(); iter; iter = iter.next_sibling() )
+			{
+				const SMemberRecord *member_record = MemberRecords.Find( iter.name() );
+				if ( member_record == nullptr )
+				{
+					return false;
+				}
+
+				bool loaded = false;
+				if ( member_record->StaticIndex != INVALID_STATIC_INDEX )
+				{
+					loaded = DispatchType::Load_From_String( member_record->StaticIndex, iter.child_value(), object );
+				}
+				else
+				{
+					loaded = member_record->Serializer->Load_From_XML( iter, byte_base_ptr + member_record->Offset );
+				}
+
+				if ( !loaded )
+				{
+					return false;
+				}
+			}
+
+			for ( pugi::xml_attribute att_iter = xml_node.first_attribute(); att_iter; att_iter = att_iter.next_attribute() )
+			{
+				const SMemberRecord *member_record = MemberRecords.Find( att_iter.name() );
+				if ( member_record == nullptr )
+				{
+					if ( MemberRecordTableType::Equals_Case_Insensitive( att_iter.name(), L"TYPE" ) )
+					{
+						continue;
+					}
+
+					return false;
+				}
+
+				bool loaded = false;
+				if ( member_record->StaticIndex != INVALID_STATIC_INDEX )
+				{
+					loaded = DispatchType::Load_From_String( member_record->StaticIndex, att_iter.value(), object );
+				}
+				else
+				{
+					loaded = member_record->Serializer->Load_From_String( att_iter.value(), byte_base_ptr + member_record->Offset );
+				}
+
+				if ( !loaded )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+	private:
+
+		static const uint32_t INVALID_STATIC_INDEX = 0xFFFFFFFF;
+
+		struct SMemberRecord
+		{
+			SMemberRecord( uint32_t static_index, uint64_t offset, IXMLSerializer *serializer ) :
+				StaticIndex( static_index ),
+				Offset( offset ),
+				Serializer( serializer )
+			{}
+
+			uint32_t StaticIndex;
+			uint64_t Offset;
+			IXMLSerializer *Serializer;
+		};
+
+		using DispatchType = TStaticXMLMemberDispatch< T, 0, Members... >;
+		using MemberRecordTableType = IP::Algorithm::TCaseInsensitivePerfectHashTable< SMemberRecord >;
+
+		MemberRecordTableType MemberRecords;
+};
+
+} // namespace XML
+} // namespace Serialization
+} // namespace IP
+
+// Used between BEGIN_*_TYPE_DEFINITION and END_TYPE_DEFINITION; each argument is an XML_MEMBER( t, member )
+#define XML_MEMBER( t, m ) IP::Serialization::XML::TStaticXMLMember< decltype( &t::m ), &t::m >
+#define USE_STATIC_XML_SERIALIZER( t, ... ) definition->Set_XML_Composite_Factory( IP::Serialization::XML::TStaticCompositeXMLSerializer< t, __VA_ARGS__ >::Create );
@@ -0,0 +1,293 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include "IPShared/Serialization/XML/XMLSerializerInterface.h"
+#include "IPShared/Serialization/XML/XMLLoadableTableInterface.h"
+#include "IPShared/Serialization/XML/FlatTableIndex.h"
+#include "pugixml/pugixml.h"
+#include "IPShared/Serialization/SerializationRegistrar.h"
+
+namespace IP
+{
+namespace Serialization
+{
+namespace XML
+{
+
+// A loadable table that keeps its rows by value in one contiguous array, ordered by key, with the keys in a parallel
+// array for binary search.  Every row is exactly a T, so this suits leaf types; polymorphic tables stay with
+// CXMLLoadableTable.  Secondary indices are declared before loading and rebuilt whenever the rows change.
+template< typename K, typename T >
+class CXMLFlatLoadableTable : public IXMLLoadableTable
+{
+	public:
+
+		using BASECLASS = IXMLLoadableTable;
+
+		using KeyExtractorMemberFunction = const K & ( T::* )( void ) const ;
+		using PostLoadMemberFunction = void ( T::* )( void );
+		using RowIterator = typename std::vector< T >::const_iterator;
+
+		CXMLFlatLoadableTable( KeyExtractorMemberFunction key_extractor, const wchar_t *top_child = nullptr ) :
+			BASECLASS(),
+			KeyExtractor( key_extractor ),
+			PostLoad(),
+			TopChildName( top_child ? top_child : L"Objects" ),
+			Rows(),
+			Keys(),
+			Indices(),
+			StagedSerializer( nullptr ),
+			StagedRows(),
+			StagedKeys()
+		{
+		}
+
+		virtual ~CXMLFlatLoadableTable() = default;
+
+		void Load( const std::string &file_name ) 
+		{
+			pugi::xml_document doc;
+			pugi::xml_parse_result result = doc.load_file( file_name.c_str() );
+			FATAL_ASSERT( result == true );
+
+			Load( doc );
+		}
+
+		void Load( const pugi::xml_document &xml_doc ) 
+		{
+			IXMLSerializer *serializer = CSerializationRegistrar::Get_XML_Serializer< T >();
+			FATAL_ASSERT( serializer != nullptr );
+
+			std::vector< T > rows( Rows );
+			uint32_t first_file_row = static_cast< uint32_t >( rows.size() );
+
+			std::string error;
+			bool result = Load_Rows( xml_doc.child( TopChildName.c_str() ), serializer, rows, error );
+			FATAL_ASSERT( result );
+
+			std::vector< K > keys;
+			result = Sort_Rows( rows, keys, first_file_row, error );
+			FATAL_ASSERT( result );
+
+			Publish_Rows( rows, keys );
+		}
+
+		virtual void Begin_Staged_Load( void ) override
+		{
+			Abort_Staged_Load();
+
+			StagedSerializer = CSerializationRegistrar::Get_XML_Serializer< T >();
+			FATAL_ASSERT( StagedSerializer != nullptr );
+
+			StagedRows = Rows;
+			StagedKeys.clear();
+		}
+
+		virtual bool Stage_File( const std::string &file_name, std::string &error ) override
+		{
+			FATAL_ASSERT( StagedSerializer != nullptr );
+
+			pugi::xml_document doc;
+			pugi::xml_parse_result result = doc.load_file( file_name.c_str() );
+			if ( !result )
+			{
+				error = std::string( result.description() ) + " at offset " + std::to_string( result.offset );
+				return false;
+			}
+
+			pugi::xml_node top = doc.child( TopChildName.c_str() );
+			if ( !top )
+			{
+				error = "missing top-level element";
+				return false;
+			}
+
+			uint32_t first_file_row = static_cast< uint32_t >( StagedRows.size() );
+			if ( !Load_Rows( top, StagedSerializer, StagedRows, error ) )
+			{
+				error = file_name + ": " + error;
+				return false;
+			}
+
+			return Sort_Rows( StagedRows, StagedKeys, first_file_row, error );
+		}
+
+		virtual void Commit_Staged_Load( void ) override
+		{
+			FATAL_ASSERT( StagedRows.size() == StagedKeys.size() );
+
+			Publish_Rows( StagedRows, StagedKeys );
+
+			StagedSerializer = nullptr;
+		}
+
+		virtual void Abort_Staged_Load( void ) override
+		{
+			StagedRows.clear();
+			StagedKeys.clear();
+			StagedSerializer = nullptr;
+		}
+
+		const T *Get_Object( const K &key ) const
+		{
+			auto iter = std::lower_bound( Keys.cbegin(), Keys.cend(), key );
+			if ( iter != Keys.cend() && !( key < *iter ) )
+			{
+				return &Rows[ iter - Keys.cbegin() ];
+			}
+
+			return nullptr;
+		}
+
+		RowIterator cbegin( void ) const { return Rows.cbegin(); }
+		RowIterator cend( void ) const { return Rows.cend(); }
+		size_t Size( void ) const { return Rows.size(); }
+
+		void Set_Post_Load_Function( PostLoadMemberFunction post_load ) { PostLoad = post_load; }
+
+		// Secondary indices; the table owns them, and they stay valid (and current) for the table's lifetime
+		template< typename U >
+		const TFlatTableHashIndex< T, U > *Add_Hash_Index( U T::*member )
+		{
+			return Add_Index( new TFlatTableHashIndex< T, U >( member ) );
+		}
+
+		template< typename... U >
+		const TFlatTableSortedIndex< T, U... > *Add_Sorted_Index( U T::*... members )
+		{
+			return Add_Index( new TFlatTableSortedIndex< T, U... >( members... ) );
+		}
+
+	private:
+
+		CXMLFlatLoadableTable( const CXMLFlatLoadableTable &rhs ) = delete;
+		CXMLFlatLoadableTable & operator =( const CXMLFlatLoadableTable &rhs ) = delete;
+
+		template< typename I >
+		const I *Add_Index( I *index )
+		{
+			Indices.push_back( std::unique_ptr< IFlatTableIndex< T > >( index ) );
+			index->Build( Rows );
+
+			return index;
+		}
+
+		bool Load_Rows( const pugi::xml_node &top, IXMLSerializer *serializer, std::vector< T > &rows, std::string &error ) const
+		{
+			uint32_t row_index = 0;
+			for ( pugi::xml_node iter = top.first_child(); iter; iter = iter.next_sibling(), ++row_index )
+			{
+				rows.push_back( T() );
+
+				T &row = rows.back();
+				if ( !serializer->Load_From_XML( iter, &row ) )
+				{
+					error = "row " + std::to_string( row_index ) + " failed to deserialize";
+					return false;
+				}
+
+				if ( PostLoad != nullptr )
+				{
+					( row.*PostLoad )();
+				}
+			}
+
+			return true;
+		}
+
+		// Orders rows by key; fails on a duplicate key.  Rows are moved, so T must not hold pointers into itself.
+		// Rows from first_file_row on came from the file just read, and errors number them from the start of that file.
+		bool Sort_Rows( std::vector< T > &rows, std::vector< K > &keys, uint32_t first_file_row, std::string &error ) const
+		{
+			std::vector< std::pair< K, uint32_t > > order;
+			order.reserve( rows.size() );
+
+			for ( uint32_t i = 0; i < rows.size(); ++i )
+			{
+				order.push_back( std::pair< K, uint32_t >( ( rows[ i ].*KeyExtractor )(), i ) );
+			}
+
+			std::sort( order.begin(), order.end(), []( const std::pair< K, uint32_t > &lhs, const std::pair< K, uint32_t > &rhs ) { return lhs.first < rhs.first; } );
+
+			for ( uint32_t i = 1; i < order.size(); ++i )
+			{
+				if ( !( order[ i - 1 ].first < order[ i ].first ) )
+				{
+					// rows already in the table have unique keys, so the later of the pair always came from the file
+					error = "duplicate key in row " + std::to_string( std::max( order[ i - 1 ].second, order[ i ].second ) - first_file_row );
+					return false;
+				}
+			}
+
+			std::vector< T > sorted_rows;
+			sorted_rows.reserve( rows.size() );
+
+			for ( const auto &entry : order )
+			{
+				sorted_rows.push_back( std::move( rows[ entry.second ] ) );
+			}
+
+			rows.swap( sorted_rows );
+
+			keys.clear();
+			keys.reserve( order.size() );
+
+			for ( auto &entry : order )
+			{
+				keys.push_back( std::move( entry.first ) );
+			}
+
+			return true;
+		}
+
+		void Publish_Rows( std::vector< T > &rows, std::vector< K > &keys )
+		{
+			Rows.swap( rows );
+			Keys.swap( keys );
+
+			rows.clear();
+			keys.clear();
+
+			for ( auto &index : Indices )
+			{
+				index->Build( Rows );
+			}
+		}
+
+		KeyExtractorMemberFunction KeyExtractor;
+		PostLoadMemberFunction PostLoad;
+
+		std::wstring TopChildName;
+
+		std::vector< T > Rows;
+		std::vector< K > Keys;
+
+		std::vector< std::unique_ptr< IFlatTableIndex< T > > > Indices;
+
+		IXMLSerializer *StagedSerializer;
+		std::vector< T > StagedRows;
+		std::vector< K > StagedKeys;
+};
+
+} // namespace XML
+} // namespace Serialization
+} // namespace IP
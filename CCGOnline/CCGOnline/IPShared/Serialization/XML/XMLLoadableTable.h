@@ -20,8 +20,10 @@
 #pragma once
 
 #include "IPShared/Serialization/XML/XMLSerializerInterface.h"
+#include "IPShared/Serialization/XML/XMLLoadableTableInterface.h"
 #include "pugixml/pugixml.h"
 #include "IPShared/Serialization/SerializationRegistrar.h"
+#include "IPShared/Serialization/Binary/BinaryTableImage.h"
 
 namespace IP
 {
@@ -31,26 +33,33 @@ namespace XML
 {
 
 template< typename K, typename T >
-class CXMLLoadableTable
+class CXMLLoadableTable : public IXMLLoadableTable
 {
 	public:
 
+		using BASECLASS = IXMLLoadableTable;
+
 		using KeyExtractorMemberFunction = const K & ( T::* )( void ) const ;
 		using PostLoadMemberFunction = void ( T::* )( void );
 		using TableType = std::unordered_map< K, const T * >;
 		using TableIterator = typename TableType::const_iterator;
 
 		CXMLLoadableTable( KeyExtractorMemberFunction key_extractor, const wchar_t *top_child = nullptr ) :
+			BASECLASS(),
 			KeyExtractor( key_extractor ),
 			PostLoad(),
 			TopChildName( top_child ? top_child : L"Objects" ),
-			Loadables()
+			Loadables(),
+			StagedSerializer( nullptr ),
+			StagedLoadables()
 		{
 		}
 
-		~CXMLLoadableTable()
+		virtual ~CXMLLoadableTable()
 		{
-			std::for_each( Loadables.begin(), Loadables.end(), []( const TableType::value_type &val ) { delete val.second; } );
+			Abort_Staged_Load();
+
+			std::for_each( Loadables.begin(), Loadables.end(), []( const typename TableType::value_type &val ) { delete val.second; } );
 			Loadables.clear();
 		}
 
@@ -73,19 +82,167 @@ class CXMLLoadableTable
 			{
 				T *loadable = nullptr;
 
-				serializer->Load_From_XML( iter, &loadable );
+				bool loaded = serializer->Load_From_XML( iter, &loadable );
+				FATAL_ASSERT( loaded );
+
+				Add_Loadable( loadable );
+			}
+		}
+
+		// Uses the compiled image of the file if it is current, otherwise falls back to the XML; returns true if the image was used
+		bool Load( const std::string &file_name, const std::string &image_file_name )
+		{
+			uint32_t source_checksum = 0;
+			bool source_exists = Binary::CBinaryTableImage::Compute_Source_Checksum( file_name, source_checksum );
+			FATAL_ASSERT( source_exists );
+
+			Binary::CBinaryTableImage image;
+			if ( !image.Open( image_file_name, source_checksum ) )
+			{
+				Load( file_name );
+				return false;
+			}
+
+			Load( image );
+			return true;
+		}
+
+		void Load( const Binary::CBinaryTableImage &image )
+		{
+			Binary::IBinarySerializer *serializer = CSerializationRegistrar::Get_Binary_Serializer< T * >();
+			FATAL_ASSERT( serializer != nullptr );
+
+			Binary::CBinaryReader reader = image.Get_Payload_Reader();
+			for ( uint32_t i = 0; i < image.Get_Record_Count(); ++i )
+			{
+				T *loadable = nullptr;
+
+				serializer->Read_From_Binary( reader, &loadable );
+				Add_Loadable( loadable );
+			}
+
+			FATAL_ASSERT( reader.Is_Finished() );
+		}
+
+		// The offline half of Load( file, image ): rows are captured before the post load function runs, so it runs exactly once on either path.
+		// Pointer members that the XML may omit must be initialized by T's constructor.
+		bool Compile( const std::string &file_name, const std::string &image_file_name ) const
+		{
+			uint32_t source_checksum = 0;
+			if ( !Binary::CBinaryTableImage::Compute_Source_Checksum( file_name, source_checksum ) )
+			{
+				return false;
+			}
+
+			pugi::xml_document doc;
+			pugi::xml_parse_result result = doc.load_file( file_name.c_str() );
+			FATAL_ASSERT( result == true );
+
+			IXMLSerializer *xml_serializer = CSerializationRegistrar::Get_XML_Serializer< T * >();
+			FATAL_ASSERT( xml_serializer != nullptr );
+
+			Binary::IBinarySerializer *binary_serializer = CSerializationRegistrar::Get_Binary_Serializer< T * >();
+			FATAL_ASSERT( binary_serializer != nullptr );
+
+			Binary::CBinaryWriter writer;
+			uint32_t record_count = 0;
+
+			pugi::xml_node top = doc.child( TopChildName.c_str() );
+			for ( pugi::xml_node iter = top.first_child(); iter; iter = iter.next_sibling() )
+			{
+				T *loadable = nullptr;
+
+				if ( !xml_serializer->Load_From_XML( iter, &loadable ) )
+				{
+					delete loadable;
+					return false;
+				}
+
+				binary_serializer->Write_To_Binary( &loadable, writer );
+				++record_count;
+
+				delete loadable;
+			}
+
+			return Binary::CBinaryTableImage::Write( image_file_name, source_checksum, record_count, writer );
+		}
+
+		virtual void Begin_Staged_Load( void ) override
+		{
+			Abort_Staged_Load();
+
+			// serializers are built lazily into shared registrar tables, so resolve ours before any worker thread needs it
+			StagedSerializer = CSerializationRegistrar::Get_XML_Serializer< T * >();
+			FATAL_ASSERT( StagedSerializer != nullptr );
+		}
+
+		// The post load function runs here, on the staging thread, and so must not depend on other tables in the same load
+		virtual bool Stage_File( const std::string &file_name, std::string &error ) override
+		{
+			FATAL_ASSERT( StagedSerializer != nullptr );
+
+			pugi::xml_document doc;
+			pugi::xml_parse_result result = doc.load_file( file_name.c_str() );
+			if ( !result )
+			{
+				error = std::string( result.description() ) + " at offset " + std::to_string( result.offset );
+				return false;
+			}
+
+			pugi::xml_node top = doc.child( TopChildName.c_str() );
+			if ( !top )
+			{
+				error = "missing top-level element";
+				return false;
+			}
+
+			uint32_t row_index = 0;
+			for ( pugi::xml_node iter = top.first_child(); iter; iter = iter.next_sibling(), ++row_index )
+			{
+				T *loadable = nullptr;
+
+				if ( !StagedSerializer->Load_From_XML( iter, &loadable ) )
+				{
+					delete loadable;
+
+					error = file_name + ": row " + std::to_string( row_index ) + " failed to deserialize";
+					return false;
+				}
+
 				if ( PostLoad != nullptr )
 				{
 					(loadable->*PostLoad)();
 				}
 
-				FATAL_ASSERT( loadable != nullptr );
-
 				K key = (loadable->*KeyExtractor)();
-				FATAL_ASSERT( Loadables.find( key ) == Loadables.cend() );
+				if ( StagedLoadables.find( key ) != StagedLoadables.cend() || Loadables.find( key ) != Loadables.cend() )
+				{
+					delete loadable;
+
+					error = "duplicate key in row " + std::to_string( row_index );
+					return false;
+				}
 
-				Loadables[ key ] = loadable;
+				StagedLoadables[ key ] = loadable;
 			}
+
+			return true;
+		}
+
+		virtual void Commit_Staged_Load( void ) override
+		{
+			Loadables.insert( StagedLoadables.cbegin(), StagedLoadables.cend() );
+
+			StagedLoadables.clear();
+			StagedSerializer = nullptr;
+		}
+
+		virtual void Abort_Staged_Load( void ) override
+		{
+			std::for_each( StagedLoadables.begin(), StagedLoadables.end(), []( const typename TableType::value_type &val ) { delete val.second; } );
+
+			StagedLoadables.clear();
+			StagedSerializer = nullptr;
 		}
 
 		const T *Get_Object( const K &key ) const
@@ -106,12 +263,30 @@ class CXMLLoadableTable
 
 	private:
 
+		void Add_Loadable( T *loadable )
+		{
+			FATAL_ASSERT( loadable != nullptr );
+
+			if ( PostLoad != nullptr )
+			{
+				(loadable->*PostLoad)();
+			}
+
+			K key = (loadable->*KeyExtractor)();
+			FATAL_ASSERT( Loadables.find( key ) == Loadables.cend() );
+
+			Loadables[ key ] = loadable;
+		}
+
 		KeyExtractorMemberFunction KeyExtractor;
 		PostLoadMemberFunction PostLoad;
 
 		std::wstring TopChildName;
 
 		TableType Loadables;
+
+		IXMLSerializer *StagedSerializer;
+		TableType StagedLoadables;
 };
 
 } // namespace XML
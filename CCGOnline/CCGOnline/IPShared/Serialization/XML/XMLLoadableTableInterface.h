@@ -0,0 +1,48 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+namespace IP
+{
+namespace Serialization
+{
+namespace XML
+{
+
+// The staged-load protocol CXMLTableLoader uses to build tables on worker threads and publish them together.
+// Begin, Commit and Abort run on the owning thread; Stage_File may run on any thread, but only one at a time per table.
+class IXMLLoadableTable
+{
+	public:
+
+		IXMLLoadableTable( void ) {}
+		virtual ~IXMLLoadableTable() {}
+
+		virtual void Begin_Staged_Load( void ) = 0;
+		virtual bool Stage_File( const std::string &file_name, std::string &error ) = 0;
+		virtual void Commit_Staged_Load( void ) = 0;
+		virtual void Abort_Staged_Load( void ) = 0;
+
+};
+
+} // namespace XML
+} // namespace Serialization
+} // namespace IP
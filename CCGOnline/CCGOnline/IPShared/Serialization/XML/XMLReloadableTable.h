@@ -0,0 +1,117 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+#include "IPShared/Serialization/XML/XMLLoadableTable.h"
+#include "IPShared/Concurrency/QuiescentStateReclaimer.h"
+
+namespace IP
+{
+namespace Serialization
+{
+namespace XML
+{
+
+// A handle to a CXMLLoadableTable that can be replaced while processes are reading it.
+//
+// Readers call Get_Table() with no locking and may use the result until their read section ends (for processes, the
+// end of the current service frame); fetch it once per frame to see a consistent version.  Reload builds a complete
+// new table to the side and, only if every row loads, publishes it in a single atomic store and retires the previous
+// version to the reclaimer.
+template< typename K, typename T >
+class CXMLReloadableTable
+{
+	public:
+
+		using TableType = CXMLLoadableTable< K, T >;
+		using KeyExtractorMemberFunction = typename TableType::KeyExtractorMemberFunction;
+		using PostLoadMemberFunction = typename TableType::PostLoadMemberFunction;
+
+		CXMLReloadableTable( IP::Execution::CQuiescentStateReclaimer *reclaimer, KeyExtractorMemberFunction key_extractor, const wchar_t *top_child = nullptr ) :
+			Reclaimer( reclaimer ),
+			KeyExtractor( key_extractor ),
+			PostLoad(),
+			TopChildName( top_child ? top_child : L"Objects" ),
+			Current( new TableType( key_extractor, TopChildName.c_str() ) ),
+			Version( 0 ),
+			ReloadLock()
+		{
+			FATAL_ASSERT( Reclaimer != nullptr );
+		}
+
+		// All readers must be finished; retired versions still pending belong to the reclaimer
+		~CXMLReloadableTable()
+		{
+			delete Current.load();
+		}
+
+		const TableType *Get_Table( void ) const { return Current.load(); }
+		uint64_t Get_Version( void ) const { return Version.load(); }
+
+		// Replaces the whole table with the contents of the file; on failure the published version is untouched
+		bool Reload( const std::string &file_name, std::string &error )
+		{
+			std::lock_guard< std::mutex > lock( ReloadLock );
+
+			TableType *table = new TableType( KeyExtractor, TopChildName.c_str() );
+			table->Set_Post_Load_Function( PostLoad );
+
+			table->Begin_Staged_Load();
+			if ( !table->Stage_File( file_name, error ) )
+			{
+				delete table;
+				return false;
+			}
+
+			table->Commit_Staged_Load();
+
+			const TableType *old_table = Current.exchange( table );
+			Version.fetch_add( 1 );
+
+			Reclaimer->Retire_Object( old_table );
+			Reclaimer->Reclaim();
+
+			return true;
+		}
+
+		void Set_Post_Load_Function( PostLoadMemberFunction post_load ) { PostLoad = post_load; }
+
+	private:
+
+		CXMLReloadableTable( const CXMLReloadableTable &rhs ) = delete;
+		CXMLReloadableTable & operator =( const CXMLReloadableTable &rhs ) = delete;
+
+		IP::Execution::CQuiescentStateReclaimer *Reclaimer;
+
+		KeyExtractorMemberFunction KeyExtractor;
+		PostLoadMemberFunction PostLoad;
+
+		std::wstring TopChildName;
+
+		std::atomic< const TableType * > Current;
+		std::atomic< uint64_t > Version;
+
+		std::mutex ReloadLock;
+};
+
+} // namespace XML
+} // namespace Serialization
+} // namespace IP
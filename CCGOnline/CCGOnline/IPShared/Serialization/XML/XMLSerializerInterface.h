@@ -38,11 +38,30 @@ class IXMLSerializer
 		IXMLSerializer( void ) {}
 		virtual ~IXMLSerializer() {}
 
-		virtual void Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const = 0;
-		virtual void Load_From_String( const wchar_t * /*value*/, void * /*destination*/ ) const { FATAL_ASSERT( false ); }
+		// Both return false when the data cannot be loaded into the destination type, which may then be partially loaded
+		virtual bool Load_From_XML( const pugi::xml_node &xml_node, void *destination ) const = 0;
+		virtual bool Load_From_String( const wchar_t * /*value*/, void * /*destination*/ ) const { FATAL_ASSERT( false ); return false; }
 
 };
 
+// A registered member binding, resolved to the serializer the registrar chose for it
+struct SXMLMemberBinding
+{
+	public:
+
+		SXMLMemberBinding( const std::wstring &name, uint64_t offset, const Loki::TypeInfo &member_type, IXMLSerializer *serializer ) :
+			Name( name ),
+			Offset( offset ),
+			MemberType( member_type ),
+			Serializer( serializer )
+		{}
+
+		std::wstring Name;
+		uint64_t Offset;
+		Loki::TypeInfo MemberType;
+		IXMLSerializer *Serializer;
+};
+
 } // namespace XML
 } // namespace Serialization
 } // namespace IP
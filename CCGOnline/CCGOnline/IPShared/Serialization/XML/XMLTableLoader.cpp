@@ -0,0 +1,114 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPShared/Serialization/XML/XMLTableLoader.h"
+
+#include "IPShared/Serialization/XML/XMLLoadableTableInterface.h"
+
+namespace IP
+{
+namespace Serialization
+{
+namespace XML
+{
+
+CXMLTableLoader::CXMLTableLoader( void ) :
+	Requests(),
+	Errors()
+{
+}
+
+void CXMLTableLoader::Add_Table( IXMLLoadableTable *table, const std::string &file_name )
+{
+	FATAL_ASSERT( table != nullptr );
+
+	// a table may only be staged from one thread at a time
+	FATAL_ASSERT( std::none_of( Requests.cbegin(), Requests.cend(), [ = ]( const STableLoadRequest &request ){ return request.Table == table; } ) );
+
+	Requests.push_back( STableLoadRequest( table, file_name ) );
+}
+
+bool CXMLTableLoader::Load( uint32_t thread_count )
+{
+	Errors.clear();
+
+	if ( thread_count == 0 )
+	{
+		thread_count = std::max( std::thread::hardware_concurrency(), 1U );
+	}
+
+	thread_count = std::min( thread_count, static_cast< uint32_t >( Requests.size() ) );
+
+	for ( auto &request : Requests )
+	{
+		request.Succeeded = false;
+		request.Error.clear();
+		request.Table->Begin_Staged_Load();
+	}
+
+	std::atomic< size_t > next_request( 0 );
+	auto worker = [ & ]( void )
+	{
+		for ( size_t i = next_request++; i < Requests.size(); i = next_request++ )
+		{
+			STableLoadRequest &request = Requests[ i ];
+			request.Succeeded = request.Table->Stage_File( request.FileName, request.Error );
+		}
+	};
+
+	std::vector< std::thread > threads;
+	for ( uint32_t i = 1; i < thread_count; ++i )
+	{
+		threads.push_back( std::thread( worker ) );
+	}
+
+	worker();
+
+	std::for_each( threads.begin(), threads.end(), []( std::thread &thread ){ thread.join(); } );
+
+	for ( const auto &request : Requests )
+	{
+		if ( !request.Succeeded )
+		{
+			Errors.push_back( SXMLTableLoadError( request.FileName, request.Error ) );
+		}
+	}
+
+	bool success = Errors.empty();
+	for ( auto &request : Requests )
+	{
+		if ( success )
+		{
+			request.Table->Commit_Staged_Load();
+		}
+		else
+		{
+			request.Table->Abort_Staged_Load();
+		}
+	}
+
+	return success;
+}
+
+} // namespace XML
+} // namespace Serialization
+} // namespace IP
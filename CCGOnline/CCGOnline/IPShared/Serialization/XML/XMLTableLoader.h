@@ -0,0 +1,87 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+namespace IP
+{
+namespace Serialization
+{
+namespace XML
+{
+
+class IXMLLoadableTable;
+
+struct SXMLTableLoadError
+{
+	public:
+
+		SXMLTableLoadError( const std::string &file_name, const std::string &message ) :
+			FileName( file_name ),
+			Message( message )
+		{}
+
+		std::string FileName;
+		std::string Message;
+};
+
+// Loads a set of tables from their files concurrently; either every table receives its file's rows or none do
+class CXMLTableLoader
+{
+	public:
+
+		CXMLTableLoader( void );
+		~CXMLTableLoader() {}
+
+		void Add_Table( IXMLLoadableTable *table, const std::string &file_name );
+
+		// A thread count of zero uses one thread per hardware thread
+		bool Load( uint32_t thread_count = 0 );
+
+		const std::vector< SXMLTableLoadError > &Get_Errors( void ) const { return Errors; }
+
+	private:
+
+		struct STableLoadRequest
+		{
+			public:
+
+				STableLoadRequest( IXMLLoadableTable *table, const std::string &file_name ) :
+					Table( table ),
+					FileName( file_name ),
+					Succeeded( false ),
+					Error()
+				{}
+
+				IXMLLoadableTable *Table;
+				std::string FileName;
+
+				bool Succeeded;
+				std::string Error;
+		};
+
+		std::vector< STableLoadRequest > Requests;
+
+		std::vector< SXMLTableLoadError > Errors;
+};
+
+} // namespace XML
+} // namespace Serialization
+} // namespace IP
@@ -23,6 +23,7 @@
 
 #include "IPShared/Serialization/SerializationRegistrar.h"
 #include "IPShared/Serialization/XML/PrimitiveXMLSerializers.h"
+#include "IPShared/Serialization/Binary/PrimitiveBinarySerializers.h"
 #include "IPShared/SlashCommands/SlashCommandDataDefinition.h"
 
 using namespace IP::Command;
@@ -37,8 +38,9 @@ namespace Global
 void Register_IPShared_XML_Serializers( void )
 {
 	Register_Primitive_Serializers();
+	IP::Serialization::Binary::Register_Primitive_Serializers();
 
-	REGISTER_PRIMITIVE_XML_SERIALIZER( ESlashCommandParamType, new CEnumXMLSerializer< ESlashCommandParamType > );
+	REGISTER_ENUM_SERIALIZER( ESlashCommandParamType );
 
 	CSlashCommandParam::Register_Type_Definition();
 	CSlashCommandDataDefinition::Register_Type_Definition();
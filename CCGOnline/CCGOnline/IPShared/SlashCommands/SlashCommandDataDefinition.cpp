@@ -170,8 +170,7 @@ CSlashCommandDataDefinition::CSlashCommandDataDefinition( void ) :
 	Help( L"" ),
 	Key( L"" ),
 	Params(),
-	RequiredParamCount( 0 ),
-	TotalCaptureGroupCount( 0 )
+	RequiredParamCount( 0 )
 {
 }
 
@@ -206,8 +205,6 @@ void CSlashCommandDataDefinition::Post_Load_XML( void )
 	std::wstring key = CSlashCommandManager::Concat_Command( Command, SubCommand );
 	IP::String::To_Upper_Case( key, Key );
 
-	TotalCaptureGroupCount = Get_Match_Param_Start_Index();
-
 	// Validate default value, optional, and capture remaining
 	bool optional_encountered = false;
 	for ( uint32_t i = 0; i < Params.size(); ++i )
@@ -231,50 +228,7 @@ void CSlashCommandDataDefinition::Post_Load_XML( void )
 		{
 			RequiredParamCount++;
 		}
-
-		// The regular expression per parameter normally has two capture groups, but the capture remaining expression only has 1
-		TotalCaptureGroupCount += capture_remaining ? 1 : 2;
-	}
-}
-
-
-std::wstring CSlashCommandDataDefinition::Build_Command_Matcher( void ) const
-{
-	std::wstring match_string;
-
-	if ( SubCommand.size() == 0 )
-	{
-		match_string = L"^/(\\w+)";
-	}
-	else
-	{
-		match_string = L"^/(\\w+)\\s+(\\w+)";
 	}
-
-	for ( uint32_t i = 0; i < Params.size(); ++i )
-	{
-		const CSlashCommandParam &param = Params[ i ];
-		bool is_required = !param.Is_Optional();
-		bool consume_remaining = param.Should_Capture();
-
-		if ( is_required )
-		{
-			if ( consume_remaining )
-			{
-				match_string.append( L"\\s+([^\\r\\n]*)" );
-			}
-			else
-			{
-				match_string.append( L"(?:\\s+(?:(?:\"(.*?)\")|(\\S+)))" );
-			}
-		}
-		else
-		{
-			match_string.append( L"(?:\\s+(?:(?:\"(.*?)\")|(\\S+)))?" );
-		}
-	}
-
-	return match_string;
 }
 
 } // namespace Command
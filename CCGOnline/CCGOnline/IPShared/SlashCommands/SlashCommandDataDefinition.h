@@ -99,17 +99,13 @@ class CSlashCommandDataDefinition
 		const std::wstring &Get_Shortcut( void ) const { return Shortcut; }
 		const std::wstring &Get_Help( void ) const { return Help; }
 
-		uint32_t Get_Match_Param_Start_Index( void ) const { return SubCommand.size() == 0 ? 2 : 3; }
 		uint32_t Get_Required_Param_Count( void ) const { return RequiredParamCount; }
-		uint32_t Get_Total_Capture_Group_Count( void ) const { return TotalCaptureGroupCount; }
 
 		uint32_t Get_Param_Count( void ) const { return static_cast< uint32_t >( Params.size() ); }
 		const CSlashCommandParam *Get_Param( uint32_t index ) const;
 
 		const std::wstring &Get_Key( void ) const { return Key; }
 
-		std::wstring Build_Command_Matcher( void ) const;
-
 	private:
 
 		std::wstring Command;
@@ -122,7 +118,6 @@ class CSlashCommandDataDefinition
 		std::vector< CSlashCommandParam > Params;
 
 		uint32_t RequiredParamCount;				// unserialized, derived from Params properties
-		uint32_t TotalCaptureGroupCount;		// unserialized, derived from various properties
 };
 
 } // namespace Command
@@ -21,6 +21,7 @@
 
 #include "SlashCommandDefinition.h"
 #include "SlashCommandDataDefinition.h"
+#include "SlashCommandTokenizer.h"
 
 namespace IP
 {
@@ -28,10 +29,34 @@ namespace Command
 {
 
 CSlashCommandDefinition::CSlashCommandDefinition( const CSlashCommandDataDefinition *data_definition ) :
-	DataDefinition( data_definition ),
-	ParamMatchExpression( data_definition != nullptr ? data_definition->Build_Command_Matcher() : L"" )
+	DataDefinition( data_definition )
 {
 }
 
+
+// Fills one value per parameter; an empty value means the parameter was not supplied.  Fails only if a required
+// parameter could not be read at all.
+bool CSlashCommandDefinition::Match_Params( CSlashCommandTokenizer &tokenizer, std::vector< std::wstring > &param_values ) const
+{
+	FATAL_ASSERT( DataDefinition != nullptr );
+
+	uint32_t param_count = DataDefinition->Get_Param_Count();
+	param_values.assign( param_count, std::wstring() );
+
+	for ( uint32_t i = 0; i < param_count; ++i )
+	{
+		const CSlashCommandParam *param = DataDefinition->Get_Param( i );
+
+		bool matched = param->Should_Capture() ? tokenizer.Read_Remaining( param_values[ i ] ) : tokenizer.Read_Param( param_values[ i ] );
+		if ( !matched )
+		{
+			// parameters are positional, so nothing after a missing one can match either
+			return i >= DataDefinition->Get_Required_Param_Count();
+		}
+	}
+
+	return true;
+}
+
 } // namespace Command
 } // namespace IP
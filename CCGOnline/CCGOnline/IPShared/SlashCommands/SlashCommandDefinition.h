@@ -19,16 +19,15 @@
 
 #pragma once
 
-#include <regex>
-
 namespace IP
 {
 namespace Command
 {
 
 class CSlashCommandDataDefinition;
+class CSlashCommandTokenizer;
 
-// A wrapper class for all static data; we split the pattern matching regex away from the rest of the derived data
+// A wrapper class for all static data; we split parameter matching away from the rest of the derived data
 // so that a definition with a null data definition can represent a command family (clumsy)
 class CSlashCommandDefinition
 {
@@ -43,14 +42,13 @@ class CSlashCommandDefinition
 
 		bool Is_Family( void ) const { return DataDefinition == nullptr; }
 
-		const std::tr1::wregex &Get_Param_Match_Expression( void ) const { return ParamMatchExpression; }
+		// Operations
+		bool Match_Params( CSlashCommandTokenizer &tokenizer, std::vector< std::wstring > &param_values ) const;
 
 	private:
 
 		// Data
 		const CSlashCommandDataDefinition *DataDefinition;
-
-		std::tr1::wregex ParamMatchExpression;
 };
 
 } // namespace Command
@@ -22,6 +22,7 @@
 #include "SlashCommandDefinition.h"
 #include "SlashCommandDataDefinition.h"
 #include "SlashCommandInstance.h"
+#include "SlashCommandTokenizer.h"
 #include "IPPlatform/StringUtils.h"
 
 namespace IP
@@ -37,46 +38,35 @@ CSlashCommandInstance::CSlashCommandInstance( void ) :
 }
 
 
-bool CSlashCommandInstance::Parse( const std::wstring &command_line, const CSlashCommandDefinition *definition, std::wstring &error_msg )
+bool CSlashCommandInstance::Parse( CSlashCommandTokenizer &tokenizer, const CSlashCommandDefinition *definition, std::wstring &error_msg )
 {
-	const std::tr1::wregex &param_matcher = definition->Get_Param_Match_Expression();
-
-	std::tr1::wcmatch param_match_results;
-	std::tr1::regex_search( command_line.c_str(), param_match_results, param_matcher );
-
 	const CSlashCommandDataDefinition *data_def = definition->Get_Data_Definition();
 	uint32_t required_param_count = data_def->Get_Required_Param_Count();
-	uint32_t total_param_count = data_def->Get_Param_Count();
-	uint32_t param_start = data_def->Get_Match_Param_Start_Index();
 
-	Command = param_match_results[ 1 ];
-	if ( param_start > 2 )
+	// the definition's names rather than the typed ones, since the command may have been invoked through a shortcut
+	Command = data_def->Get_Command();
+	SubCommand = data_def->Get_Sub_Command();
+
+	if ( !definition->Match_Params( tokenizer, Params ) )
 	{
-		SubCommand = param_match_results[ 2 ];
+		error_msg = L"Insufficient number of parameters specified";
+		return false;
 	}
 
-	for ( uint32_t i = 0; i < total_param_count; ++i )
+	for ( uint32_t i = 0; i < Params.size(); ++i )
 	{
-		bool capture_remaining = data_def->Get_Param( i )->Should_Capture();
-
-		std::wstring param;
-		uint32_t param_capture_index = 2 * i + param_start;
-		if ( param_match_results.length( param_capture_index ) > 0 )
-		{
-			param = param_match_results.str( param_capture_index );
-		}
-		else if ( !capture_remaining && param_match_results.length( param_capture_index + 1 ) > 0 )
+		std::wstring &param = Params[ i ];
+		if ( param.size() == 0 )
 		{
-			param = param_match_results.str( param_capture_index + 1 );
-		}
-		else if ( i >= required_param_count )
-		{
-			param = data_def->Get_Param( i )->Get_Default();
-		}
-		else
-		{
-			error_msg = L"Insufficient number of parameters specified";
-			return false;
+			if ( i >= required_param_count )
+			{
+				param = data_def->Get_Param( i )->Get_Default();
+			}
+			else
+			{
+				error_msg = L"Insufficient number of parameters specified";
+				return false;
+			}
 		}
 
 		if ( !data_def->Get_Param( i )->Is_Value_Valid( param ) )
@@ -84,8 +74,6 @@ bool CSlashCommandInstance::Parse( const std::wstring &command_line, const CSlas
 			error_msg = L"Parameter value \"" + param + L"\" is not valid.";
 			return false;
 		}
-
-		Params.push_back( param );
 	}
 
 	return true;
@@ -19,12 +19,15 @@
 
 #pragma once
 
+#include "IPShared/EnumConversion.h"
+
 namespace IP
 {
 namespace Command
 {
 
 class CSlashCommandDefinition;
+class CSlashCommandTokenizer;
 
 // A class representing an instance/invokation of a slash command.
 class CSlashCommandInstance
@@ -36,7 +39,7 @@ class CSlashCommandInstance
 		~CSlashCommandInstance() {}
 
 		// Operations
-		bool Parse( const std::wstring &command, const CSlashCommandDefinition *definition, std::wstring &error_msg );
+		bool Parse( CSlashCommandTokenizer &tokenizer, const CSlashCommandDefinition *definition, std::wstring &error_msg );
 
 		void Reset( void );
 
@@ -65,7 +68,7 @@ class CSlashCommandInstance
 				return false;
 			}
 
-			return CEnumConverter::Convert( Params[ index ], value );
+			return IP::Enum::CEnumConverter::Convert( Params[ index ], value );
 		}
 
 	private:
@@ -24,9 +24,10 @@
 #include "SlashCommandDefinition.h"
 #include "SlashCommandDataDefinition.h"
 #include "SlashCommandInstance.h"
+#include "SlashCommandTokenizer.h"
+#include "SlashCommandTrie.h"
 #include "IPShared/Serialization/XML/XMLLoadableTable.h"
 #include "IPPlatform/StringUtils.h"
-#include <regex>
 
 using namespace IP::Serialization;
 using namespace IP::Serialization::XML;
@@ -38,6 +39,7 @@ namespace Command
 
 std::unique_ptr< CXMLLoadableTable< std::wstring, CSlashCommandDataDefinition > > CSlashCommandManager::DataDefinitions( nullptr );
 std::unordered_map< std::wstring, const CSlashCommandDefinition * > CSlashCommandManager::Definitions;
+CSlashCommandTrie CSlashCommandManager::CommandTrie;
 std::unordered_map< std::wstring, CSlashCommandManager::CommandHandlerDelegate > CSlashCommandManager::CommandHandlers;
 
 
@@ -57,6 +59,7 @@ void CSlashCommandManager::Shutdown( void )
 	}
 
 	Definitions.clear();
+	CommandTrie.Clear();
 
 	DataDefinitions = nullptr;
 
@@ -78,6 +81,14 @@ void CSlashCommandManager::Load_Command_File( const std::string &file_name )
 
 		CSlashCommandDefinition *definition = new CSlashCommandDefinition( iter->second );
 		Definitions[ iter->first ] = definition;
+		CommandTrie.Insert( iter->first, definition );
+
+		// a shortcut names the full command, subcommand included, in a single word
+		const std::wstring &shortcut = iter->second->Get_Shortcut();
+		if ( shortcut.size() > 0 )
+		{
+			CommandTrie.Insert( shortcut, definition );
+		}
 	}
 
 	// Create command family placeholder for command families
@@ -97,6 +108,7 @@ void CSlashCommandManager::Load_Command_File( const std::string &file_name )
 		{
 			CSlashCommandDefinition *family_data_definition = new CSlashCommandDefinition( nullptr );
 			Definitions[ upper_command ] = family_data_definition;
+			CommandTrie.Insert( upper_command, family_data_definition );
 		}
 	}
 }
@@ -110,67 +122,54 @@ std::wstring CSlashCommandManager::Concat_Command( const std::wstring &command,
 	}
 	else
 	{
-		return command + L"+" + sub_command;
+		return command + CSlashCommandTrie::SUB_COMMAND_SEPARATOR + sub_command;
 	}
 }
 
-static std::tr1::wregex _CommandPattern( L"^/(\\w+).*" );	// extracts the command
-static std::tr1::wregex _SubCommandPattern( L"^/(\\w+)\\s+(\\w+).*" ); // extracts the subcommand, if needed
-
-
 bool CSlashCommandManager::Parse_Command( const std::wstring &command_line, CSlashCommandInstance &command_instance, std::wstring &error_msg )
 {
-	// extract the command
-	std::tr1::wcmatch command_match_results;
-	std::tr1::regex_search( command_line.c_str(), command_match_results, _CommandPattern );
+	CSlashCommandTokenizer tokenizer( command_line );
 
-	std::wstring command = command_match_results[ 1 ];
-	if ( command.size() == 0 )
+	// extract the command
+	const wchar_t *command = nullptr;
+	uint32_t command_length = 0;
+	if ( !tokenizer.Read_Command( command, command_length ) )
 	{
 		error_msg = L"Invalid slash command specification";
 		return false;
 	}
 
-	std::wstring upper_command;
-	IP::String::To_Upper_Case( command, upper_command );
-	auto iter = Definitions.find( upper_command );
-	if ( iter == Definitions.cend() )
+	const CSlashCommandDefinition *definition = CommandTrie.Find( command, command_length );
+	if ( definition == nullptr )
 	{
-		error_msg = L"No such command exists: " + command;
+		error_msg = L"No such command exists: " + std::wstring( command, command_length );
 		return false;
 	}
 
 	// if there's no subcommand, extract parameters
-	const CSlashCommandDefinition *definition = iter->second;
 	if ( !definition->Is_Family() )
 	{
-		return command_instance.Parse( command_line, definition, error_msg );
+		return command_instance.Parse( tokenizer, definition, error_msg );
 	}
 
 	// extract the subcommand
-	std::tr1::wcmatch sub_command_match_results;
-	std::tr1::regex_search( command_line.c_str(), sub_command_match_results, _SubCommandPattern );
-
-	std::wstring sub_command = sub_command_match_results[ 2 ];
-	if ( sub_command.size() == 0 )
+	const wchar_t *sub_command = nullptr;
+	uint32_t sub_command_length = 0;
+	if ( !tokenizer.Read_Word( sub_command, sub_command_length ) )
 	{
-		error_msg = L"Invalid subcommand for command family: " + command;
+		error_msg = L"Invalid subcommand for command family: " + std::wstring( command, command_length );
 		return false;
 	}
 
-	std::wstring upper_sub_command;
-	IP::String::To_Upper_Case( sub_command, upper_sub_command );
-
-	std::wstring concat_command = Concat_Command( upper_command, upper_sub_command );
-	iter = Definitions.find( concat_command );
-	if ( iter == Definitions.end() )
+	definition = CommandTrie.Find( command, command_length, sub_command, sub_command_length );
+	if ( definition == nullptr )
 	{
-		error_msg = L"Unknown subcommand ( " + sub_command + L" ) for command family: " + command;
+		error_msg = L"Unknown subcommand ( " + std::wstring( sub_command, sub_command_length ) + L" ) for command family: " + std::wstring( command, command_length );
 		return false;
 	}
 
 	// extract parameters
-	return command_instance.Parse( command_line, iter->second, error_msg );
+	return command_instance.Parse( tokenizer, definition, error_msg );
 }
 
 
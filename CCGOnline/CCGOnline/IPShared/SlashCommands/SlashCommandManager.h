@@ -37,6 +37,7 @@ namespace Command
 class CSlashCommandInstance;
 class CSlashCommandDefinition;
 class CSlashCommandDataDefinition;
+class CSlashCommandTrie;
 
 // Static interface to the slash command system
 class CSlashCommandManager
@@ -70,6 +71,8 @@ class CSlashCommandManager
 
 		static std::unordered_map< std::wstring, const CSlashCommandDefinition * > Definitions;
 
+		static CSlashCommandTrie CommandTrie;		// parse-time lookup over Definitions' keys plus shortcuts
+
 		static std::unordered_map< std::wstring, CommandHandlerDelegate > CommandHandlers;
 };
 
@@ -0,0 +1,186 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "SlashCommandTokenizer.h"
+
+#include <cwctype>
+
+namespace IP
+{
+namespace Command
+{
+
+static bool Is_Word_Character( wchar_t character )
+{
+	return std::iswalnum( character ) != 0 || character == L'_';
+}
+
+
+static bool Is_Whitespace( wchar_t character )
+{
+	return std::iswspace( character ) != 0;
+}
+
+
+static bool Is_Line_Break( wchar_t character )
+{
+	return character == L'\r' || character == L'\n';
+}
+
+
+CSlashCommandTokenizer::CSlashCommandTokenizer( const std::wstring &command_line ) :
+	CommandLine( command_line ),
+	Position( 0 )
+{
+}
+
+
+uint32_t CSlashCommandTokenizer::Skip_Word( uint32_t index ) const
+{
+	uint32_t length = static_cast< uint32_t >( CommandLine.size() );
+	while ( index < length && Is_Word_Character( CommandLine[ index ] ) )
+	{
+		++index;
+	}
+
+	return index;
+}
+
+
+uint32_t CSlashCommandTokenizer::Skip_Whitespace( uint32_t index ) const
+{
+	uint32_t length = static_cast< uint32_t >( CommandLine.size() );
+	while ( index < length && Is_Whitespace( CommandLine[ index ] ) )
+	{
+		++index;
+	}
+
+	return index;
+}
+
+
+bool CSlashCommandTokenizer::Read_Command( const wchar_t *&token, uint32_t &token_length )
+{
+	if ( Position != 0 || CommandLine.size() == 0 || CommandLine[ 0 ] != L'/' )
+	{
+		return false;
+	}
+
+	uint32_t word_end = Skip_Word( 1 );
+	if ( word_end == 1 )
+	{
+		return false;
+	}
+
+	token = CommandLine.c_str() + 1;
+	token_length = word_end - 1;
+	Position = word_end;
+
+	return true;
+}
+
+
+bool CSlashCommandTokenizer::Read_Word( const wchar_t *&token, uint32_t &token_length )
+{
+	uint32_t word_start = Skip_Whitespace( Position );
+	if ( word_start == Position )
+	{
+		return false;
+	}
+
+	uint32_t word_end = Skip_Word( word_start );
+	if ( word_end == word_start )
+	{
+		return false;
+	}
+
+	token = CommandLine.c_str() + word_start;
+	token_length = word_end - word_start;
+	Position = word_end;
+
+	return true;
+}
+
+
+bool CSlashCommandTokenizer::Read_Param( std::wstring &param )
+{
+	uint32_t param_start = Skip_Whitespace( Position );
+	if ( param_start == Position || param_start == CommandLine.size() )
+	{
+		return false;
+	}
+
+	uint32_t length = static_cast< uint32_t >( CommandLine.size() );
+
+	// a quoted parameter runs to the next quote on the same line; without one, the quote is just part of a bare parameter
+	if ( CommandLine[ param_start ] == L'"' )
+	{
+		uint32_t quote_end = param_start + 1;
+		while ( quote_end < length && CommandLine[ quote_end ] != L'"' && !Is_Line_Break( CommandLine[ quote_end ] ) )
+		{
+			++quote_end;
+		}
+
+		if ( quote_end < length && CommandLine[ quote_end ] == L'"' )
+		{
+			param.assign( CommandLine, param_start + 1, quote_end - param_start - 1 );
+			Position = quote_end + 1;
+			return true;
+		}
+	}
+
+	uint32_t param_end = param_start;
+	while ( param_end < length && !Is_Whitespace( CommandLine[ param_end ] ) )
+	{
+		++param_end;
+	}
+
+	param.assign( CommandLine, param_start, param_end - param_start );
+	Position = param_end;
+
+	return true;
+}
+
+
+bool CSlashCommandTokenizer::Read_Remaining( std::wstring &remaining )
+{
+	uint32_t remaining_start = Skip_Whitespace( Position );
+	if ( remaining_start == Position )
+	{
+		return false;
+	}
+
+	uint32_t length = static_cast< uint32_t >( CommandLine.size() );
+	uint32_t remaining_end = remaining_start;
+	while ( remaining_end < length && !Is_Line_Break( CommandLine[ remaining_end ] ) )
+	{
+		++remaining_end;
+	}
+
+	remaining.assign( CommandLine, remaining_start, remaining_end - remaining_start );
+	Position = remaining_end;
+
+	return true;
+}
+
+} // namespace Command
+} // namespace IP
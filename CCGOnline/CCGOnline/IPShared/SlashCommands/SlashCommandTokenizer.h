@@ -0,0 +1,60 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+namespace IP
+{
+namespace Command
+{
+
+// A forward-only scanner over a slash command line.  Each read consumes one element of the command grammar: the
+// leading "/command", a whitespace-separated word, a quoted or bare parameter, or the remainder of the line.
+// A failed read leaves the position unchanged.
+class CSlashCommandTokenizer
+{
+	public:
+
+		// Construction/destruction
+		CSlashCommandTokenizer( const std::wstring &command_line );
+		~CSlashCommandTokenizer() {}
+
+		// Operations
+		bool Read_Command( const wchar_t *&token, uint32_t &token_length );
+		bool Read_Word( const wchar_t *&token, uint32_t &token_length );
+		bool Read_Param( std::wstring &param );
+		bool Read_Remaining( std::wstring &remaining );
+
+	private:
+
+		CSlashCommandTokenizer( const CSlashCommandTokenizer &rhs ) = delete;
+		CSlashCommandTokenizer &operator =( const CSlashCommandTokenizer &rhs ) = delete;
+
+		uint32_t Skip_Word( uint32_t index ) const;
+		uint32_t Skip_Whitespace( uint32_t index ) const;
+
+		// Data
+		const std::wstring &CommandLine;
+
+		uint32_t Position;
+};
+
+} // namespace Command
+} // namespace IP
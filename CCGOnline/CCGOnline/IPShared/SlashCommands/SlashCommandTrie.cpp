@@ -0,0 +1,139 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "SlashCommandTrie.h"
+
+#include <cwctype>
+
+namespace IP
+{
+namespace Command
+{
+
+static wchar_t Fold_Case( wchar_t character )
+{
+	return static_cast< wchar_t >( std::towupper( character ) );
+}
+
+
+const wchar_t CSlashCommandTrie::SUB_COMMAND_SEPARATOR;
+
+
+CSlashCommandTrie::CSlashCommandTrie( void ) :
+	Nodes( 1 )
+{
+}
+
+
+void CSlashCommandTrie::Clear( void )
+{
+	Nodes.clear();
+	Nodes.resize( 1 );
+}
+
+
+void CSlashCommandTrie::Insert( const std::wstring &key, const CSlashCommandDefinition *definition )
+{
+	FATAL_ASSERT( key.size() > 0 && definition != nullptr );
+
+	uint32_t node_index = 0;
+	for ( uint32_t i = 0; i < key.size(); ++i )
+	{
+		wchar_t folded_character = Fold_Case( key[ i ] );
+
+		uint32_t child_index = Find_Child( node_index, folded_character );
+		if ( child_index == INVALID_NODE )
+		{
+			child_index = static_cast< uint32_t >( Nodes.size() );
+			Nodes.push_back( SNode() );
+			Nodes[ node_index ].Children.push_back( std::make_pair( folded_character, child_index ) );
+		}
+
+		node_index = child_index;
+	}
+
+	FATAL_ASSERT( Nodes[ node_index ].Definition == nullptr );
+	Nodes[ node_index ].Definition = definition;
+}
+
+
+const CSlashCommandDefinition *CSlashCommandTrie::Find( const wchar_t *command, uint32_t command_length ) const
+{
+	uint32_t node_index = Walk( 0, command, command_length );
+	if ( node_index == INVALID_NODE )
+	{
+		return nullptr;
+	}
+
+	return Nodes[ node_index ].Definition;
+}
+
+
+const CSlashCommandDefinition *CSlashCommandTrie::Find( const wchar_t *command, uint32_t command_length, const wchar_t *sub_command, uint32_t sub_command_length ) const
+{
+	uint32_t node_index = Walk( 0, command, command_length );
+	if ( node_index != INVALID_NODE )
+	{
+		node_index = Walk( node_index, &SUB_COMMAND_SEPARATOR, 1 );
+	}
+
+	if ( node_index != INVALID_NODE )
+	{
+		node_index = Walk( node_index, sub_command, sub_command_length );
+	}
+
+	if ( node_index == INVALID_NODE )
+	{
+		return nullptr;
+	}
+
+	return Nodes[ node_index ].Definition;
+}
+
+
+uint32_t CSlashCommandTrie::Find_Child( uint32_t node_index, wchar_t key ) const
+{
+	const SNode &node = Nodes[ node_index ];
+	for ( uint32_t i = 0; i < node.Children.size(); ++i )
+	{
+		if ( node.Children[ i ].first == key )
+		{
+			return node.Children[ i ].second;
+		}
+	}
+
+	return INVALID_NODE;
+}
+
+
+uint32_t CSlashCommandTrie::Walk( uint32_t node_index, const wchar_t *key, uint32_t key_length ) const
+{
+	for ( uint32_t i = 0; i < key_length && node_index != INVALID_NODE; ++i )
+	{
+		node_index = Find_Child( node_index, Fold_Case( key[ i ] ) );
+	}
+
+	return node_index;
+}
+
+} // namespace Command
+} // namespace IP
@@ -0,0 +1,76 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#pragma once
+
+namespace IP
+{
+namespace Command
+{
+
+class CSlashCommandDefinition;
+
+// A case-insensitive prefix tree mapping command keys ("COMMAND", "COMMAND+SUBCOMMAND", shortcuts) to their
+// definitions.  Lookups walk the typed characters in place, so parsing never builds upper-cased key strings.
+class CSlashCommandTrie
+{
+	public:
+
+		// Construction/destruction
+		CSlashCommandTrie( void );
+		~CSlashCommandTrie() {}
+
+		// Operations
+		void Insert( const std::wstring &key, const CSlashCommandDefinition *definition );
+		void Clear( void );
+
+		const CSlashCommandDefinition *Find( const wchar_t *command, uint32_t command_length ) const;
+		const CSlashCommandDefinition *Find( const wchar_t *command, uint32_t command_length, const wchar_t *sub_command, uint32_t sub_command_length ) const;
+
+		// Joins a command and its sub command in a key
+		static const wchar_t SUB_COMMAND_SEPARATOR = L'+';
+
+	private:
+
+		CSlashCommandTrie( const CSlashCommandTrie &rhs ) = delete;
+		CSlashCommandTrie &operator =( const CSlashCommandTrie &rhs ) = delete;
+
+		struct SNode
+		{
+			SNode( void ) :
+				Children(),
+				Definition( nullptr )
+			{}
+
+			std::vector< std::pair< wchar_t, uint32_t > > Children;		// command names are short and sparse, so a linear scan beats a map here
+			const CSlashCommandDefinition *Definition;
+		};
+
+		uint32_t Find_Child( uint32_t node_index, wchar_t key ) const;
+		uint32_t Walk( uint32_t node_index, const wchar_t *key, uint32_t key_length ) const;
+
+		// Data
+		std::vector< SNode > Nodes;
+
+		static const uint32_t INVALID_NODE = 0xFFFFFFFF;
+};
+
+} // namespace Command
+} // namespace IP
@@ -90,7 +90,7 @@ void CStructuredExceptionHandler::Write_Exception_File( const CStructuredExcepti
 {
 	std::wstring file_name = Get_Log_File_Prefix() + L"Exception.txt";
 
-	std::basic_ofstream< wchar_t > exception_file( file_name.c_str(), std::ios_base::out | std::ios_base::trunc );
+	std::basic_ofstream< wchar_t > exception_file( IP::File::Get_Native_Path( file_name ).c_str(), std::ios_base::out | std::ios_base::trunc );
 
 	exception_file << L"******************** FATAL EXCEPTION ********************\n";
 	exception_file << L"Exception: " << shared_exception_info.Get_Exception_Message() << L"\n";
@@ -147,7 +147,7 @@ void CStructuredExceptionHandler::Archive_Logs( void )
 
 	std::wstring archive_name = archive_name_string.rdbuf()->str();
 
-	std::basic_ofstream< wchar_t > archive_file( archive_name.c_str(), std::ios_base::out | std::ios_base::trunc );
+	std::basic_ofstream< wchar_t > archive_file( IP::File::Get_Native_Path( archive_name ).c_str(), std::ios_base::out | std::ios_base::trunc );
 
 	std::wstring log_pattern = Get_Log_File_Prefix() + L"*.txt";
 
@@ -159,7 +159,7 @@ void CStructuredExceptionHandler::Archive_Logs( void )
 
 	for ( uint32_t i = 0; i < file_names.size(); i++ )
 	{
-		std::basic_ifstream< wchar_t > log_file( CLogInterface::Get_Log_Path() + file_names[ i ], std::ios_base::in );
+		std::basic_ifstream< wchar_t > log_file( IP::File::Get_Native_Path( CLogInterface::Get_Log_Path() + file_names[ i ] ).c_str(), std::ios_base::in );
 
 		archive_file << L"File: " << file_names[ i ] << L"\n\n";
 		while( log_file.good() )
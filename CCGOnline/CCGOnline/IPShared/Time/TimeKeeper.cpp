@@ -28,18 +28,25 @@ namespace Time
 {
 
 CTimeKeeper::CTimeKeeper( void ) :
-	BaseTime()
+	BaseTime(),
+	CachedTime()
 {
 }
 
-SystemTimePoint CTimeKeeper::Get_Current_Time( void ) const 
+MonotonicTimePoint CTimeKeeper::Get_Current_Time( void ) const 
 { 
-	return Get_Current_System_Time(); 
+	return Get_Current_Monotonic_Time(); 
 }
 
-SystemDuration CTimeKeeper::Get_Elapsed_Time( void ) const
+void CTimeKeeper::Set_Base_Time( MonotonicTimePoint base_time )
 {
-	return Get_Current_Time() - Get_Base_Time();
+	BaseTime = base_time;
+	CachedTime = base_time;
+}
+
+MonotonicDuration CTimeKeeper::Get_Elapsed_Time( void ) const
+{
+	return CachedTime - BaseTime;
 }
 
 
@@ -48,5 +55,37 @@ double CTimeKeeper::Get_Elapsed_Seconds( void ) const
 	return Convert_Duration_To_Seconds( Get_Elapsed_Time() );
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CSimulatedTimeKeeper::CSimulatedTimeKeeper( void ) :
+	BASECLASS(),
+	SimulatedTime()
+{
+}
+
+void CSimulatedTimeKeeper::Set_Base_Time( MonotonicTimePoint base_time )
+{
+	SimulatedTime = base_time;
+	BASECLASS::Set_Base_Time( base_time );
+}
+
+void CSimulatedTimeKeeper::Advance_To( double elapsed_seconds )
+{
+	MonotonicTimePoint target_time = Get_Base_Time() + Convert_Seconds_To_Duration< MonotonicDuration >( elapsed_seconds );
+
+	// The conversion truncates; round up so that a task due at elapsed_seconds is actually due once we get there
+	if ( Convert_Duration_To_Seconds( target_time - Get_Base_Time() ) < elapsed_seconds )
+	{
+		target_time += MonotonicDuration( 1 );
+	}
+
+	if ( target_time > SimulatedTime )
+	{
+		SimulatedTime = target_time;
+	}
+
+	Refresh();
+}
+
 } // namespace Time
 } // namespace IP
\ No newline at end of file
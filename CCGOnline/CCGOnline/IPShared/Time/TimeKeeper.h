@@ -26,7 +26,8 @@ namespace IP
 namespace Time
 {
 
-// Class that tracks the current tick times for one or more time types
+// Class that tracks elapsed monotonic time since a base point.  The current time is sampled once per Refresh() and
+// cached, so that everything serviced in one pass agrees on "now" without reading the clock again.
 class CTimeKeeper
 {
 	public:
@@ -34,16 +35,40 @@ class CTimeKeeper
 		CTimeKeeper( void );
 		virtual ~CTimeKeeper() {}
 
-		virtual SystemTimePoint Get_Current_Time( void ) const;
-		SystemTimePoint Get_Base_Time( void ) const { return BaseTime; }
-		virtual void Set_Base_Time( SystemTimePoint base_time ) { BaseTime = base_time; }
+		void Refresh( void ) { CachedTime = Get_Current_Time(); }
 
-		SystemDuration Get_Elapsed_Time( void ) const;
+		virtual MonotonicTimePoint Get_Current_Time( void ) const;
+		MonotonicTimePoint Get_Base_Time( void ) const { return BaseTime; }
+		virtual void Set_Base_Time( MonotonicTimePoint base_time );
+
+		MonotonicDuration Get_Elapsed_Time( void ) const;
 		double Get_Elapsed_Seconds( void ) const;
 		
 	private:
 
-		SystemTimePoint BaseTime;
+		MonotonicTimePoint BaseTime;
+		MonotonicTimePoint CachedTime;
+};
+
+// A time keeper whose clock never moves on its own; the owner advances it explicitly
+class CSimulatedTimeKeeper : public CTimeKeeper
+{
+	public:
+
+		using BASECLASS = CTimeKeeper;
+
+		CSimulatedTimeKeeper( void );
+		virtual ~CSimulatedTimeKeeper() {}
+
+		virtual MonotonicTimePoint Get_Current_Time( void ) const override { return SimulatedTime; }
+		virtual void Set_Base_Time( MonotonicTimePoint base_time ) override;
+
+		// Moves the clock forward so that Get_Elapsed_Seconds() is at least elapsed_seconds
+		void Advance_To( double elapsed_seconds );
+
+	private:
+
+		MonotonicTimePoint SimulatedTime;
 };
 
 } // namespace Time
@@ -0,0 +1,105 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+
+#include "stdafx.h"
+
+#include "IPShared/Serialization/Binary/BinaryStream.h"
+
+using namespace IP::Serialization::Binary;
+
+TEST( BinaryStreamTests, Varint_Encoding )
+{
+	CBinaryWriter writer;
+
+	writer.Write_Varint( 0 );
+	ASSERT_TRUE( writer.Get_Size() == 1 );
+
+	writer.Write_Varint( 127 );
+	ASSERT_TRUE( writer.Get_Size() == 2 );
+
+	writer.Write_Varint( 128 );
+	ASSERT_TRUE( writer.Get_Size() == 4 );
+
+	writer.Write_Varint( 0xFFFFFFFFFFFFFFFFULL );
+	ASSERT_TRUE( writer.Get_Size() == 14 );
+
+	writer.Write_Signed_Varint( -1 );
+	ASSERT_TRUE( writer.Get_Size() == 15 );
+
+	writer.Write_Signed_Varint( -64 );
+	writer.Write_Signed_Varint( 64 );
+	ASSERT_TRUE( writer.Get_Size() == 18 );
+
+	writer.Write_Signed_Varint( INT64_MIN );
+	writer.Write_Signed_Varint( INT64_MAX );
+
+	CBinaryReader reader( writer.Get_Buffer().data(), writer.Get_Size() );
+	ASSERT_TRUE( reader.Read_Varint() == 0 );
+	ASSERT_TRUE( reader.Read_Varint() == 127 );
+	ASSERT_TRUE( reader.Read_Varint() == 128 );
+	ASSERT_TRUE( reader.Read_Varint() == 0xFFFFFFFFFFFFFFFFULL );
+	ASSERT_TRUE( reader.Read_Signed_Varint() == -1 );
+	ASSERT_TRUE( reader.Read_Signed_Varint() == -64 );
+	ASSERT_TRUE( reader.Read_Signed_Varint() == 64 );
+	ASSERT_TRUE( reader.Read_Signed_Varint() == INT64_MIN );
+	ASSERT_TRUE( reader.Read_Signed_Varint() == INT64_MAX );
+	ASSERT_TRUE( reader.Is_Finished() );
+}
+
+TEST( BinaryStreamTests, Zero_Copy_Reads )
+{
+	const char *text = "zero copy";
+	size_t text_length = strlen( text );
+
+	CBinaryWriter writer;
+	writer.Write< float >( 1.25f );
+	writer.Write_Varint( text_length );
+	writer.Write_Bytes( text, text_length );
+
+	const std::vector< uint8_t > &buffer = writer.Get_Buffer();
+
+	CBinaryReader reader( buffer.data(), buffer.size() );
+	ASSERT_TRUE( reader.Read< float >() == 1.25f );
+	ASSERT_TRUE( reader.Read_Varint() == text_length );
+
+	const uint8_t *bytes = reader.Read_Bytes( text_length );
+	ASSERT_TRUE( bytes == buffer.data() + sizeof( float ) + 1 );
+	ASSERT_TRUE( memcmp( bytes, text, text_length ) == 0 );
+	ASSERT_TRUE( reader.Get_Remaining() == 0 );
+}
+
+TEST( BinaryStreamTests, Fixed_Width_Little_Endian )
+{
+	CBinaryWriter writer;
+	writer.Write< uint32_t >( 0x01020304 );
+	writer.Write< float >( 1.0f );
+	writer.Write< double >( -1.5 );
+
+	const uint8_t expected[] = { 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBF };
+	ASSERT_TRUE( writer.Get_Size() == sizeof( expected ) );
+	ASSERT_TRUE( memcmp( writer.Get_Buffer().data(), expected, sizeof( expected ) ) == 0 );
+
+	CBinaryReader reader( writer.Get_Buffer().data(), writer.Get_Size() );
+	ASSERT_TRUE( reader.Read< uint32_t >() == 0x01020304 );
+	ASSERT_TRUE( reader.Read< float >() == 1.0f );
+	ASSERT_TRUE( reader.Read< double >() == -1.5 );
+	ASSERT_TRUE( reader.Is_Finished() );
+}
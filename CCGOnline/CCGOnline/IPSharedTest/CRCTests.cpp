@@ -0,0 +1,165 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+
+#include "stdafx.h"
+
+#include "IPShared/CRC.h"
+
+using namespace IP::CRC;
+
+// The straightforward bitwise definition of the polynomial, to check the table and carry-less paths against
+static CRCValue Reference_CRC( const uint8_t *memory, size_t length )
+{
+	uint32_t crc = 0xFFFFFFFF;
+	for ( size_t i = 0; i < length; ++i )
+	{
+		crc ^= static_cast< uint32_t >( memory[ i ] ) << 24;
+		for ( uint32_t bit = 0; bit < 8; ++bit )
+		{
+			crc = ( crc & 0x80000000 ) != 0 ? ( crc << 1 ) ^ 0x04C11DB7 : crc << 1;
+		}
+	}
+
+	return ~crc;
+}
+
+static std::vector< uint8_t > Build_Test_Buffer( size_t length )
+{
+	std::vector< uint8_t > buffer( length );
+
+	uint32_t seed = 0x12345678;
+	for ( size_t i = 0; i < length; ++i )
+	{
+		seed = seed * 1664525 + 1013904223;
+		buffer[ i ] = static_cast< uint8_t >( seed >> 24 );
+	}
+
+	return buffer;
+}
+
+TEST( CRCTests, Known_Values )
+{
+	ASSERT_TRUE( String_To_CRC( std::string( "123456789" ) ) == 0xFC891918 );
+	ASSERT_TRUE( CRC_Memory( nullptr, 0 ) == 0 );
+}
+
+TEST( CRCTests, Matches_Reference )
+{
+	std::vector< uint8_t > buffer = Build_Test_Buffer( 1024 );
+
+	// every length through several carry-less blocks, from both an aligned and an unaligned start
+	for ( size_t length = 0; length < 300; ++length )
+	{
+		ASSERT_TRUE( CRC_Memory( buffer.data(), length ) == Reference_CRC( buffer.data(), length ) );
+		ASSERT_TRUE( CRC_Memory( buffer.data() + 3, length ) == Reference_CRC( buffer.data() + 3, length ) );
+	}
+
+	ASSERT_TRUE( CRC_Memory( buffer.data(), buffer.size() ) == Reference_CRC( buffer.data(), buffer.size() ) );
+}
+
+TEST( CRCTests, Streaming )
+{
+	std::vector< uint8_t > buffer = Build_Test_Buffer( 300 );
+	CRCValue expected_crc = CRC_Memory( buffer.data(), buffer.size() );
+
+	for ( size_t split = 0; split <= buffer.size(); split += 7 )
+	{
+		CCRCStream stream;
+		stream.Update( buffer.data(), split );
+		stream.Update( buffer.data() + split, buffer.size() - split );
+
+		ASSERT_TRUE( stream.Get_Value() == expected_crc );
+	}
+
+	CCRCStream stream;
+	for ( size_t i = 0; i < buffer.size(); ++i )
+	{
+		stream.Update( &buffer[ i ], 1 );
+	}
+
+	ASSERT_TRUE( stream.Get_Value() == expected_crc );
+
+	stream.Reset();
+	ASSERT_TRUE( stream.Get_Value() == CRC_Memory( nullptr, 0 ) );
+}
+
+TEST( CRCTests, Case_Insensitive )
+{
+	std::string mixed_case( "Berserker_Janitor_Bard" );
+	std::string upper_case( "BERSERKER_JANITOR_BARD" );
+	ASSERT_TRUE( String_To_CRC_Case_Insensitive( mixed_case ) == String_To_CRC( upper_case ) );
+
+	std::wstring wide_mixed_case( L"Berserker_Janitor_Bard" );
+	std::wstring wide_upper_case( L"BERSERKER_JANITOR_BARD" );
+	ASSERT_TRUE( String_To_CRC_Case_Insensitive( wide_mixed_case ) == String_To_CRC( wide_upper_case ) );
+
+	// long enough to cross the folding buffer and take the carry-less path per chunk
+	std::string long_mixed_case;
+	std::string long_upper_case;
+	for ( uint32_t i = 0; i < 40; ++i )
+	{
+		long_mixed_case.append( mixed_case );
+		long_upper_case.append( upper_case );
+	}
+
+	ASSERT_TRUE( String_To_CRC_Case_Insensitive( long_mixed_case ) == String_To_CRC( long_upper_case ) );
+
+	CCRCStream stream;
+	stream.Update_Case_Insensitive( long_mixed_case.c_str(), 100 );
+	stream.Update_Case_Insensitive( long_mixed_case.c_str() + 100, long_mixed_case.size() - 100 );
+	ASSERT_TRUE( stream.Get_Value() == String_To_CRC( long_upper_case ) );
+}
+
+#ifdef IP_HAS_CONSTEXPR
+
+using namespace IP::CRC::Literals;
+
+static_assert( "123456789"_crc == 0xFC891918, "Compile-time CRC does not match the CRC-32 check value" );
+static_assert( "Berserker"_crci == "BERSERKER"_crc, "Compile-time case folding is inconsistent" );
+
+static uint32_t Classify_Identifier( const std::string &identifier )
+{
+	switch ( String_To_CRC_Case_Insensitive( identifier ) )
+	{
+		case "Berserker"_crci:
+			return 1;
+
+		case "Janitor"_crci:
+			return 2;
+
+		default:
+			return 0;
+	}
+}
+
+TEST( CRCTests, Compile_Time )
+{
+	ASSERT_TRUE( "Berserker"_crc == String_To_CRC( std::string( "Berserker" ) ) );
+	ASSERT_TRUE( "Berserker_Janitor_Bard_0123456789_!@#$%^&*()"_crc == String_To_CRC( std::string( "Berserker_Janitor_Bard_0123456789_!@#$%^&*()" ) ) );
+	ASSERT_TRUE( "Janitor"_crci == String_To_CRC_Case_Insensitive( std::string( "jAnItOr" ) ) );
+	ASSERT_TRUE( ""_crc == CRC_Memory( nullptr, 0 ) );
+
+	ASSERT_TRUE( Classify_Identifier( "berserker" ) == 1 );
+	ASSERT_TRUE( Classify_Identifier( "JANITOR" ) == 2 );
+	ASSERT_TRUE( Classify_Identifier( "Bard" ) == 0 );
+}
+
+#endif // IP_HAS_CONSTEXPR
@@ -57,23 +57,20 @@ class CTimeKeeperProxy : public CTimeKeeper
 
 		virtual ~CTimeKeeperProxy() {}
 
-		virtual SystemTimePoint Get_Current_Time( void ) const override { return CurrentTime; }
+		virtual MonotonicTimePoint Get_Current_Time( void ) const override { return CurrentTime; }
 
-		virtual void Set_Base_Time( SystemTimePoint base_time ) override {
+		virtual void Set_Base_Time( MonotonicTimePoint base_time ) override {
 			BASECLASS::Set_Base_Time( base_time );
 			CurrentTime = base_time; 
 		}
 
 	   void Advance_Current_Time( double seconds ) {
-			uint64_t advance_microseconds = static_cast< uint64_t >( seconds * std::chrono::microseconds::period::num / std::chrono::microseconds::period::den );
-			std::chrono::microseconds advance_duration( advance_microseconds );
-
-			CurrentTime += std::chrono::duration_cast< SystemDuration >( advance_duration );
+			CurrentTime += Convert_Seconds_To_Duration< MonotonicDuration >( seconds );
 		}
 		
 	private:
 
-		SystemTimePoint CurrentTime;
+		MonotonicTimePoint CurrentTime;
 
 };
 
@@ -124,11 +121,16 @@ class CConcurrencyManagerTester
 			Manager( new CConcurrencyManager )
 		{
 			auto timekeeper = new CTimeKeeperProxy;
-			timekeeper->Set_Base_Time( Get_Current_System_Time() );
+			timekeeper->Set_Base_Time( Get_Current_Monotonic_Time() );
 
 			Manager->TimeKeeper.reset( timekeeper );
 		}
 
+		CConcurrencyManagerTester( EConcurrencyTimeMode time_mode ) :
+			Manager( new CConcurrencyManager( time_mode ) )
+		{
+		}
+
 		~CConcurrencyManagerTester()
 		{
 		}
@@ -139,6 +141,14 @@ class CConcurrencyManagerTester
 			Manager->Setup_For_Run( virtual_process );
 		}
 
+		void Run( const std::shared_ptr< IManagedProcess > &virtual_process )
+		{
+			Manager->Initialize( false );
+			Manager->Run( virtual_process );
+		}
+
+		double Get_Elapsed_Seconds( void ) const { return Manager->TimeKeeper->Get_Elapsed_Seconds(); }
+
 		void Run_One_Iteration( void )
 		{
 			Manager->Service_One_Iteration();
@@ -564,3 +574,85 @@ TEST_F( ConcurrencyManagerTests, Stress )
 		manager_tester.Wait_For_Shutdown();
 	}
 }
+
+// Services itself every simulated minute, records when, and shuts down after two simulated hours
+class CPeriodicProcess : public CTaskProcessBase
+{
+	public:
+
+		using BASECLASS = CTaskProcessBase;
+
+		CPeriodicProcess( const SProcessProperties &properties, uint32_t service_limit ) :
+			BASECLASS( properties ),
+			ServiceLimit( service_limit ),
+			ServiceTimes()
+		{}
+
+		virtual bool Is_Root_Thread( void ) const { return true; }
+
+		virtual void Run( const CProcessExecutionContext &context )
+		{
+			BASECLASS::Run( context );
+
+			// the process is serviced once more to handle the shutdown request
+			if ( ServiceTimes.size() == ServiceLimit )
+			{
+				return;
+			}
+
+			ServiceTimes.push_back( Get_Current_Process_Time() );
+			if ( ServiceTimes.size() == ServiceLimit )
+			{
+				std::unique_ptr< const IProcessMessage > shutdown_msg( new CShutdownProcessMessage( Get_ID() ) );
+				Send_Manager_Message( shutdown_msg );
+			}
+		}
+
+		const std::vector< double > &Get_Service_Times( void ) const { return ServiceTimes; }
+
+	protected:
+
+		virtual double Get_Reschedule_Interval( void ) const { return 60.0; }
+
+	private:
+
+		uint32_t ServiceLimit;
+
+		std::vector< double > ServiceTimes;
+};
+
+static const SProcessProperties PERIODIC_PROCESS_PROPERTIES( ETestExtendedProcessSubject::AI, 1, 1, 1 );
+
+TEST_F( ConcurrencyManagerTests, Simulated_Time )
+{
+	static const uint32_t SERVICE_LIMIT = 121;
+
+	std::vector< double > first_run_times;
+	for ( uint32_t run = 0; run < 2; ++run )
+	{
+		CConcurrencyManagerTester manager_tester( EConcurrencyTimeMode::SIMULATED );
+
+		std::shared_ptr< CPeriodicProcess > process( new CPeriodicProcess( PERIODIC_PROCESS_PROPERTIES, SERVICE_LIMIT ) );
+		manager_tester.Run( process );
+
+		// two hours pass in virtual time, with each service landing exactly where it was scheduled
+		const std::vector< double > &service_times = process->Get_Service_Times();
+		ASSERT_TRUE( service_times.size() == SERVICE_LIMIT );
+		for ( uint32_t i = 0; i < service_times.size(); ++i )
+		{
+			ASSERT_NEAR( service_times[ i ], 60.0 * i, .001 );
+		}
+
+		ASSERT_TRUE( manager_tester.Get_Elapsed_Seconds() >= 7200.0 );
+
+		// and a second run reproduces the first exactly
+		if ( run == 0 )
+		{
+			first_run_times = service_times;
+		}
+		else
+		{
+			ASSERT_TRUE( service_times == first_run_times );
+		}
+	}
+}
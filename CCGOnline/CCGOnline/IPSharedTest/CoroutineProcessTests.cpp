@@ -0,0 +1,311 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPShared/Concurrency/CoroutineProcessBase.h"
+
+#if defined( __cpp_impl_coroutine )
+
+#include "IPShared/Concurrency/ProcessMailbox.h"
+#include "IPShared/Concurrency/ProcessMessageFrame.h"
+#include "IPShared/Concurrency/MailboxInterfaces.h"
+#include "IPShared/Concurrency/ProcessID.h"
+#include "IPShared/Concurrency/Messaging/ProcessRequestMessages.h"
+#include "Helpers/ProcessHelpers.h"
+#include "SharedTestProcessSubject.h"
+
+using namespace IP::Execution;
+using namespace IP::Execution::Messaging;
+
+class CoroutineProcessTests : public testing::Test 
+{
+	protected:  
+
+
+};
+
+static const SProcessProperties GAME_PROPS( ETestExtendedProcessSubject::AI );
+static const EProcessID UNREACHABLE_PROCESS_ID = static_cast< EProcessID >( static_cast< uint64_t >( EProcessID::FIRST_FREE_ID ) + 5 );
+
+class CRoundStartedMessage : public IProcessMessage
+{
+	public:
+
+		using BASECLASS = IProcessMessage;
+
+		CRoundStartedMessage( uint32_t round ) :
+			BASECLASS(),
+			Round( round )
+		{}
+
+		virtual ~CRoundStartedMessage() = default;
+
+		uint32_t Get_Round( void ) const { return Round; }
+
+	private:
+
+		uint32_t Round;
+};
+
+class CRoundResultsRequest : public IProcessRequest
+{
+	public:
+
+		using BASECLASS = IProcessRequest;
+
+		CRoundResultsRequest( void ) :
+			BASECLASS()
+		{}
+
+		virtual ~CRoundResultsRequest() = default;
+};
+
+class CRoundResultsResponse : public IProcessMessage
+{
+	public:
+
+		using BASECLASS = IProcessMessage;
+
+		CRoundResultsResponse( void ) :
+			BASECLASS()
+		{}
+
+		virtual ~CRoundResultsResponse() = default;
+};
+
+// Sets a flag when the frame holding it is destroyed
+class CFrameDestructionWitness
+{
+	public:
+
+		CFrameDestructionWitness( bool &destroyed ) :
+			Destroyed( destroyed )
+		{}
+
+		~CFrameDestructionWitness() { Destroyed = true; }
+
+	private:
+
+		bool &Destroyed;
+};
+
+class CMatchFlowProcess : public CCoroutineProcessBase
+{
+	public:
+
+		using BASECLASS = CCoroutineProcessBase;
+
+		CMatchFlowProcess( const SProcessProperties &properties, bool &abandoned_frame_destroyed ) :
+			BASECLASS( properties ),
+			Rounds(),
+			TimerFiredTime( 0.0 ),
+			TimedOutResponse( false ),
+			RoundCompletions( 0 ),
+			AbandonedFrameDestroyed( abandoned_frame_destroyed )
+		{}
+
+		virtual bool Is_Root_Thread( void ) const { return true; }
+
+		const std::vector< uint32_t > &Get_Rounds( void ) const { return Rounds; }
+		double Get_Timer_Fired_Time( void ) const { return TimerFiredTime; }
+		bool Get_Timed_Out_Response( void ) const { return TimedOutResponse; }
+		uint32_t Get_Round_Completions( void ) const { return RoundCompletions; }
+
+	protected:
+
+		virtual void Register_Message_Handlers( void ) override
+		{
+			BASECLASS::Register_Message_Handlers();
+
+			Register_Awaitable_Message< CRoundStartedMessage >();
+		}
+
+		virtual CProcessCoroutine Run_Process_Body( void ) override
+		{
+			std::unique_ptr< const CRoundStartedMessage > first_round = co_await Wait_For_Message< CRoundStartedMessage >();
+			Rounds.push_back( first_round->Get_Round() );
+
+			co_await Wait_For_Seconds( 2.0 );
+			TimerFiredTime = Get_Current_Process_Time();
+
+			// round 3 is taken first; round 2 waits in the queue for the next unfiltered wait
+			std::unique_ptr< const CRoundStartedMessage > third_round = co_await Wait_For_Message< CRoundStartedMessage >( []( const CRoundStartedMessage &message ) { return message.Get_Round() == 3; } );
+			Rounds.push_back( third_round->Get_Round() );
+
+			std::unique_ptr< const CRoundStartedMessage > second_round = co_await Wait_For_Message< CRoundStartedMessage >();
+			Rounds.push_back( second_round->Get_Round() );
+
+			std::unique_ptr< const CRoundResultsResponse > results = co_await Wait_For_Response< CRoundResultsResponse >( UNREACHABLE_PROCESS_ID, std::make_unique< CRoundResultsRequest >(), 1.0 );
+			TimedOutResponse = results == nullptr;
+
+			// short-lived coroutines reuse pooled frames
+			for ( uint32_t i = 0; i < 3; ++i )
+			{
+				Complete_Round();
+				co_await Wait_For_Seconds( 1.0 );
+			}
+
+			// left suspended for the process to destroy
+			Abandon_Round();
+		}
+
+	private:
+
+		CProcessCoroutine Complete_Round( void )
+		{
+			co_await Wait_For_Seconds( 0.5 );
+			++RoundCompletions;
+		}
+
+		CProcessCoroutine Abandon_Round( void )
+		{
+			CFrameDestructionWitness witness( AbandonedFrameDestroyed );
+
+			co_await Wait_For_Message< CRoundStartedMessage >();
+		}
+
+		std::vector< uint32_t > Rounds;
+		double TimerFiredTime;
+		bool TimedOutResponse;
+		uint32_t RoundCompletions;
+
+		bool &AbandonedFrameDestroyed;
+};
+
+static void Send_Round_Started( CTaskProcessBaseTester &process_tester, const std::vector< uint32_t > &rounds )
+{
+	std::unique_ptr< CProcessMessageFrame > frame( new CProcessMessageFrame( EProcessID::CONCURRENCY_MANAGER ) );
+	for ( auto iter = rounds.cbegin(), end = rounds.cend(); iter != end; ++iter )
+	{
+		frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CRoundStartedMessage( *iter ) ) );
+	}
+
+	process_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( frame );
+}
+
+TEST_F( CoroutineProcessTests, Match_Flow )
+{
+	bool abandoned_frame_destroyed = false;
+
+	{
+		CMatchFlowProcess *process = new CMatchFlowProcess( GAME_PROPS, abandoned_frame_destroyed );
+		CTaskProcessBaseTester process_tester( process );
+
+		process_tester.Service( 0.0 );
+		ASSERT_TRUE( process->Get_Live_Coroutine_Count() == 1 );
+		ASSERT_TRUE( process->Get_Rounds().empty() );
+
+		Send_Round_Started( process_tester, { 1 } );
+		process_tester.Service( 0.5 );
+		ASSERT_TRUE( process->Get_Rounds() == std::vector< uint32_t >( { 1 } ) );
+
+		process_tester.Service( 2.0 );
+		ASSERT_DOUBLE_EQ( process->Get_Timer_Fired_Time(), 0.0 );
+
+		process_tester.Service( 2.5 );
+		ASSERT_DOUBLE_EQ( process->Get_Timer_Fired_Time(), 2.5 );
+
+		Send_Round_Started( process_tester, { 2, 3 } );
+		process_tester.Service( 3.0 );
+		ASSERT_TRUE( process->Get_Rounds() == std::vector< uint32_t >( { 1, 3, 2 } ) );
+		ASSERT_FALSE( process->Get_Timed_Out_Response() );
+
+		// the request times out at 4.0 and the first short-lived round starts
+		process_tester.Service( 4.0 );
+		ASSERT_TRUE( process->Get_Timed_Out_Response() );
+		ASSERT_TRUE( process->Get_Live_Coroutine_Count() == 2 );
+
+		process_tester.Service( 4.5 );
+		ASSERT_TRUE( process->Get_Round_Completions() == 1 );
+		ASSERT_TRUE( process->Get_Live_Coroutine_Count() == 1 );
+
+		size_t allocated_frames = process->Get_Frame_Pool().Get_Allocated_Count();
+
+		process_tester.Service( 5.0 );
+		process_tester.Service( 5.5 );
+		process_tester.Service( 6.0 );
+		process_tester.Service( 6.5 );
+		ASSERT_TRUE( process->Get_Round_Completions() == 3 );
+		ASSERT_TRUE( process->Get_Frame_Pool().Get_Allocated_Count() == allocated_frames );
+
+		// the body finished and left the abandoned round suspended
+		process_tester.Service( 7.0 );
+		ASSERT_TRUE( process->Get_Live_Coroutine_Count() == 1 );
+		ASSERT_FALSE( abandoned_frame_destroyed );
+	}
+
+	ASSERT_TRUE( abandoned_frame_destroyed );
+}
+
+class CParkedTimerProcess : public CCoroutineProcessBase
+{
+	public:
+
+		using BASECLASS = CCoroutineProcessBase;
+
+		CParkedTimerProcess( const SProcessProperties &properties, bool &parked_frame_destroyed ) :
+			BASECLASS( properties ),
+			ParkedFrameDestroyed( parked_frame_destroyed )
+		{}
+
+		virtual bool Is_Root_Thread( void ) const { return true; }
+
+	protected:
+
+		virtual CProcessCoroutine Run_Process_Body( void ) override
+		{
+			Park_On_Timer();
+
+			co_await Wait_For_Seconds( 10.0 );
+		}
+
+	private:
+
+		CProcessCoroutine Park_On_Timer( void )
+		{
+			CFrameDestructionWitness witness( ParkedFrameDestroyed );
+
+			co_await Wait_For_Seconds( 5.0 );
+		}
+
+		bool &ParkedFrameDestroyed;
+};
+
+TEST_F( CoroutineProcessTests, Destroy_With_Pending_Timers )
+{
+	bool parked_frame_destroyed = false;
+
+	{
+		CParkedTimerProcess *process = new CParkedTimerProcess( GAME_PROPS, parked_frame_destroyed );
+		CTaskProcessBaseTester process_tester( process );
+
+		process_tester.Service( 0.0 );
+		ASSERT_TRUE( process->Get_Live_Coroutine_Count() == 2 );
+
+		process_tester.Service( 1.0 );
+		ASSERT_FALSE( parked_frame_destroyed );
+	}
+
+	// both timers were still in the scheduler when their frames went away
+	ASSERT_TRUE( parked_frame_destroyed );
+}
+
+#endif // __cpp_impl_coroutine
@@ -23,7 +23,7 @@
 
 using namespace IP::Enum;
 
-static enum ETestEnum
+enum ETestEnum
 {
 	TE_INVALID,
 	TE_ENTRY1,
@@ -104,3 +104,115 @@ TEST( EnumConversionTests, Bitfield )
 
 	ASSERT_FALSE( CEnumConverter::Convert( static_cast< ETestBitfield >( 16 ), converted_entry ) );
 }
+
+enum ETestTableEnum
+{
+	TTE_INVALID,
+	TTE_ALPHA,
+	TTE_BETA,
+	TTE_GAMMA
+};
+
+// laid out the way the EnumReflector emits tables
+static const SEnumTableEntry ETestTableEnum_EntriesByName[] = {
+	{ "ALPHA", 1 },
+	{ "BETA", 2 },
+	{ "GAMMA", 3 },
+	{ "INVALID", 0 }
+};
+
+static const SEnumTableEntry ETestTableEnum_EntriesByValue[] = {
+	{ "INVALID", 0 },
+	{ "ALPHA", 1 },
+	{ "BETA", 2 },
+	{ "GAMMA", 3 }
+};
+
+static const SEnumTable ETestTableEnum_Table = { "ETestTableEnum", EConvertibleEnumProperties::CEP_NONE, ETestTableEnum_EntriesByName, ETestTableEnum_EntriesByValue, 4, nullptr, 0, 0 };
+
+TEST( EnumConversionTests, Static_Table )
+{
+	CEnumConverter::Register_Enum_Table< ETestTableEnum >( ETestTableEnum_Table );
+
+	ETestTableEnum converted_value = TTE_INVALID;
+	ASSERT_TRUE( CEnumConverter::Convert( "Gamma", converted_value ) );
+	ASSERT_TRUE( converted_value == TTE_GAMMA );
+
+	ASSERT_TRUE( CEnumConverter::Convert( "alpha", converted_value ) );
+	ASSERT_TRUE( converted_value == TTE_ALPHA );
+
+	ASSERT_TRUE( CEnumConverter::Convert( "INVALID", converted_value ) );
+	ASSERT_TRUE( converted_value == TTE_INVALID );
+
+	ASSERT_FALSE( CEnumConverter::Convert( "Alph", converted_value ) );
+	ASSERT_FALSE( CEnumConverter::Convert( "Alphaa", converted_value ) );
+	ASSERT_FALSE( CEnumConverter::Convert( "Delta", converted_value ) );
+
+	std::string converted_entry;
+	ASSERT_TRUE( CEnumConverter::Convert( TTE_BETA, converted_entry ) );
+	ASSERT_TRUE( converted_entry == "BETA" );
+
+	ASSERT_FALSE( CEnumConverter::Convert( static_cast< ETestTableEnum >( 7 ), converted_entry ) );
+
+	// runtime entries extend a generated table
+	CEnumConverter::Register_Enum_Entry( "Delta", static_cast< ETestTableEnum >( 4 ) );
+
+	ASSERT_TRUE( CEnumConverter::Convert( "DELTA", converted_value ) );
+	ASSERT_TRUE( converted_value == 4 );
+
+	ASSERT_TRUE( CEnumConverter::Convert( static_cast< ETestTableEnum >( 4 ), converted_entry ) );
+	ASSERT_TRUE( converted_entry == "DELTA" );
+
+	ASSERT_TRUE( CEnumConverter::Convert( "Beta", converted_value ) );
+	ASSERT_TRUE( converted_value == TTE_BETA );
+}
+
+enum ETestTableBitfield
+{
+	TTB_NONE = 0
+};
+
+static const SEnumTableEntry ETestTableBitfield_EntriesByName[] = {
+	{ "FLAG1", 1 },
+	{ "FLAG2", 2 },
+	{ "FLAG3", 4 },
+	{ "NONE", 0 }
+};
+
+static const SEnumTableEntry ETestTableBitfield_EntriesByValue[] = {
+	{ "NONE", 0 },
+	{ "FLAG1", 1 },
+	{ "FLAG2", 2 },
+	{ "FLAG3", 4 }
+};
+
+static const SEnumTableEntry ETestTableBitfield_BitEntries[] = {
+	{ "FLAG1", 1 },
+	{ "FLAG2", 2 },
+	{ "FLAG3", 4 }
+};
+
+static const SEnumTable ETestTableBitfield_Table = { "ETestTableBitfield", EConvertibleEnumProperties::CEP_BITFIELD, ETestTableBitfield_EntriesByName, ETestTableBitfield_EntriesByValue, 4, ETestTableBitfield_BitEntries, 3, 7 };
+
+TEST( EnumConversionTests, Static_Table_Bitfield )
+{
+	CEnumConverter::Register_Enum_Table< ETestTableBitfield >( ETestTableBitfield_Table );
+
+	ETestTableBitfield converted_value = TTB_NONE;
+	ASSERT_TRUE( CEnumConverter::Convert( "none", converted_value ) );
+	ASSERT_TRUE( converted_value == TTB_NONE );
+
+	ASSERT_TRUE( CEnumConverter::Convert( "Flag3 | flag1", converted_value ) );
+	ASSERT_TRUE( converted_value == 5 );
+
+	ASSERT_FALSE( CEnumConverter::Convert( "Flag3 | Flag", converted_value ) );
+
+	std::string converted_entry;
+	ASSERT_TRUE( CEnumConverter::Convert( static_cast< ETestTableBitfield >( 6 ), converted_entry ) );
+	ASSERT_TRUE( converted_entry == "FLAG2 | FLAG3" );
+
+	ASSERT_TRUE( CEnumConverter::Convert( static_cast< ETestTableBitfield >( 0 ), converted_entry ) );
+	ASSERT_TRUE( converted_entry == "NONE" );
+
+	ASSERT_FALSE( CEnumConverter::Convert( static_cast< ETestTableBitfield >( 8 ), converted_entry ) );
+}
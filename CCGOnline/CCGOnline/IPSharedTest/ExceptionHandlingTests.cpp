@@ -23,14 +23,25 @@
 #include "IPPlatform/StructuredExceptionInfo.h"
 #include "IPPlatform/WindowsWrapper.h"
 #include "IPPlatform/PlatformProcess.h"
+#include "IPPlatform/PlatformExceptionHandler.h"
+
+#ifndef WIN32
+#include <csignal>
+#endif // WIN32
 
 using namespace IP::Debug;
 
 void Fake_Exception_Handler( CStructuredExceptionInfo &info )
 {
+	ASSERT_TRUE( info.Is_Test_Exception() );
+
+#ifdef WIN32
 	ASSERT_TRUE( info.Get_Exception_Message() == L"Unknown Exception Code: 1" );
+#else
+	ASSERT_TRUE( info.Get_Call_Stack().size() > 0 );
+#endif // WIN32
 
-#ifdef _DEBUG
+#if defined( _DEBUG ) && defined( WIN32 )
 	// the call stack changes between 32 and 64 bit, as well as debug and release
 	const std::vector< CStackFrame > &call_stack = info.Get_Call_Stack();
 
@@ -39,7 +50,7 @@ void Fake_Exception_Handler( CStructuredExceptionInfo &info )
 	ASSERT_TRUE( call_stack[ 1 ].Get_Function_Name() == L"Exception_Level_3" );
 	ASSERT_TRUE( call_stack[ 1 ].Get_Module_Name() == IP::Process::Get_Exe_Name() );
 	ASSERT_TRUE( call_stack[ 1 ].Get_Line_Number() > 0 );
-#endif // _DEBUG
+#endif // _DEBUG && WIN32
 }
 
 class ExceptionHandlingTests : public testing::Test 
@@ -61,7 +72,11 @@ class ExceptionHandlingTests : public testing::Test
 
 void Exception_Level_3( void )
 {
+#ifdef WIN32
 	RaiseException( 1, 0, 0, nullptr );
+#else
+	raise( SIGUSR1 );
+#endif // WIN32
 }
 
 void Exception_Level_2( void )
@@ -78,3 +93,35 @@ TEST_F( ExceptionHandlingTests, FakeException )
 {
 	Exception_Level_1();
 }
+
+#ifndef WIN32
+
+static bool Is_Signal_Stack_Enabled( void )
+{
+	stack_t signal_stack;
+	return sigaltstack( nullptr, &signal_stack ) == 0 && ( signal_stack.ss_flags & SS_DISABLE ) == 0;
+}
+
+TEST_F( ExceptionHandlingTests, Signal_Stack )
+{
+	ASSERT_TRUE( Is_Signal_Stack_Enabled() );
+
+	bool worker_enabled = false;
+	bool worker_removed = false;
+	std::thread worker( [ &worker_enabled, &worker_removed ]( void ) {
+		CPlatformExceptionHandler::Install_Thread_Signal_Stack();
+		worker_enabled = Is_Signal_Stack_Enabled();
+
+		CPlatformExceptionHandler::Remove_Thread_Signal_Stack();
+		worker_removed = !Is_Signal_Stack_Enabled();
+	} );
+	worker.join();
+
+	ASSERT_TRUE( worker_enabled );
+	ASSERT_TRUE( worker_removed );
+
+	// the report still reaches the handler once it has moved off the faulting thread
+	Exception_Level_1();
+}
+
+#endif // WIN32
@@ -165,9 +165,9 @@ CProcessBase *CThreadProcessBaseTester::Get_Process( void ) const
 	return ThreadProcess.get(); 
 }
 
-void CThreadProcessBaseTester::Start( void )
+void CThreadProcessBaseTester::Start( CQuiescentStateReclaimer *reclaimer )
 {
-	CProcessExecutionContext thread_context;
+	CProcessExecutionContext thread_context( reclaimer );
 	ThreadProcess->Run( thread_context );
 }
 
@@ -30,6 +30,7 @@ namespace Execution
 class CProcessMailbox;
 class CTaskProcessBase;
 class CThreadProcessBase;
+class CQuiescentStateReclaimer;
 
 static const EProcessID AI_PROCESS_ID = static_cast< EProcessID >( EProcessID::FIRST_FREE_ID );
 
@@ -112,7 +113,7 @@ class CThreadProcessBaseTester : public CProcessBaseTester
 
 		virtual IP::Execution::CProcessBase *Get_Process( void ) const;
 
-		void Start( void );
+		void Start( IP::Execution::CQuiescentStateReclaimer *reclaimer = nullptr );
 
 	private:
 
@@ -36,7 +36,11 @@ namespace NIPSharedTest
 	}
 }
 
+#ifdef WIN32
 int main(int argc, wchar_t* argv[])
+#else
+int main(int argc, char* argv[])
+#endif // WIN32
 {
 	NIPSharedTest::Initialize();
 
@@ -0,0 +1,112 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+
+#include "stdafx.h"
+
+#include "IPShared/InternedString.h"
+
+using namespace IP::String;
+
+TEST( InternedStringTests, Equal_Values_Share_One_Instance )
+{
+	CInternedWideString faction1( L"InternedStringTests::Faction" );
+	CInternedWideString faction2( std::wstring( L"InternedStringTests::Faction" ) );
+	CInternedWideString keyword( L"InternedStringTests::Keyword" );
+
+	ASSERT_TRUE( faction1 == faction2 );
+	ASSERT_TRUE( &faction1.Get() == &faction2.Get() );
+	ASSERT_TRUE( faction1.Get_Hash() == faction2.Get_Hash() );
+	ASSERT_TRUE( faction1 != keyword );
+	ASSERT_TRUE( faction1.Get() == L"InternedStringTests::Faction" );
+
+	size_t count = CInternedWideString::Get_Interned_Count();
+	CInternedWideString faction3( L"InternedStringTests::Faction" );
+	ASSERT_TRUE( CInternedWideString::Get_Interned_Count() == count );
+
+	// narrow and wide strings are interned separately
+	CInternedString narrow_faction( "InternedStringTests::Faction" );
+	ASSERT_TRUE( narrow_faction.Get() == "InternedStringTests::Faction" );
+}
+
+TEST( InternedStringTests, Empty_And_Find )
+{
+	CInternedString empty1;
+	CInternedString empty2( "" );
+
+	ASSERT_TRUE( empty1 == empty2 );
+	ASSERT_TRUE( empty1.Is_Empty() );
+	ASSERT_TRUE( empty1.Get().empty() );
+	ASSERT_TRUE( std::string( empty1.c_str() ) == "" );
+
+	CInternedString handle;
+	ASSERT_FALSE( CInternedString::Find( "InternedStringTests::NeverInterned", handle ) );
+
+	CInternedString interned( "InternedStringTests::Interned" );
+	ASSERT_TRUE( CInternedString::Find( "InternedStringTests::Interned", handle ) );
+	ASSERT_TRUE( handle == interned );
+
+	std::unordered_map< CInternedString, int32_t, SInternedStringContainerHelper > table;
+	table[ interned ] = 5;
+	ASSERT_TRUE( table[ CInternedString( std::string( "InternedStringTests::Interned" ) ) ] == 5 );
+}
+
+// interned during dynamic initialization, in whatever order that runs relative to IPShared's own statics
+static const CInternedString STATIC_INTERNED( "InternedStringTests::Static" );
+
+TEST( InternedStringTests, Static_Initialization )
+{
+	CInternedString handle;
+	ASSERT_TRUE( CInternedString::Find( "InternedStringTests::Static", handle ) );
+	ASSERT_TRUE( handle == STATIC_INTERNED );
+	ASSERT_TRUE( STATIC_INTERNED.Get() == "InternedStringTests::Static" );
+}
+
+TEST( InternedStringTests, Concurrent_Interning )
+{
+	static const uint32_t THREAD_COUNT = 4;
+	static const uint32_t STRING_COUNT = 2000;
+
+	std::vector< std::vector< CInternedString > > results( THREAD_COUNT );
+	std::vector< std::thread > threads;
+
+	for ( uint32_t i = 0; i < THREAD_COUNT; ++i )
+	{
+		std::vector< CInternedString > &thread_results = results[ i ];
+		threads.push_back( std::thread( [ &thread_results ]( void ) {
+			for ( uint32_t j = 0; j < STRING_COUNT; ++j )
+			{
+				thread_results.push_back( CInternedString( "InternedStringTests::Concurrent" + std::to_string( j ) ) );
+			}
+		} ) );
+	}
+
+	std::for_each( threads.begin(), threads.end(), []( std::thread &thread ) { thread.join(); } );
+
+	for ( uint32_t j = 0; j < STRING_COUNT; ++j )
+	{
+		for ( uint32_t i = 1; i < THREAD_COUNT; ++i )
+		{
+			ASSERT_TRUE( results[ i ][ j ] == results[ 0 ][ j ] );
+		}
+
+		ASSERT_TRUE( results[ 0 ][ j ].Get() == "InternedStringTests::Concurrent" + std::to_string( j ) );
+	}
+}
@@ -119,7 +119,7 @@ static const std::wstring LOG_TEST_MESSAGE( L"Testing" );
 void Verify_Log_File( const std::wstring &file_name )
 {
 	std::wstring full_name = std::wstring( L"Logs\\" ) + file_name;
-	std::basic_ifstream< wchar_t > file( full_name.c_str(), std::ios_base::in );
+	std::basic_ifstream< wchar_t > file( IP::File::Get_Native_Path( full_name ).c_str(), std::ios_base::in );
 
 	ASSERT_TRUE( file.is_open() );
 	ASSERT_TRUE( file.good() );
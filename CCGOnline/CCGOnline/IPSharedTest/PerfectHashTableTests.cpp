@@ -0,0 +1,88 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+#include "stdafx.h"
+
+#include "IPShared/PerfectHashTable.h"
+
+using namespace IP::Algorithm;
+
+TEST( PerfectHashTableTests, Empty )
+{
+	TCaseInsensitivePerfectHashTable< int32_t > table;
+
+	ASSERT_TRUE( table.Size() == 0 );
+	ASSERT_TRUE( table.Find( L"Anything" ) == nullptr );
+	ASSERT_TRUE( table.Find( L"" ) == nullptr );
+}
+
+TEST( PerfectHashTableTests, Case_Insensitive_Lookup )
+{
+	TCaseInsensitivePerfectHashTable< int32_t > table;
+	table.Insert( L"HitPoints", 1 );
+	table.Insert( L"name", 2 );
+	table.Insert( L"CLASS", 3 );
+
+	ASSERT_TRUE( table.Size() == 3 );
+
+	ASSERT_TRUE( *table.Find( L"HitPoints" ) == 1 );
+	ASSERT_TRUE( *table.Find( L"HITPOINTS" ) == 1 );
+	ASSERT_TRUE( *table.Find( L"hitpoints" ) == 1 );
+	ASSERT_TRUE( *table.Find( L"Name" ) == 2 );
+	ASSERT_TRUE( *table.Find( L"class" ) == 3 );
+
+	ASSERT_TRUE( table.Find( L"HitPoint" ) == nullptr );
+	ASSERT_TRUE( table.Find( L"HitPointss" ) == nullptr );
+	ASSERT_TRUE( table.Find( L"Type" ) == nullptr );
+	ASSERT_TRUE( table.Find( L"" ) == nullptr );
+}
+
+TEST( PerfectHashTableTests, Many_Keys )
+{
+	static const int32_t KEY_COUNT = 500;
+
+	TCaseInsensitivePerfectHashTable< int32_t > table;
+	for ( int32_t i = 0; i < KEY_COUNT; ++i )
+	{
+		table.Insert( L"Member" + std::to_wstring( i ), i );
+	}
+
+	ASSERT_TRUE( table.Size() == KEY_COUNT );
+
+	for ( int32_t i = 0; i < KEY_COUNT; ++i )
+	{
+		const int32_t *value = table.Find( ( L"MEMBER" + std::to_wstring( i ) ).c_str() );
+		ASSERT_TRUE( value != nullptr );
+		ASSERT_TRUE( *value == i );
+	}
+
+	ASSERT_TRUE( table.Find( L"Member500" ) == nullptr );
+	ASSERT_TRUE( table.Find( L"Membe" ) == nullptr );
+}
+
+TEST( PerfectHashTableTests, Equals_Case_Insensitive )
+{
+	using TableType = TCaseInsensitivePerfectHashTable< int32_t >;
+
+	ASSERT_TRUE( TableType::Equals_Case_Insensitive( L"Type", L"TYPE" ) );
+	ASSERT_TRUE( TableType::Equals_Case_Insensitive( L"", L"" ) );
+	ASSERT_FALSE( TableType::Equals_Case_Insensitive( L"Type", L"Types" ) );
+	ASSERT_FALSE( TableType::Equals_Case_Insensitive( L"Typ", L"TYPE" ) );
+}
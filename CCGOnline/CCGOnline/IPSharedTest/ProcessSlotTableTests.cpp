@@ -0,0 +1,95 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+#include "stdafx.h"
+
+#include "IPShared/Concurrency/ProcessSlotTable.h"
+
+using namespace IP::Execution;
+
+TEST( ProcessSlotTableTests, Allocation_Order )
+{
+	TProcessSlotTable< int32_t > table;
+
+	// fresh IDs continue on from the reserved ones, at generation zero
+	EProcessID id1 = table.Allocate_ID();
+	EProcessID id2 = table.Allocate_ID();
+	ASSERT_TRUE( id1 == EProcessID::FIRST_FREE_ID );
+	ASSERT_TRUE( Get_Process_ID_Slot( id2 ) == Get_Process_ID_Slot( EProcessID::FIRST_FREE_ID ) + 1 );
+	ASSERT_TRUE( Get_Process_ID_Generation( id2 ) == 0 );
+
+	table[ EProcessID::CONCURRENCY_MANAGER ] = 1;
+	table[ id1 ] = 2;
+	table[ id2 ] = 3;
+	ASSERT_TRUE( table.size() == 3 );
+
+	// iteration is in slot order
+	std::vector< int32_t > values;
+	for ( auto iter = table.cbegin(), end = table.cend(); iter != end; ++iter )
+	{
+		values.push_back( iter->second );
+	}
+
+	ASSERT_TRUE( values == std::vector< int32_t >( { 1, 2, 3 } ) );
+}
+
+TEST( ProcessSlotTableTests, Stale_IDs )
+{
+	TProcessSlotTable< int32_t > table;
+
+	EProcessID old_id = table.Allocate_ID();
+	table[ old_id ] = 5;
+	ASSERT_TRUE( table.erase( old_id ) == 1 );
+	ASSERT_TRUE( table.empty() );
+
+	// the released slot comes back under the next generation
+	EProcessID new_id = table.Allocate_ID();
+	ASSERT_TRUE( new_id != old_id );
+	ASSERT_TRUE( Get_Process_ID_Slot( new_id ) == Get_Process_ID_Slot( old_id ) );
+	ASSERT_TRUE( Get_Process_ID_Generation( new_id ) == Get_Process_ID_Generation( old_id ) + 1 );
+
+	table[ new_id ] = 6;
+	ASSERT_TRUE( table.find( old_id ) == table.end() );
+	ASSERT_TRUE( table.erase( old_id ) == 0 );
+	ASSERT_TRUE( table.find( new_id ) != table.end() );
+	ASSERT_TRUE( table.find( new_id )->second == 6 );
+
+	// IDs past the end of the table find nothing either
+	ASSERT_TRUE( table.find( Make_Process_ID( 1000, 0 ) ) == table.end() );
+}
+
+TEST( ProcessSlotTableTests, Keyed_Tables_Do_Not_Allocate )
+{
+	TProcessSlotTable< int32_t > allocator;
+	TProcessSlotTable< int32_t > keyed_table;
+
+	EProcessID id1 = allocator.Allocate_ID();
+	EProcessID id2 = allocator.Allocate_ID();
+
+	// a table that only stores IDs made elsewhere must not recycle their slots into its own allocations
+	keyed_table.insert( TProcessSlotTable< int32_t >::value_type( id2, 7 ) );
+	keyed_table.erase( id2 );
+	ASSERT_TRUE( keyed_table.Allocate_ID() == id1 );
+
+	keyed_table.insert( TProcessSlotTable< int32_t >::value_type( id1, 8 ) );
+	keyed_table.insert( TProcessSlotTable< int32_t >::value_type( id2, 9 ) );
+	keyed_table.clear();
+	ASSERT_TRUE( keyed_table.size() == 0 );
+	ASSERT_TRUE( keyed_table.cbegin() == keyed_table.cend() );
+}
@@ -30,9 +30,14 @@
 #include "IPShared/Concurrency/Messaging/ProcessManagementMessages.h"
 #include "IPShared/Concurrency/Messaging/ExchangeMailboxMessages.h"
 #include "IPShared/Concurrency/Messaging/LoggingMessages.h"
+#include "IPShared/Concurrency/Messaging/MulticastMessage.h"
+#include "IPShared/Concurrency/Messaging/ProcessRequestMessages.h"
 #include "IPShared/Concurrency/ProcessID.h"
+#include "IPShared/Concurrency/ProcessRouting.h"
+#include "IPShared/Concurrency/QuiescentStateReclaimer.h"
 #include "IPShared/TaskScheduler/ScheduledTask.h"
 #include "IPShared/TaskScheduler/TaskScheduler.h"
+#include "IPShared/MessageHandling/ProcessMessageHandler.h"
 #include "IPShared/Logging/LogInterface.h"
 #include "Helpers/ProcessHelpers.h"
 #include "IPPlatform/PlatformProcess.h"
@@ -693,4 +698,444 @@ TEST_F( ProcessTests, Thread_Shutdown )
 	test_thread_process->Finalize();
 }
 
+// Retires an object on each pass and tries to reclaim it before the pass ends
+class CReclaimingThreadProcess : public CTestThreadProcess
+{
+	public:
+
+		using BASECLASS = CTestThreadProcess;
+
+		CReclaimingThreadProcess( const SProcessProperties &properties, CQuiescentStateReclaimer *reclaimer ) :
+			BASECLASS( properties ),
+			Reclaimer( reclaimer ),
+			SamePassReclaims( 0 )
+		{}
+
+		uint32_t Get_Same_Pass_Reclaims( void ) const { return SamePassReclaims; }
+
+	protected:
+
+		virtual void Per_Frame_Logic_End( void ) override
+		{
+			uint64_t frame = Get_Frames_Completed();
+			Reclaimer->Retire( [ this, frame ]( void ) { if ( frame == Get_Frames_Completed() ) { ++SamePassReclaims; } } );
+			Reclaimer->Reclaim();
+
+			BASECLASS::Per_Frame_Logic_End();
+		}
+
+	private:
+
+		CQuiescentStateReclaimer *Reclaimer;
+
+		uint32_t SamePassReclaims;
+};
+
+TEST_F( ProcessTests, Thread_Service_Read_Section )
+{
+	CQuiescentStateReclaimer reclaimer;
+
+	std::shared_ptr< CReclaimingThreadProcess > test_thread_process = std::make_shared< CReclaimingThreadProcess >( AI_PROPS, &reclaimer );
+	CThreadProcessBaseTester process_tester( std::static_pointer_cast< CThreadProcessBase >( test_thread_process ) );
+
+	std::shared_ptr< CProcessMailbox > log_conn( new CProcessMailbox( LOGGING_PROCESS_ID, LOGGING_PROCESS_PROPERTIES ) );
+	process_tester.Set_Logging_Mailbox( log_conn->Get_Writable_Mailbox() );
+
+	process_tester.Start( &reclaimer );
+
+	while( test_thread_process->Get_Frames_Completed() < 5 )
+	{
+		std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+	}
+
+	std::unique_ptr< CProcessMessageFrame > shutdown_frame( new CProcessMessageFrame( MANAGER_PROCESS_ID ) );
+	shutdown_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CShutdownSelfRequest( false ) ) );
+
+	process_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( shutdown_frame );
+
+	test_thread_process->Finalize();
+	reclaimer.Reclaim();
+
+	// nothing retired during a pass can be destroyed before that pass ends
+	ASSERT_TRUE( test_thread_process->Get_Same_Pass_Reclaims() == 0 );
+	ASSERT_TRUE( reclaimer.Get_Pending_Count() == 0 );
+}
+
+class CTestBroadcastMessage : public IProcessMessage
+{
+	public:
+
+		using BASECLASS = IProcessMessage;
+
+		CTestBroadcastMessage( uint32_t round ) :
+			BASECLASS(),
+			Round( round )
+		{}
+
+		virtual ~CTestBroadcastMessage() = default;
+
+		uint32_t Get_Round( void ) const { return Round; }
+
+	private:
+
+		uint32_t Round;
+};
+
+class CBroadcastReceiverTask : public CTaskProcessBase
+{
+	public:
+
+		using BASECLASS = CTaskProcessBase;
+
+		CBroadcastReceiverTask( const SProcessProperties &properties ) :
+			BASECLASS( properties ),
+			Received()
+		{}
+
+		virtual bool Is_Root_Thread( void ) const { return true; }
+
+		const std::vector< std::shared_ptr< const CTestBroadcastMessage > > &Get_Received( void ) const { return Received; }
+
+	protected:
+
+		virtual void Register_Message_Handlers( void ) override
+		{
+			BASECLASS::Register_Message_Handlers();
+
+			REGISTER_THIS_HANDLER( CTestBroadcastMessage, CBroadcastReceiverTask, Handle_Broadcast_Message )
+		}
+
+	private:
+
+		void Handle_Broadcast_Message( EProcessID /*source_process_id*/, const std::shared_ptr< const CTestBroadcastMessage > &message )
+		{
+			Received.push_back( message );
+		}
+
+		std::vector< std::shared_ptr< const CTestBroadcastMessage > > Received;
+};
+
+static const EProcessID DB2_PROCESS_ID = static_cast< EProcessID >( static_cast< uint64_t >( EProcessID::FIRST_FREE_ID ) + 3 );
+
+TEST_F( ProcessTests, Multicast_Shares_Payload )
+{
+	CTaskProcessBaseTester process_tester( new CTestProcessTask( AI_PROPS ) );
+
+	std::shared_ptr< CProcessMailbox > db_conn( new CProcessMailbox( DB_PROCESS_ID, DB_PROPS ) );
+	std::shared_ptr< CProcessMailbox > db2_conn( new CProcessMailbox( DB2_PROCESS_ID, DB_PROPS ) );
+	std::shared_ptr< CProcessMailbox > ui_conn( new CProcessMailbox( UI_PROCESS_ID, UI_PROPS ) );
+
+	std::unique_ptr< CProcessMessageFrame > added_frame( new CProcessMessageFrame( EProcessID::CONCURRENCY_MANAGER ) );
+	added_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CAddMailboxMessage( db_conn->Get_Writable_Mailbox() ) ) );
+	added_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CAddMailboxMessage( db2_conn->Get_Writable_Mailbox() ) ) );
+	added_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CAddMailboxMessage( ui_conn->Get_Writable_Mailbox() ) ) );
+	process_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( added_frame );
+
+	process_tester.Service( 0.0 );
+	ASSERT_TRUE( process_tester.Get_Mailbox_Table().size() == 3 );
+
+	// by properties: both db processes, not the ui process
+	std::shared_ptr< const IProcessMessage > payload( new CTestBroadcastMessage( 1 ) );
+	process_tester.Get_Process()->Send_Process_Multicast( DB_PROPS, payload );
+	process_tester.Service( 1.0 );
+
+	std::vector< std::unique_ptr< CProcessMessageFrame > > db_frames;
+	db_conn->Get_Readable_Mailbox()->Remove_Frames( db_frames );
+	db2_conn->Get_Readable_Mailbox()->Remove_Frames( db_frames );
+	ASSERT_TRUE( db_frames.size() == 2 );
+
+	for ( uint32_t i = 0; i < db_frames.size(); ++i )
+	{
+		for ( auto iter = db_frames[ i ]->cbegin(), end = db_frames[ i ]->cend(); iter != end; ++iter )
+		{
+			const IProcessMessage *raw_message = iter->get();
+
+			ASSERT_TRUE( Loki::TypeInfo( typeid( *raw_message ) ) == Loki::TypeInfo( typeid( CMulticastMessage ) ) );
+			ASSERT_TRUE( static_cast< const CMulticastMessage * >( raw_message )->Get_Payload().get() == payload.get() );
+		}
+	}
 
+	std::vector< std::unique_ptr< CProcessMessageFrame > > ui_frames;
+	ui_conn->Get_Readable_Mailbox()->Remove_Frames( ui_frames );
+	ASSERT_TRUE( ui_frames.size() == 0 );
+
+	// by explicit id list
+	process_tester.Get_Process()->Send_Process_Multicast( std::vector< EProcessID >( { UI_PROCESS_ID } ), payload );
+	process_tester.Service( 2.0 );
+
+	ui_conn->Get_Readable_Mailbox()->Remove_Frames( ui_frames );
+	ASSERT_TRUE( ui_frames.size() == 1 );
+	ASSERT_TRUE( payload.use_count() == 4 );
+
+	// a shared handler receives the multicast payload itself, and unicast messages of the same type
+	CTaskProcessBaseTester receiver_tester( new CBroadcastReceiverTask( DB_PROPS ) );
+
+	std::unique_ptr< CProcessMessageFrame > unicast_frame( new CProcessMessageFrame( AI_PROCESS_ID ) );
+	unicast_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CTestBroadcastMessage( 2 ) ) );
+
+	receiver_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( db_frames[ 0 ] );
+	receiver_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( unicast_frame );
+	receiver_tester.Service( 0.0 );
+
+	const CBroadcastReceiverTask *receiver = static_cast< const CBroadcastReceiverTask * >( receiver_tester.Get_Process() );
+	ASSERT_TRUE( receiver->Get_Received().size() == 2 );
+	ASSERT_TRUE( receiver->Get_Received()[ 0 ].get() == payload.get() );
+	ASSERT_TRUE( receiver->Get_Received()[ 1 ]->Get_Round() == 2 );
+}
+
+class CTestPingRequest : public IProcessRequest
+{
+	public:
+
+		using BASECLASS = IProcessRequest;
+
+		CTestPingRequest( uint32_t value ) :
+			BASECLASS(),
+			Value( value )
+		{}
+
+		virtual ~CTestPingRequest() = default;
+
+		uint32_t Get_Value( void ) const { return Value; }
+
+	private:
+
+		uint32_t Value;
+};
+
+class CTestPongResponse : public IProcessMessage
+{
+	public:
+
+		using BASECLASS = IProcessMessage;
+
+		CTestPongResponse( uint32_t value ) :
+			BASECLASS(),
+			Value( value )
+		{}
+
+		virtual ~CTestPongResponse() = default;
+
+		uint32_t Get_Value( void ) const { return Value; }
+
+	private:
+
+		uint32_t Value;
+};
+
+class CPingResponderTask : public CTaskProcessBase
+{
+	public:
+
+		using BASECLASS = CTaskProcessBase;
+
+		CPingResponderTask( const SProcessProperties &properties ) :
+			BASECLASS( properties )
+		{}
+
+		virtual bool Is_Root_Thread( void ) const { return true; }
+
+	protected:
+
+		virtual void Register_Message_Handlers( void ) override
+		{
+			BASECLASS::Register_Message_Handlers();
+
+			REGISTER_THIS_HANDLER( CTestPingRequest, CPingResponderTask, Handle_Ping_Request )
+		}
+
+	private:
+
+		void Handle_Ping_Request( EProcessID source_process_id, std::unique_ptr< const CTestPingRequest > &request )
+		{
+			Send_Process_Response( source_process_id, *request, std::unique_ptr< const IProcessMessage >( new CTestPongResponse( request->Get_Value() * 2 ) ) );
+		}
+};
+
+TEST_F( ProcessTests, Request_Response )
+{
+	CTaskProcessBaseTester requester_tester( new CTestProcessTask( AI_PROPS ) );
+	CTaskProcessBaseTester responder_tester( new CPingResponderTask( DB_PROPS ) );
+	CProcessBase *requester = requester_tester.Get_Process();
+
+	// requests to the db process are relayed by hand; the responder answers straight into the requester's mailbox
+	std::shared_ptr< CProcessMailbox > db_conn( new CProcessMailbox( DB_PROCESS_ID, DB_PROPS ) );
+
+	std::unique_ptr< CProcessMessageFrame > requester_added_frame( new CProcessMessageFrame( EProcessID::CONCURRENCY_MANAGER ) );
+	requester_added_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CAddMailboxMessage( db_conn->Get_Writable_Mailbox() ) ) );
+	requester_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( requester_added_frame );
+
+	std::unique_ptr< CProcessMessageFrame > responder_added_frame( new CProcessMessageFrame( EProcessID::CONCURRENCY_MANAGER ) );
+	responder_added_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CAddMailboxMessage( requester_tester.Get_Self_Proxy()->Get_Writable_Mailbox() ) ) );
+	responder_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( responder_added_frame );
+
+	requester_tester.Service( 0.0 );
+	responder_tester.Service( 0.0 );
+
+	uint32_t answered_value = 0;
+	bool answered_timeout_request = false;
+	bool timed_out = false;
+	bool answered_cancelled_request = false;
+
+	ERequestID answered_id = requester->Send_Process_Request< CTestPongResponse >( DB_PROCESS_ID, std::make_unique< CTestPingRequest >( 7 ), 5.0,
+		[ &answered_value ]( std::unique_ptr< const CTestPongResponse > &response ) { answered_value = response->Get_Value(); } );
+
+	// nothing can route to the ui process, so this one can only time out
+	ERequestID timeout_id = requester->Send_Process_Request< CTestPongResponse >( UI_PROCESS_ID, std::make_unique< CTestPingRequest >( 8 ), 1.0,
+		[ &answered_timeout_request, &timed_out ]( std::unique_ptr< const CTestPongResponse > &response ) { answered_timeout_request = response != nullptr; timed_out = response == nullptr; } );
+
+	ERequestID cancelled_id = requester->Send_Process_Request< CTestPongResponse >( DB_PROCESS_ID, std::make_unique< CTestPingRequest >( 9 ), 5.0,
+		[ &answered_cancelled_request ]( std::unique_ptr< const CTestPongResponse > & /*response*/ ) { answered_cancelled_request = true; } );
+
+	ASSERT_TRUE( answered_id != timeout_id && answered_id != cancelled_id && timeout_id != cancelled_id );
+	ASSERT_TRUE( requester->Is_Process_Request_Outstanding( answered_id ) );
+
+	ASSERT_TRUE( requester->Cancel_Process_Request( cancelled_id ) );
+	ASSERT_FALSE( requester->Cancel_Process_Request( cancelled_id ) );
+	ASSERT_FALSE( requester->Is_Process_Request_Outstanding( cancelled_id ) );
+
+	requester_tester.Service( 0.5 );
+
+	std::vector< std::unique_ptr< CProcessMessageFrame > > frames;
+	db_conn->Get_Readable_Mailbox()->Remove_Frames( frames );
+	ASSERT_TRUE( frames.size() == 1 );
+
+	responder_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( frames[ 0 ] );
+	responder_tester.Service( 0.5 );
+
+	// the answer arrives; the cancelled request's answer is dropped
+	requester_tester.Service( 0.75 );
+	ASSERT_TRUE( answered_value == 14 );
+	ASSERT_FALSE( answered_cancelled_request );
+	ASSERT_FALSE( requester->Is_Process_Request_Outstanding( answered_id ) );
+
+	ASSERT_TRUE( requester->Is_Process_Request_Outstanding( timeout_id ) );
+	ASSERT_FALSE( timed_out );
+
+	requester_tester.Service( 1.5 );
+	ASSERT_TRUE( timed_out );
+	ASSERT_FALSE( answered_timeout_request );
+	ASSERT_FALSE( requester->Is_Process_Request_Outstanding( timeout_id ) );
+
+	// released slots come back under a new generation
+	ERequestID reused_id = requester->Send_Process_Request< CTestPongResponse >( DB_PROCESS_ID, std::make_unique< CTestPingRequest >( 10 ), 0.0,
+		[]( std::unique_ptr< const CTestPongResponse > & /*response*/ ) {} );
+	ASSERT_FALSE( requester->Is_Process_Request_Outstanding( answered_id ) );
+	ASSERT_FALSE( requester->Is_Process_Request_Outstanding( timeout_id ) );
+	ASSERT_FALSE( requester->Is_Process_Request_Outstanding( cancelled_id ) );
+	ASSERT_TRUE( requester->Is_Process_Request_Outstanding( reused_id ) );
+}
+
+static const EProcessID DB3_PROCESS_ID = static_cast< EProcessID >( static_cast< uint64_t >( EProcessID::FIRST_FREE_ID ) + 4 );
+
+TEST_F( ProcessTests, Routed_Sends )
+{
+	CTaskProcessBaseTester process_tester( new CTestProcessTask( AI_PROPS ) );
+	CProcessBase *process = process_tester.Get_Process();
+
+	std::shared_ptr< CProcessMailbox > db_conn( new CProcessMailbox( DB_PROCESS_ID, DB_PROPS ) );
+	std::shared_ptr< CProcessMailbox > db2_conn( new CProcessMailbox( DB2_PROCESS_ID, DB_PROPS ) );
+	std::shared_ptr< CProcessMailbox > db3_conn( new CProcessMailbox( DB3_PROCESS_ID, DB_PROPS ) );
+	std::shared_ptr< CProcessMailbox > ui_conn( new CProcessMailbox( UI_PROCESS_ID, UI_PROPS ) );
+
+	std::unique_ptr< CProcessMessageFrame > added_frame( new CProcessMessageFrame( EProcessID::CONCURRENCY_MANAGER ) );
+	added_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CAddMailboxMessage( db_conn->Get_Writable_Mailbox() ) ) );
+	added_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CAddMailboxMessage( db2_conn->Get_Writable_Mailbox() ) ) );
+	added_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CAddMailboxMessage( ui_conn->Get_Writable_Mailbox() ) ) );
+	process_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( added_frame );
+
+	process_tester.Service( 0.0 );
+
+	// round robin by default, never to a process that does not match
+	std::vector< EProcessID > destinations;
+	for ( uint32_t i = 0; i < 4; ++i )
+	{
+		std::unique_ptr< const IProcessMessage > message( new CTestBroadcastMessage( i ) );
+		destinations.push_back( process->Send_Process_Message_By_Properties( DB_PROPS, message ) );
+		ASSERT_TRUE( message.get() == nullptr );
+	}
+
+	ASSERT_TRUE( destinations[ 0 ] != destinations[ 1 ] );
+	ASSERT_TRUE( destinations[ 0 ] == destinations[ 2 ] && destinations[ 1 ] == destinations[ 3 ] );
+	ASSERT_TRUE( destinations[ 0 ] == DB_PROCESS_ID || destinations[ 0 ] == DB2_PROCESS_ID );
+	ASSERT_TRUE( destinations[ 1 ] == DB_PROCESS_ID || destinations[ 1 ] == DB2_PROCESS_ID );
+
+	// nothing matches; the message stays with the caller
+	std::unique_ptr< const IProcessMessage > unrouted_message( new CTestBroadcastMessage( 0 ) );
+	ASSERT_TRUE( process->Send_Process_Message_By_Properties( SProcessProperties( 999 ), unrouted_message ) == EProcessID::INVALID );
+	ASSERT_TRUE( unrouted_message.get() != nullptr );
+
+	process_tester.Service( 1.0 );
+	ASSERT_TRUE( db_conn->Get_Writable_Mailbox()->Get_Backlog() == 2 );
+	ASSERT_TRUE( db2_conn->Get_Writable_Mailbox()->Get_Backlog() == 2 );
+
+	// least backlog: the drained process takes new work until it catches up, counting messages not yet flushed
+	process->Set_Routing_Policy( DB_PROPS, std::unique_ptr< IProcessRoutingPolicy >( new CLeastBacklogRoutingPolicy ) );
+
+	std::vector< std::unique_ptr< CProcessMessageFrame > > frames;
+	db_conn->Get_Readable_Mailbox()->Remove_Frames( frames );
+	ASSERT_TRUE( db_conn->Get_Writable_Mailbox()->Get_Backlog() == 0 );
+
+	for ( uint32_t i = 0; i < 2; ++i )
+	{
+		std::unique_ptr< const IProcessMessage > message( new CTestBroadcastMessage( i ) );
+		ASSERT_TRUE( process->Send_Process_Message_By_Properties( DB_PROPS, message ) == DB_PROCESS_ID );
+	}
+
+	process_tester.Service( 2.0 );
+	ASSERT_TRUE( db_conn->Get_Writable_Mailbox()->Get_Backlog() == 2 );
+	ASSERT_TRUE( db2_conn->Get_Writable_Mailbox()->Get_Backlog() == 2 );
+
+	// consistent hashing: a key sticks to one process, and keeps it when other processes join or leave
+	process->Set_Routing_Policy( DB_PROPS, std::unique_ptr< IProcessRoutingPolicy >( new CConsistentHashRoutingPolicy ) );
+
+	const uint64_t KEY_COUNT = 64;
+	std::vector< EProcessID > key_destinations;
+	for ( uint64_t key = 0; key < KEY_COUNT; ++key )
+	{
+		std::unique_ptr< const IProcessMessage > message( new CTestBroadcastMessage( 0 ) );
+		key_destinations.push_back( process->Send_Process_Message_By_Properties( DB_PROPS, message, key ) );
+
+		std::unique_ptr< const IProcessMessage > repeat_message( new CTestBroadcastMessage( 1 ) );
+		ASSERT_TRUE( process->Send_Process_Message_By_Properties( DB_PROPS, repeat_message, key ) == key_destinations[ key ] );
+	}
+
+	ASSERT_TRUE( std::count( key_destinations.cbegin(), key_destinations.cend(), DB_PROCESS_ID ) > 0 );
+	ASSERT_TRUE( std::count( key_destinations.cbegin(), key_destinations.cend(), DB2_PROCESS_ID ) > 0 );
+
+	std::unique_ptr< CProcessMessageFrame > join_frame( new CProcessMessageFrame( EProcessID::CONCURRENCY_MANAGER ) );
+	join_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CAddMailboxMessage( db3_conn->Get_Writable_Mailbox() ) ) );
+	process_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( join_frame );
+	process_tester.Service( 3.0 );
+
+	uint32_t moved_keys = 0;
+	for ( uint64_t key = 0; key < KEY_COUNT; ++key )
+	{
+		std::unique_ptr< const IProcessMessage > message( new CTestBroadcastMessage( 0 ) );
+		EProcessID destination = process->Send_Process_Message_By_Properties( DB_PROPS, message, key );
+		if ( destination != key_destinations[ key ] )
+		{
+			ASSERT_TRUE( destination == DB3_PROCESS_ID );
+			key_destinations[ key ] = destination;
+			++moved_keys;
+		}
+	}
+
+	ASSERT_TRUE( moved_keys > 0 && moved_keys < KEY_COUNT );
+
+	std::unique_ptr< CProcessMessageFrame > leave_frame( new CProcessMessageFrame( EProcessID::CONCURRENCY_MANAGER ) );
+	leave_frame->Add_Message( std::unique_ptr< const IProcessMessage >( new CReleaseMailboxRequest( DB2_PROCESS_ID ) ) );
+	process_tester.Get_Self_Proxy()->Get_Writable_Mailbox()->Add_Frame( leave_frame );
+	process_tester.Service( 4.0 );
+
+	for ( uint64_t key = 0; key < KEY_COUNT; ++key )
+	{
+		std::unique_ptr< const IProcessMessage > message( new CTestBroadcastMessage( 0 ) );
+		EProcessID destination = process->Send_Process_Message_By_Properties( DB_PROPS, message, key );
+		ASSERT_TRUE( destination != DB2_PROCESS_ID );
+		if ( key_destinations[ key ] != DB2_PROCESS_ID )
+		{
+			ASSERT_TRUE( destination == key_destinations[ key ] );
+		}
+	}
+}
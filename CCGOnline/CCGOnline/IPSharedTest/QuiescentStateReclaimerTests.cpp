@@ -0,0 +1,133 @@
+/**********************************************************************************************************************
+
+	(c) Copyright 2011, Bret Ambrose (mailto:bretambrose@gmail.com).
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+**********************************************************************************************************************/
+
+
+
+#include "stdafx.h"
+
+#include "IPShared/Concurrency/QuiescentStateReclaimer.h"
+
+using namespace IP::Execution;
+
+TEST( QuiescentStateReclaimerTests, Deferred_Until_Readers_Exit )
+{
+	CQuiescentStateReclaimer reclaimer;
+	bool reclaimed = false;
+
+	uint64_t epoch = reclaimer.Enter_Read_Section();
+
+	reclaimer.Retire( [ &reclaimed ]( void ) { reclaimed = true; } );
+	ASSERT_TRUE( reclaimer.Get_Pending_Count() == 1 );
+
+	// an active reader from the retirement epoch pins the object no matter how often reclamation is attempted
+	ASSERT_TRUE( reclaimer.Reclaim() == 0 );
+	ASSERT_TRUE( reclaimer.Reclaim() == 0 );
+	ASSERT_FALSE( reclaimed );
+
+	reclaimer.Exit_Read_Section( epoch );
+
+	ASSERT_TRUE( reclaimer.Reclaim() == 1 );
+	ASSERT_TRUE( reclaimed );
+	ASSERT_TRUE( reclaimer.Get_Pending_Count() == 0 );
+}
+
+TEST( QuiescentStateReclaimerTests, Later_Readers_Do_Not_Block )
+{
+	CQuiescentStateReclaimer reclaimer;
+	uint32_t reclaimed_count = 0;
+
+	reclaimer.Retire( [ &reclaimed_count ]( void ) { ++reclaimed_count; } );
+
+	// a reader that entered after the retirement cannot have seen the retired object
+	ASSERT_TRUE( reclaimer.Reclaim() == 1 );
+	{
+		CQuiescentStateReadGuard read_guard( &reclaimer );
+
+		reclaimer.Retire( [ &reclaimed_count ]( void ) { ++reclaimed_count; } );
+		ASSERT_TRUE( reclaimer.Reclaim() == 0 );
+	}
+
+	ASSERT_TRUE( reclaimer.Reclaim() == 1 );
+	ASSERT_TRUE( reclaimed_count == 2 );
+}
+
+TEST( QuiescentStateReclaimerTests, Destruction_Reclaims_Pending )
+{
+	bool reclaimed = false;
+
+	{
+		CQuiescentStateReclaimer reclaimer;
+		{
+			CQuiescentStateReadGuard read_guard( &reclaimer );
+			reclaimer.Retire( [ &reclaimed ]( void ) { reclaimed = true; } );
+		}
+	}
+
+	ASSERT_TRUE( reclaimed );
+}
+
+TEST( QuiescentStateReclaimerTests, Concurrent_Publication )
+{
+	static const uint32_t READER_COUNT = 4;
+	static const uint32_t PUBLISH_COUNT = 2000;
+
+	CQuiescentStateReclaimer reclaimer;
+	std::atomic< const uint32_t * > published( new uint32_t( 0 ) );
+	std::atomic< bool > done( false );
+	std::atomic< uint32_t > live_count( 1 );
+
+	std::vector< std::thread > readers;
+	for ( uint32_t i = 0; i < READER_COUNT; ++i )
+	{
+		readers.push_back( std::thread( [ & ]( void ) {
+			uint32_t last_value = 0;
+			while ( !done.load() )
+			{
+				CQuiescentStateReadGuard read_guard( &reclaimer );
+
+				// a reclaimed value would read as garbage (or trip a sanitizer); published values only increase
+				uint32_t value = *published.load();
+				FATAL_ASSERT( value >= last_value && value <= PUBLISH_COUNT );
+				last_value = value;
+			}
+		} ) );
+	}
+
+	for ( uint32_t i = 1; i <= PUBLISH_COUNT; ++i )
+	{
+		live_count.fetch_add( 1 );
+		const uint32_t *old_value = published.exchange( new uint32_t( i ) );
+
+		reclaimer.Retire( [ old_value, &live_count ]( void ) { live_count.fetch_sub( 1 ); delete old_value; } );
+		reclaimer.Reclaim();
+	}
+
+	done.store( true );
+	std::for_each( readers.begin(), readers.end(), []( std::thread &reader ) { reader.join(); } );
+
+	while ( reclaimer.Get_Pending_Count() > 0 )
+	{
+		reclaimer.Reclaim();
+	}
+
+	ASSERT_TRUE( live_count.load() == 1 );
+	ASSERT_TRUE( *published.load() == PUBLISH_COUNT );
+
+	delete published.load();
+}
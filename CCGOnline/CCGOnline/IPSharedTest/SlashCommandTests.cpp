@@ -127,3 +127,36 @@ TEST_F( SlashCommandTests, Commands_Bad )
 	ASSERT_FALSE( CSlashCommandManager::Parse_Command( L"/test subby false", command_instance, error_msg ) );
 	ASSERT_FALSE( CSlashCommandManager::Parse_Command( L"/test subby false notanumber", command_instance, error_msg ) );
 }
+
+TEST_F( SlashCommandTests, Commands_Shortcut )
+{
+	std::wstring error_msg;
+	CSlashCommandInstance command_instance;
+	ASSERT_TRUE( CSlashCommandManager::Parse_Command( L"/tq \"blah blah\"", command_instance, error_msg ) );
+
+	ASSERT_TRUE( command_instance.Get_Command() == L"Test" );
+	ASSERT_TRUE( command_instance.Get_Sub_Command() == L"Quoted" );
+	ASSERT_TRUE( command_instance.Get_Param_Count() == 2 );
+
+	std::string value_string;
+	ASSERT_TRUE( command_instance.Get_Param( 0, value_string ) );
+	ASSERT_TRUE( value_string == "blah blah" );
+
+	ASSERT_TRUE( command_instance.Get_Param( 1, value_string ) );
+	ASSERT_TRUE( value_string == "none" );
+
+	// an unterminated quote is just part of a bare parameter
+	command_instance.Reset();
+	ASSERT_TRUE( CSlashCommandManager::Parse_Command( L"/TEST quoted \"blah blah", command_instance, error_msg ) );
+
+	ASSERT_TRUE( command_instance.Get_Param( 0, value_string ) );
+	ASSERT_TRUE( value_string == "\"blah" );
+
+	ASSERT_TRUE( command_instance.Get_Param( 1, value_string ) );
+	ASSERT_TRUE( value_string == "blah" );
+
+	ASSERT_FALSE( CSlashCommandManager::Parse_Command( L"/tq \"\"", command_instance, error_msg ) );
+	ASSERT_FALSE( CSlashCommandManager::Parse_Command( L"/tqq blah", command_instance, error_msg ) );
+	ASSERT_FALSE( CSlashCommandManager::Parse_Command( L"/te blah", command_instance, error_msg ) );
+	ASSERT_FALSE( CSlashCommandManager::Parse_Command( L"/test quote blah", command_instance, error_msg ) );
+}
@@ -24,10 +24,28 @@
 #include "IPShared/Serialization/XML/XMLLoadableTable.h"
 #include "IPShared/Serialization/SerializationRegistrar.h"
 #include "IPShared/Serialization/XML/PrimitiveXMLSerializers.h"
+#include "IPShared/Serialization/XML/XMLTableLoader.h"
+#include "IPShared/Serialization/XML/StaticXMLSerializer.h"
+#include "IPShared/Serialization/XML/XMLReloadableTable.h"
+#include "IPShared/Serialization/XML/XMLFlatLoadableTable.h"
+#include "IPShared/Concurrency/QuiescentStateReclaimer.h"
+#include "IPPlatform/PlatformFileSystem.h"
+#include "IPPlatform/StringUtils.h"
+#include "IPShared/InternedString.h"
+
+#include <fstream>
 
 using namespace IP::Serialization;
 using namespace IP::Serialization::XML;
 
+static const std::string COMPILED_TABLE_XML_FILE( "CompiledTableTest.xml" );
+static const std::string COMPILED_TABLE_IMAGE_FILE( "CompiledTableTest.bin" );
+static const std::string PARALLEL_TABLE_XML_FILE1( "ParallelTableTest1.xml" );
+static const std::string PARALLEL_TABLE_XML_FILE2( "ParallelTableTest2.xml" );
+static const std::string PARALLEL_TABLE_XML_FILE3( "ParallelTableTest3.xml" );
+static const std::string RELOADABLE_TABLE_XML_FILE( "ReloadableTableTest.xml" );
+static const std::string FLAT_TABLE_XML_FILE( "FlatTableTest.xml" );
+
 class XMLLoadableTests : public testing::Test 
 {
 	protected:  
@@ -40,6 +58,40 @@ class XMLLoadableTests : public testing::Test
 		{
 		}
 
+		static void Write_XML_File( const std::string &file_name, const char *contents )
+		{
+			std::ofstream xml_file( file_name.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary );
+			xml_file << contents;
+		}
+
+		// loads the object from XML, writes it with its binary serializer and reads the result into a fresh object
+		template< typename T >
+		static void Load_And_Round_Trip( const wchar_t *xml_blob, T &xml_object, T &binary_object )
+		{
+			pugi::xml_document doc;
+			doc.load( xml_blob );
+
+			ASSERT_TRUE( CSerializationRegistrar::Get_XML_Serializer< T >()->Load_From_XML( doc.first_child(), &xml_object ) );
+
+			Binary::IBinarySerializer *serializer = CSerializationRegistrar::Get_Binary_Serializer< T >();
+
+			Binary::CBinaryWriter writer;
+			serializer->Write_To_Binary( &xml_object, writer );
+
+			Binary::CBinaryReader reader( writer.Get_Buffer().data(), writer.Get_Size() );
+			serializer->Read_From_Binary( reader, &binary_object );
+
+			ASSERT_TRUE( reader.Is_Finished() );
+		}
+
+		static void Delete_Test_File( const std::string &file_name )
+		{
+			std::wstring wide_file_name;
+			IP::String::String_To_WideString( file_name, wide_file_name );
+
+			IP::File::Delete_File( wide_file_name );
+		}
+
 	private:
 
 };
@@ -104,6 +156,28 @@ TEST_F( XMLLoadableTests, Unordered_Composite_Serializer )
 	ASSERT_TRUE( test.Bool == false );
 }
 
+TEST_F( XMLLoadableTests, Case_Insensitive_Member_Names )
+{
+	SUnorderedCompositeXMLTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	IXMLSerializer *serializer = CSerializationRegistrar::Get_XML_Serializer< SUnorderedCompositeXMLTest >();
+
+	SUnorderedCompositeXMLTest test;
+	std::wstring xml_blob( L"<Test type=\"Ignored\" ushort=\"7\"><BOOL>true</BOOL><bigintpointer>12</bigintpointer><sTrInG>lower</sTrInG><FLOAT>1.5</FLOAT></Test>" );
+
+	pugi::xml_document doc;
+	doc.load( xml_blob.c_str() );
+
+	serializer->Load_From_XML( doc.first_child(), &test );
+
+	ASSERT_TRUE( test.UShort == 7 );
+	ASSERT_TRUE( *test.Bigint == 12 );
+	ASSERT_TRUE( test.String == "lower" );
+	ASSERT_TRUE( test.Float == 1.5f );
+	ASSERT_TRUE( test.Bool == true );
+}
+
 struct SInnerCompositeXMLTest1
 {
 	public:
@@ -267,6 +341,122 @@ TEST_F( XMLLoadableTests, Derived_Serializer )
 	ASSERT_TRUE( test.Get_Derived_Int32() == 1 );
 }
 
+class CStaticBindingXMLTest : public CBaseXMLTest
+{
+	public:
+
+		using BASECLASS = CBaseXMLTest;
+
+		CStaticBindingXMLTest( void ) :
+			BASECLASS(),
+			UShort( 0 ),
+			Bigint( 0 ),
+			WString(),
+			String(),
+			Float( 0.0f ),
+			Double( 0.0 ),
+			Bool( false ),
+			Class( ETTC_INVALID ),
+			Inner1( nullptr ),
+			Integers()
+		{}
+
+		static void Register_Type_Definition( void )
+		{
+			BEGIN_DERIVED_TYPE_DEFINITION( CStaticBindingXMLTest, BASECLASS );
+
+			REGISTER_MEMBER_BINDING( L"UShort", &CStaticBindingXMLTest::UShort );
+			REGISTER_MEMBER_BINDING( L"Bigint", &CStaticBindingXMLTest::Bigint );
+			REGISTER_MEMBER_BINDING( L"WString", &CStaticBindingXMLTest::WString );
+			REGISTER_MEMBER_BINDING( L"String", &CStaticBindingXMLTest::String );
+			REGISTER_MEMBER_BINDING( L"Float", &CStaticBindingXMLTest::Float );
+			REGISTER_MEMBER_BINDING( L"Double", &CStaticBindingXMLTest::Double );
+			REGISTER_MEMBER_BINDING( L"Bool", &CStaticBindingXMLTest::Bool );
+			REGISTER_MEMBER_BINDING( L"Class", &CStaticBindingXMLTest::Class );
+			REGISTER_MEMBER_BINDING( L"Inner1", &CStaticBindingXMLTest::Inner1 );
+			REGISTER_MEMBER_BINDING( L"Integers", &CStaticBindingXMLTest::Integers );
+
+			USE_STATIC_XML_SERIALIZER( CStaticBindingXMLTest,
+												XML_MEMBER( CStaticBindingXMLTest, UShort ),
+												XML_MEMBER( CStaticBindingXMLTest, Bigint ),
+												XML_MEMBER( CStaticBindingXMLTest, WString ),
+												XML_MEMBER( CStaticBindingXMLTest, String ),
+												XML_MEMBER( CStaticBindingXMLTest, Float ),
+												XML_MEMBER( CStaticBindingXMLTest, Double ),
+												XML_MEMBER( CStaticBindingXMLTest, Bool ),
+												XML_MEMBER( CStaticBindingXMLTest, Class ) );
+
+			END_TYPE_DEFINITION( CStaticBindingXMLTest );
+		}
+
+		uint16_t UShort;
+		int64_t Bigint;
+		std::wstring WString;
+		std::string String;
+		float Float;
+		double Double;
+		bool Bool;
+		ETableTestClass Class;
+		SInnerCompositeXMLTest1 *Inner1;
+		std::vector< int32_t > Integers;
+};
+
+TEST_F( XMLLoadableTests, Static_Binding_Serializer )
+{
+	REGISTER_ENUM_SERIALIZER( ETableTestClass );
+	CBaseXMLTest::Register_Type_Definition();
+	SInnerCompositeXMLTest1::Register_Type_Definition();
+	CStaticBindingXMLTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	CStaticBindingXMLTest test;
+	std::wstring xml_blob( L"<Test Type=\"Ignored\" ushort=\"65535\" Bool=\"true\"><BaseString>base</BaseString><BaseInt32>-1</BaseInt32>"
+								  L"<Bigint>-40960</Bigint><WString>wide</WString><String>narrow</String><Float>5.5</Float><Double>3.25</Double>"
+								  L"<Class>Janitor</Class><Inner1><UShort>3</UShort><Bigint>15</Bigint></Inner1>"
+								  L"<Integers><Integer>5</Integer><Integer>-7</Integer></Integers></Test>" );
+
+	pugi::xml_document doc;
+	doc.load( xml_blob.c_str() );
+
+	IXMLSerializer *serializer = CSerializationRegistrar::Get_XML_Serializer< CStaticBindingXMLTest >();
+	ASSERT_TRUE( serializer->Load_From_XML( doc.first_child(), &test ) );
+
+	ASSERT_TRUE( test.Get_Base_String() == "base" );
+	ASSERT_TRUE( test.Get_Base_Int32() == -1 );
+	ASSERT_TRUE( test.UShort == 65535 );
+	ASSERT_TRUE( test.Bigint == -40960 );
+	ASSERT_TRUE( test.WString == L"wide" );
+	ASSERT_TRUE( test.String == "narrow" );
+	ASSERT_TRUE( test.Float == 5.5f );
+	ASSERT_TRUE( test.Double == 3.25 );
+	ASSERT_TRUE( test.Bool == true );
+	ASSERT_TRUE( test.Class == ETTC_JANITOR );
+	ASSERT_TRUE( test.Inner1 != nullptr );
+	ASSERT_TRUE( test.Inner1->UShort == 3 );
+	ASSERT_TRUE( test.Inner1->Bigint == 15 );
+	ASSERT_TRUE( test.Integers.size() == 2 );
+	ASSERT_TRUE( test.Integers[ 0 ] == 5 );
+	ASSERT_TRUE( test.Integers[ 1 ] == -7 );
+
+	delete test.Inner1;
+
+	// malformed values fail the load whether the member is bound statically, through the registrar, or as an attribute
+	CStaticBindingXMLTest bad_test;
+	pugi::xml_document bad_doc;
+
+	bad_doc.load( L"<Test><Bigint>many</Bigint></Test>" );
+	ASSERT_FALSE( serializer->Load_From_XML( bad_doc.first_child(), &bad_test ) );
+
+	bad_doc.load( L"<Test><Class>Astronaut</Class></Test>" );
+	ASSERT_FALSE( serializer->Load_From_XML( bad_doc.first_child(), &bad_test ) );
+
+	bad_doc.load( L"<Test ushort=\"many\"></Test>" );
+	ASSERT_FALSE( serializer->Load_From_XML( bad_doc.first_child(), &bad_test ) );
+
+	bad_doc.load( L"<Test><Unknown>1</Unknown></Test>" );
+	ASSERT_FALSE( serializer->Load_From_XML( bad_doc.first_child(), &bad_test ) );
+}
+
 class CPrimitiveVectorXMLTest
 {
 	public:
@@ -558,7 +748,7 @@ TEST_F( XMLLoadableTests, Polymorphic_Serializer )
 	doc.load( xml_blob.c_str() );
 
 	IXMLSerializer *serializer = CSerializationRegistrar::Get_XML_Serializer< CPolyVectorTest >();
-	serializer->Load_From_XML( doc.first_child(), &test );
+	ASSERT_TRUE( serializer->Load_From_XML( doc.first_child(), &test ) );
 
 	ASSERT_TRUE( test.Get_Entries().size() == 2 );
 
@@ -569,6 +759,13 @@ TEST_F( XMLLoadableTests, Polymorphic_Serializer )
 	CPolyDerived2 *poly2 = static_cast< CPolyDerived2 * >( test.Get_Entries()[ 1 ] );
 	ASSERT_TRUE( poly2->Get_String() == "poly2" );
 	ASSERT_TRUE( poly2->Get_Integer() == 42 );	
+
+	// an entry of an unknown type fails the whole load rather than leaving a null entry behind
+	CPolyVectorTest bad_test;
+	pugi::xml_document bad_doc;
+	bad_doc.load( L"<Test><Entries><Entry Type=\"CPolyDerived9\"><String>poly9</String></Entry></Entries></Test>" );
+
+	ASSERT_FALSE( serializer->Load_From_XML( bad_doc.first_child(), &bad_test ) );
 }
 
 
@@ -637,4 +834,567 @@ TEST_F( XMLLoadableTests, Loadable_Table )
 
 }
 
+TEST_F( XMLLoadableTests, Compiled_Loadable_Table )
+{
+	REGISTER_ENUM_SERIALIZER(ETableTestClass);
+
+	CTableTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	Write_XML_File( COMPILED_TABLE_XML_FILE, "<Objects><Object><Name>Bret</Name><HitPoints>5</HitPoints><Class>Janitor</Class></Object><Object><Name>Peti</Name><HitPoints>50</HitPoints><Class>Berserker</Class></Object></Objects>" );
+
+	CXMLLoadableTable< std::string, CTableTest > compiler_table( &CTableTest::Get_Name );
+	ASSERT_TRUE( compiler_table.Compile( COMPILED_TABLE_XML_FILE, COMPILED_TABLE_IMAGE_FILE ) );
+	ASSERT_TRUE( compiler_table.cbegin() == compiler_table.cend() );
+
+	CXMLLoadableTable< std::string, CTableTest > image_table( &CTableTest::Get_Name );
+	ASSERT_TRUE( image_table.Load( COMPILED_TABLE_XML_FILE, COMPILED_TABLE_IMAGE_FILE ) );
+
+	const CTableTest *test1 = image_table.Get_Object( "Bret" );
+	ASSERT_TRUE( test1->Get_Name() == "Bret" );
+	ASSERT_TRUE( test1->Get_Hit_Points() == 5 );
+	ASSERT_TRUE( test1->Get_Class() == ETTC_JANITOR );
+
+	const CTableTest *test2 = image_table.Get_Object( "Peti" );
+	ASSERT_TRUE( test2->Get_Name() == "Peti" );
+	ASSERT_TRUE( test2->Get_Hit_Points() == 50 );
+	ASSERT_TRUE( test2->Get_Class() == ETTC_BERSERKER );
+
+	// editing the source invalidates the image, so the table must come from the XML instead
+	Write_XML_File( COMPILED_TABLE_XML_FILE, "<Objects><Object><Name>Bret</Name><HitPoints>7</HitPoints><Class>Bard</Class></Object></Objects>" );
+
+	CXMLLoadableTable< std::string, CTableTest > stale_table( &CTableTest::Get_Name );
+	ASSERT_FALSE( stale_table.Load( COMPILED_TABLE_XML_FILE, COMPILED_TABLE_IMAGE_FILE ) );
+
+	const CTableTest *test3 = stale_table.Get_Object( "Bret" );
+	ASSERT_TRUE( test3->Get_Hit_Points() == 7 );
+	ASSERT_TRUE( test3->Get_Class() == ETTC_BARD );
+	ASSERT_TRUE( stale_table.Get_Object( "Peti" ) == nullptr );
+
+	Delete_Test_File( COMPILED_TABLE_XML_FILE );
+	Delete_Test_File( COMPILED_TABLE_IMAGE_FILE );
+}
+
+TEST_F( XMLLoadableTests, Compiled_Polymorphic_Table )
+{
+	CPolyBase::Register_Type_Definition();
+	CPolyDerived1::Register_Type_Definition();
+	CPolyDerived2::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	Write_XML_File( COMPILED_TABLE_XML_FILE, "<Objects><Entry Type=\"CPolyDerived1\"><String>poly1</String><Bool>1</Bool></Entry><Entry Type=\"CPolyDerived2\"><String>poly2</String><Integer>42</Integer></Entry></Objects>" );
+
+	CXMLLoadableTable< std::string, CPolyBase > compiler_table( &CPolyBase::Get_String );
+	ASSERT_TRUE( compiler_table.Compile( COMPILED_TABLE_XML_FILE, COMPILED_TABLE_IMAGE_FILE ) );
+
+	CXMLLoadableTable< std::string, CPolyBase > image_table( &CPolyBase::Get_String );
+	ASSERT_TRUE( image_table.Load( COMPILED_TABLE_XML_FILE, COMPILED_TABLE_IMAGE_FILE ) );
+
+	const CPolyDerived1 *poly1 = dynamic_cast< const CPolyDerived1 * >( image_table.Get_Object( "poly1" ) );
+	ASSERT_TRUE( poly1 != nullptr );
+	ASSERT_TRUE( poly1->Get_Bool() == true );
+
+	const CPolyDerived2 *poly2 = dynamic_cast< const CPolyDerived2 * >( image_table.Get_Object( "poly2" ) );
+	ASSERT_TRUE( poly2 != nullptr );
+	ASSERT_TRUE( poly2->Get_Integer() == 42 );
+
+	Delete_Test_File( COMPILED_TABLE_XML_FILE );
+	Delete_Test_File( COMPILED_TABLE_IMAGE_FILE );
+}
+
+TEST_F( XMLLoadableTests, Parallel_Table_Loader )
+{
+	REGISTER_ENUM_SERIALIZER(ETableTestClass);
+
+	CTableTest::Register_Type_Definition();
+	CPolyBase::Register_Type_Definition();
+	CPolyDerived1::Register_Type_Definition();
+	CPolyDerived2::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	Write_XML_File( PARALLEL_TABLE_XML_FILE1, "<Objects><Object><Name>Bret</Name><HitPoints>5</HitPoints><Class>Janitor</Class></Object></Objects>" );
+	Write_XML_File( PARALLEL_TABLE_XML_FILE2, "<Objects><Object><Name>Peti</Name><HitPoints>50</HitPoints><Class>Berserker</Class></Object></Objects>" );
+	Write_XML_File( PARALLEL_TABLE_XML_FILE3, "<Objects><Entry Type=\"CPolyDerived2\"><String>poly2</String><Integer>42</Integer></Entry></Objects>" );
+
+	CXMLLoadableTable< std::string, CTableTest > table1( &CTableTest::Get_Name );
+	CXMLLoadableTable< std::string, CTableTest > table2( &CTableTest::Get_Name );
+	CXMLLoadableTable< std::string, CPolyBase > table3( &CPolyBase::Get_String );
+
+	CXMLTableLoader loader;
+	loader.Add_Table( &table1, PARALLEL_TABLE_XML_FILE1 );
+	loader.Add_Table( &table2, PARALLEL_TABLE_XML_FILE2 );
+	loader.Add_Table( &table3, PARALLEL_TABLE_XML_FILE3 );
+
+	ASSERT_TRUE( loader.Load( 3 ) );
+	ASSERT_TRUE( loader.Get_Errors().empty() );
+
+	ASSERT_TRUE( table1.Get_Object( "Bret" )->Get_Class() == ETTC_JANITOR );
+	ASSERT_TRUE( table2.Get_Object( "Peti" )->Get_Hit_Points() == 50 );
+	ASSERT_TRUE( static_cast< const CPolyDerived2 * >( table3.Get_Object( "poly2" ) )->Get_Integer() == 42 );
+
+	// one bad file keeps every table in the set from changing
+	CXMLLoadableTable< std::string, CTableTest > table4( &CTableTest::Get_Name );
+	CXMLLoadableTable< std::string, CTableTest > table5( &CTableTest::Get_Name );
+
+	Write_XML_File( PARALLEL_TABLE_XML_FILE2, "<Objects><Object><Name>Peti</Name>" );
+
+	CXMLTableLoader failing_loader;
+	failing_loader.Add_Table( &table4, PARALLEL_TABLE_XML_FILE1 );
+	failing_loader.Add_Table( &table5, PARALLEL_TABLE_XML_FILE2 );
+
+	ASSERT_FALSE( failing_loader.Load() );
+	ASSERT_TRUE( failing_loader.Get_Errors().size() == 1 );
+	ASSERT_TRUE( failing_loader.Get_Errors()[ 0 ].FileName == PARALLEL_TABLE_XML_FILE2 );
+	ASSERT_FALSE( failing_loader.Get_Errors()[ 0 ].Message.empty() );
+
+	ASSERT_TRUE( table4.Get_Object( "Bret" ) == nullptr );
+	ASSERT_TRUE( table5.cbegin() == table5.cend() );
+
+	Delete_Test_File( PARALLEL_TABLE_XML_FILE1 );
+	Delete_Test_File( PARALLEL_TABLE_XML_FILE2 );
+	Delete_Test_File( PARALLEL_TABLE_XML_FILE3 );
+}
+
+TEST_F( XMLLoadableTests, Staged_Load_Rejects_Bad_Row )
+{
+	REGISTER_ENUM_SERIALIZER(ETableTestClass);
+
+	CTableTest::Register_Type_Definition();
+	CPolyBase::Register_Type_Definition();
+	CPolyDerived1::Register_Type_Definition();
+	CPolyDerived2::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	Write_XML_File( PARALLEL_TABLE_XML_FILE1, "<Objects><Object><Name>Bret</Name><HitPoints>5</HitPoints><Class>Janitor</Class></Object></Objects>" );
+	Write_XML_File( PARALLEL_TABLE_XML_FILE2, "<Objects><Entry Type=\"CPolyDerived2\"><String>poly2</String><Integer>42</Integer></Entry><Entry Type=\"CPolyDerived9\"><String>poly9</String></Entry></Objects>" );
+
+	CXMLLoadableTable< std::string, CTableTest > table1( &CTableTest::Get_Name );
+	CXMLLoadableTable< std::string, CPolyBase > table2( &CPolyBase::Get_String );
+
+	CXMLTableLoader loader;
+	loader.Add_Table( &table1, PARALLEL_TABLE_XML_FILE1 );
+	loader.Add_Table( &table2, PARALLEL_TABLE_XML_FILE2 );
+
+	ASSERT_FALSE( loader.Load( 2 ) );
+	ASSERT_TRUE( loader.Get_Errors().size() == 1 );
+	ASSERT_TRUE( loader.Get_Errors()[ 0 ].FileName == PARALLEL_TABLE_XML_FILE2 );
+	ASSERT_TRUE( loader.Get_Errors()[ 0 ].Message.find( PARALLEL_TABLE_XML_FILE2 ) != std::string::npos );
+	ASSERT_TRUE( loader.Get_Errors()[ 0 ].Message.find( "row 1" ) != std::string::npos );
+
+	ASSERT_TRUE( table1.cbegin() == table1.cend() );
+	ASSERT_TRUE( table2.cbegin() == table2.cend() );
+
+	ASSERT_FALSE( table2.Compile( PARALLEL_TABLE_XML_FILE2, COMPILED_TABLE_IMAGE_FILE ) );
+
+	Delete_Test_File( PARALLEL_TABLE_XML_FILE1 );
+	Delete_Test_File( PARALLEL_TABLE_XML_FILE2 );
+	Delete_Test_File( COMPILED_TABLE_IMAGE_FILE );
+}
+
+TEST_F( XMLLoadableTests, Reloadable_Table )
+{
+	REGISTER_ENUM_SERIALIZER(ETableTestClass);
+
+	CTableTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	IP::Execution::CQuiescentStateReclaimer reclaimer;
+	CXMLReloadableTable< std::string, CTableTest > reloadable_table( &reclaimer, &CTableTest::Get_Name );
+	ASSERT_TRUE( reloadable_table.Get_Table()->cbegin() == reloadable_table.Get_Table()->cend() );
+
+	std::string error;
+	Write_XML_File( RELOADABLE_TABLE_XML_FILE, "<Objects><Object><Name>Bret</Name><HitPoints>5</HitPoints><Class>Janitor</Class></Object></Objects>" );
+	ASSERT_TRUE( reloadable_table.Reload( RELOADABLE_TABLE_XML_FILE, error ) );
+	ASSERT_TRUE( reloadable_table.Get_Version() == 1 );
+
+	{
+		IP::Execution::CQuiescentStateReadGuard read_guard( &reclaimer );
+
+		const CXMLLoadableTable< std::string, CTableTest > *reader_table = reloadable_table.Get_Table();
+		const CTableTest *reader_row = reader_table->Get_Object( "Bret" );
+		ASSERT_TRUE( reader_row->Get_Hit_Points() == 5 );
+
+		// a reload publishes a new version while this reader keeps using the old one
+		Write_XML_File( RELOADABLE_TABLE_XML_FILE, "<Objects><Object><Name>Bret</Name><HitPoints>7</HitPoints><Class>Bard</Class></Object></Objects>" );
+		ASSERT_TRUE( reloadable_table.Reload( RELOADABLE_TABLE_XML_FILE, error ) );
+		ASSERT_TRUE( reloadable_table.Get_Version() == 2 );
+		ASSERT_TRUE( reloadable_table.Get_Table()->Get_Object( "Bret" )->Get_Hit_Points() == 7 );
+
+		ASSERT_TRUE( reclaimer.Reclaim() == 0 );
+		ASSERT_TRUE( reader_row->Get_Hit_Points() == 5 );
+		ASSERT_TRUE( reader_row->Get_Class() == ETTC_JANITOR );
+	}
+
+	ASSERT_TRUE( reclaimer.Reclaim() == 1 );
+
+	// a bad file leaves the published version in place
+	Write_XML_File( RELOADABLE_TABLE_XML_FILE, "<Objects><Object><Name>Bret</Name>" );
+	ASSERT_FALSE( reloadable_table.Reload( RELOADABLE_TABLE_XML_FILE, error ) );
+	ASSERT_FALSE( error.empty() );
+	ASSERT_TRUE( reloadable_table.Get_Version() == 2 );
+	ASSERT_TRUE( reloadable_table.Get_Table()->Get_Object( "Bret" )->Get_Class() == ETTC_BARD );
+	ASSERT_TRUE( reclaimer.Get_Pending_Count() == 0 );
+
+	Delete_Test_File( RELOADABLE_TABLE_XML_FILE );
+}
+
+class CFlatTableTest
+{
+	public:
+
+		CFlatTableTest( void ) :
+			Name( "" ),
+			Cost( 0 ),
+			Class( ETTC_INVALID )
+		{}
+
+		static void Register_Type_Definition( void )
+		{
+			BEGIN_ROOT_TYPE_DEFINITION( CFlatTableTest );
+
+			REGISTER_MEMBER_BINDING( L"Name", &CFlatTableTest::Name );
+			REGISTER_MEMBER_BINDING( L"Cost", &CFlatTableTest::Cost );
+			REGISTER_MEMBER_BINDING( L"Class", &CFlatTableTest::Class );
+
+			END_TYPE_DEFINITION( CFlatTableTest );
+		}
+
+		const std::string &Get_Name( void ) const { return Name; }
+
+		std::string Name;
+		uint32_t Cost;
+		ETableTestClass Class;
+};
+
+TEST_F( XMLLoadableTests, Flat_Loadable_Table )
+{
+	REGISTER_ENUM_SERIALIZER(ETableTestClass);
+
+	CFlatTableTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	CXMLFlatLoadableTable< std::string, CFlatTableTest > flat_table( &CFlatTableTest::Get_Name );
+	auto class_index = flat_table.Add_Hash_Index( &CFlatTableTest::Class );
+	auto class_cost_index = flat_table.Add_Sorted_Index( &CFlatTableTest::Class, &CFlatTableTest::Cost );
+
+	std::wstring xml_blob( L"<Objects>"
+								  L"<Object><Name>Mop</Name><Cost>2</Cost><Class>Janitor</Class></Object>"
+								  L"<Object><Name>Axe</Name><Cost>5</Cost><Class>Berserker</Class></Object>"
+								  L"<Object><Name>Bucket</Name><Cost>1</Cost><Class>Janitor</Class></Object>"
+								  L"<Object><Name>Lute</Name><Cost>3</Cost><Class>Bard</Class></Object>"
+								  L"<Object><Name>Broom</Name><Cost>4</Cost><Class>Janitor</Class></Object>"
+								  L"</Objects>" );
+
+	pugi::xml_document doc;
+	doc.load( xml_blob.c_str() );
+
+	flat_table.Load( doc );
+	ASSERT_TRUE( flat_table.Size() == 5 );
+
+	// rows are contiguous and ordered by key
+	const CFlatTableTest *axe = flat_table.Get_Object( "Axe" );
+	ASSERT_TRUE( axe == &( *flat_table.cbegin() ) );
+	ASSERT_TRUE( flat_table.Get_Object( "Broom" ) == axe + 1 );
+	ASSERT_TRUE( flat_table.Get_Object( "Mop" ) == axe + 4 );
+	ASSERT_TRUE( flat_table.Get_Object( "Mop" )->Cost == 2 );
+	ASSERT_TRUE( flat_table.Get_Object( "Shovel" ) == nullptr );
+
+	std::vector< const CFlatTableTest * > rows;
+	class_index->Find( ETTC_JANITOR, rows );
+	ASSERT_TRUE( rows.size() == 3 );
+	ASSERT_TRUE( class_index->Count( ETTC_BARD ) == 1 );
+	ASSERT_TRUE( class_index->Count( ETTC_INVALID ) == 0 );
+
+	// all janitor entries with cost <= 2, in cost order
+	rows.clear();
+	class_cost_index->Find_Range( std::make_tuple( ETTC_JANITOR, 0U ), std::make_tuple( ETTC_JANITOR, 2U ), rows );
+	ASSERT_TRUE( rows.size() == 2 );
+	ASSERT_TRUE( rows[ 0 ]->Name == "Bucket" );
+	ASSERT_TRUE( rows[ 1 ]->Name == "Mop" );
+
+	// staged loads rebuild the indices when they commit and leave the table untouched when they fail
+	Write_XML_File( FLAT_TABLE_XML_FILE, "<Objects><Object><Name>Sponge</Name><Cost>0</Cost><Class>Janitor</Class></Object></Objects>" );
+
+	CXMLTableLoader loader;
+	loader.Add_Table( &flat_table, FLAT_TABLE_XML_FILE );
+	ASSERT_TRUE( loader.Load( 1 ) );
+	ASSERT_TRUE( flat_table.Size() == 6 );
+	ASSERT_TRUE( class_index->Count( ETTC_JANITOR ) == 4 );
+
+	Write_XML_File( FLAT_TABLE_XML_FILE, "<Objects><Object><Name>Rake</Name><Cost>1</Cost><Class>Janitor</Class></Object><Object><Name>Lute</Name><Cost>9</Cost><Class>Bard</Class></Object></Objects>" );
+
+	CXMLTableLoader duplicate_loader;
+	duplicate_loader.Add_Table( &flat_table, FLAT_TABLE_XML_FILE );
+	ASSERT_FALSE( duplicate_loader.Load( 1 ) );
+	ASSERT_TRUE( duplicate_loader.Get_Errors()[ 0 ].Message == "duplicate key in row 1" );
+	ASSERT_TRUE( flat_table.Size() == 6 );
+	ASSERT_TRUE( flat_table.Get_Object( "Lute" )->Cost == 3 );
+
+	Write_XML_File( FLAT_TABLE_XML_FILE, "<Objects><Object><Name>Rake</Name><Cost>1</Cost><Class>Janitor</Class></Object><Object><Name>Hoe</Name><Cost>lots</Cost><Class>Janitor</Class></Object></Objects>" );
+
+	CXMLTableLoader malformed_loader;
+	malformed_loader.Add_Table( &flat_table, FLAT_TABLE_XML_FILE );
+	ASSERT_FALSE( malformed_loader.Load( 1 ) );
+	ASSERT_TRUE( malformed_loader.Get_Errors()[ 0 ].Message == FLAT_TABLE_XML_FILE + ": row 1 failed to deserialize" );
+	ASSERT_TRUE( flat_table.Size() == 6 );
+	ASSERT_TRUE( flat_table.Get_Object( "Rake" ) == nullptr );
+
+	Delete_Test_File( FLAT_TABLE_XML_FILE );
+}
+
+struct SInternedStringXMLTest
+{
+	public:
+
+		static void Register_Type_Definition( void )
+		{
+			BEGIN_ROOT_TYPE_DEFINITION( SInternedStringXMLTest );
+
+			REGISTER_MEMBER_BINDING( L"Faction", &SInternedStringXMLTest::Faction );
+			REGISTER_MEMBER_BINDING( L"Keyword", &SInternedStringXMLTest::Keyword );
+
+			END_TYPE_DEFINITION( SInternedStringXMLTest );
+		}
+
+		IP::String::CInternedWideString Faction;
+		IP::String::CInternedString Keyword;
+};
+
+TEST_F( XMLLoadableTests, Interned_String_Members )
+{
+	SInternedStringXMLTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	SInternedStringXMLTest source;
+	SInternedStringXMLTest result;
+	Load_And_Round_Trip( L"<Test><Faction>Rebels</Faction><Keyword>Haste</Keyword></Test>", source, result );
+
+	ASSERT_TRUE( source.Faction.Get() == L"Rebels" );
+	ASSERT_TRUE( source.Keyword.Get() == "Haste" );
+
+	// every load of the same text shares one instance
+	ASSERT_TRUE( result.Faction == source.Faction );
+	ASSERT_TRUE( &result.Keyword.Get() == &source.Keyword.Get() );
+	ASSERT_TRUE( result.Faction == IP::String::CInternedWideString( L"Rebels" ) );
+}
+
+TEST_F( XMLLoadableTests, Binary_Round_Trip_Composite )
+{
+	SInnerCompositeXMLTest1::Register_Type_Definition();
+	SInnerCompositeXMLTest2::Register_Type_Definition();
+	SOuterCompositeXMLTest::Register_Type_Definition();
+	CBaseXMLTest::Register_Type_Definition();
+	CDerivedXMLTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	SOuterCompositeXMLTest outer_source;
+	SOuterCompositeXMLTest outer_result;
+	Load_And_Round_Trip( L"<Test><Inner1><UShort>65535</UShort><Bigint>1099511627776</Bigint></Inner1><Double>-1.5</Double><Inner2><String>Hey</String><Float>2.0</Float></Inner2></Test>", outer_source, outer_result );
+
+	ASSERT_TRUE( outer_result.Inner1 != nullptr && outer_result.Inner1 != outer_source.Inner1 );
+	ASSERT_TRUE( outer_result.Inner1->UShort == outer_source.Inner1->UShort );
+	ASSERT_TRUE( outer_result.Inner1->Bigint == outer_source.Inner1->Bigint );
+	ASSERT_TRUE( outer_result.Double == -1.5 );
+	ASSERT_TRUE( outer_result.Inner2.String == "Hey" );
+	ASSERT_TRUE( outer_result.Inner2.Float == 2.0f );
+
+	delete outer_source.Inner1;
+	delete outer_result.Inner1;
+
+	CDerivedXMLTest derived_source;
+	CDerivedXMLTest derived_result;
+	Load_And_Round_Trip( L"<Test><BaseString>base</BaseString><BaseInt32>-1</BaseInt32><DerivedString>derived</DerivedString><DerivedInt32>1</DerivedInt32></Test>", derived_source, derived_result );
+
+	ASSERT_TRUE( derived_result.Get_Base_String() == "base" );
+	ASSERT_TRUE( derived_result.Get_Base_Int32() == -1 );
+	ASSERT_TRUE( derived_result.Get_Derived_String() == "derived" );
+	ASSERT_TRUE( derived_result.Get_Derived_Int32() == 1 );
+}
+
+TEST_F( XMLLoadableTests, Binary_Round_Trip_Vectors )
+{
+	CPrimitiveVectorXMLTest::Register_Type_Definition();
+	CVectorEntry::Register_Type_Definition();
+	CDerivedVectorEntry::Register_Type_Definition();
+	CVectorXMLTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	CPrimitiveVectorXMLTest primitive_source;
+	CPrimitiveVectorXMLTest primitive_result;
+	Load_And_Round_Trip( L"<Test><Strings><Entry>string1</Entry><Entry></Entry></Strings><Integers><Entry>1</Entry><Entry>-200000</Entry></Integers></Test>", primitive_source, primitive_result );
+
+	ASSERT_TRUE( primitive_result.Get_Strings() == primitive_source.Get_Strings() );
+	ASSERT_TRUE( primitive_result.Get_Integers().size() == 2 );
+	ASSERT_TRUE( *primitive_result.Get_Integers()[ 0 ] == 1 );
+	ASSERT_TRUE( *primitive_result.Get_Integers()[ 1 ] == -200000 );
+
+	CVectorXMLTest compound_source;
+	CVectorXMLTest compound_result;
+	Load_And_Round_Trip( L"<Test><Entries><Entry><String>string1</String><Integer>1</Integer></Entry><Entry><String>string2</String><Integer>-2</Integer></Entry></Entries></Test>", compound_source, compound_result );
+
+	ASSERT_TRUE( compound_result.Get_Entries().size() == 2 );
+	ASSERT_TRUE( compound_result.Get_Entries()[ 0 ].Get_String() == "string1" );
+	ASSERT_TRUE( compound_result.Get_Entries()[ 0 ].Get_Integer() == 1 );
+	ASSERT_TRUE( compound_result.Get_Entries()[ 1 ].Get_String() == "string2" );
+	ASSERT_TRUE( compound_result.Get_Entries()[ 1 ].Get_Integer() == -2 );
+	ASSERT_TRUE( compound_result.Get_Entry_Pointers().empty() );
+}
+
+TEST_F( XMLLoadableTests, Binary_Round_Trip_Polymorphic )
+{
+	CPolyBase::Register_Type_Definition();
+	CPolyDerived1::Register_Type_Definition();
+	CPolyDerived2::Register_Type_Definition();
+	CPolyVectorTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	CPolyVectorTest source;
+	CPolyVectorTest result;
+	Load_And_Round_Trip( L"<Test><Entries><Entry Type=\"CPolyDerived1\"><String>poly1</String><Bool>1</Bool></Entry><Entry Type=\"CPolyDerived2\"><String>poly2</String><Integer>42</Integer></Entry></Entries></Test>", source, result );
+
+	ASSERT_TRUE( result.Get_Entries().size() == 2 );
+
+	const CPolyDerived1 *poly1 = dynamic_cast< const CPolyDerived1 * >( result.Get_Entries()[ 0 ] );
+	ASSERT_TRUE( poly1 != nullptr );
+	ASSERT_TRUE( poly1->Get_String() == "poly1" );
+	ASSERT_TRUE( poly1->Get_Bool() == true );
+
+	const CPolyDerived2 *poly2 = dynamic_cast< const CPolyDerived2 * >( result.Get_Entries()[ 1 ] );
+	ASSERT_TRUE( poly2 != nullptr );
+	ASSERT_TRUE( poly2->Get_String() == "poly2" );
+	ASSERT_TRUE( poly2->Get_Integer() == 42 );
+}
+
+TEST_F( XMLLoadableTests, Binary_Rejects_Malformed_Lengths )
+{
+	CPrimitiveVectorXMLTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	// a vector count that could not fit in the remaining input
+	Binary::CBinaryWriter vector_writer;
+	vector_writer.Write_Varint( 0xFFFFFFFFFFFFFFFFULL );
+	vector_writer.Write_Varint( 0 );
+
+	std::vector< std::string > strings( 3 );
+	Binary::CBinaryReader vector_reader( vector_writer.Get_Buffer().data(), vector_writer.Get_Size() );
+	CSerializationRegistrar::Get_Binary_Serializer< std::vector< std::string > >()->Read_From_Binary( vector_reader, &strings );
+
+	ASSERT_TRUE( vector_reader.Has_Failed() );
+	ASSERT_FALSE( vector_reader.Is_Finished() );
+	ASSERT_TRUE( strings.empty() );
+	ASSERT_TRUE( vector_reader.Read< uint32_t >() == 0 );
 
+	// a wide string byte count far past the end of the input
+	Binary::CBinaryWriter wide_writer;
+	wide_writer.Write_Varint( static_cast< uint64_t >( SIZE_MAX / sizeof( wchar_t ) ) + 1 );
+	wide_writer.Write< uint32_t >( 0 );
+
+	std::wstring wide_string( L"untouched" );
+	Binary::CBinaryReader wide_reader( wide_writer.Get_Buffer().data(), wide_writer.Get_Size() );
+	CSerializationRegistrar::Get_Binary_Serializer< std::wstring >()->Read_From_Binary( wide_reader, &wide_string );
+
+	ASSERT_TRUE( wide_reader.Has_Failed() );
+	ASSERT_TRUE( wide_string.empty() );
+
+	// a string length past the end of the input
+	Binary::CBinaryWriter narrow_writer;
+	narrow_writer.Write_Varint( 10 );
+	narrow_writer.Write_Bytes( "abc", 3 );
+
+	std::string narrow_string;
+	Binary::CBinaryReader narrow_reader( narrow_writer.Get_Buffer().data(), narrow_writer.Get_Size() );
+	CSerializationRegistrar::Get_Binary_Serializer< std::string >()->Read_From_Binary( narrow_reader, &narrow_string );
+
+	ASSERT_TRUE( narrow_reader.Has_Failed() );
+	ASSERT_TRUE( narrow_string.empty() );
+}
+
+TEST_F( XMLLoadableTests, Binary_Rejects_Truncated_Input )
+{
+	CPolyBase::Register_Type_Definition();
+	CPolyDerived1::Register_Type_Definition();
+	CPolyDerived2::Register_Type_Definition();
+	CPolyVectorTest::Register_Type_Definition();
+	CSerializationRegistrar::Finalize();
+
+	// a varint whose last byte still asks for continuation
+	uint8_t truncated_varint[] = { 0xFF, 0xFF };
+	Binary::CBinaryReader truncated_reader( truncated_varint, sizeof( truncated_varint ) );
+
+	ASSERT_TRUE( truncated_reader.Read_Varint() == 0 );
+	ASSERT_TRUE( truncated_reader.Has_Failed() );
+
+	// a varint longer than any 64-bit value
+	uint8_t overlong_varint[ 11 ];
+	memset( overlong_varint, 0xFF, sizeof( overlong_varint ) );
+	Binary::CBinaryReader overlong_reader( overlong_varint, sizeof( overlong_varint ) );
+
+	ASSERT_TRUE( overlong_reader.Read_Varint() == 0 );
+	ASSERT_TRUE( overlong_reader.Has_Failed() );
+
+	// a fixed-width value cut short
+	uint8_t short_value[] = { 1, 2 };
+	Binary::CBinaryReader short_reader( short_value, sizeof( short_value ) );
+
+	ASSERT_TRUE( short_reader.Read< uint32_t >() == 0 );
+	ASSERT_TRUE( short_reader.Has_Failed() );
+
+	// a polymorphic entry whose type key was never registered
+	Binary::CBinaryWriter poly_writer;
+	poly_writer.Write_Varint( 1 );
+	poly_writer.Write< uint8_t >( 1 );
+	poly_writer.Write_Varint( 0xFFFF );
+
+	CPolyVectorTest poly_result;
+	Binary::CBinaryReader poly_reader( poly_writer.Get_Buffer().data(), poly_writer.Get_Size() );
+	CSerializationRegistrar::Get_Binary_Serializer< CPolyVectorTest >()->Read_From_Binary( poly_reader, &poly_result );
+
+	ASSERT_TRUE( poly_reader.Has_Failed() );
+	ASSERT_TRUE( poly_result.Get_Entries().size() == 1 );
+	ASSERT_TRUE( poly_result.Get_Entries()[ 0 ] == nullptr );
+}
+
+TEST_F( XMLLoadableTests, Binary_Portable_Encoding )
+{
+	CSerializationRegistrar::Finalize();
+
+	// wide strings are UTF-8 on the wire whatever the width of wchar_t
+	std::wstring wide_source( L"a\u00E9\U0001F0A1" );
+	Binary::CBinaryWriter wide_writer;
+	CSerializationRegistrar::Get_Binary_Serializer< std::wstring >()->Write_To_Binary( &wide_source, wide_writer );
+
+	const uint8_t expected_wide[] = { 7, 'a', 0xC3, 0xA9, 0xF0, 0x9F, 0x82, 0xA1 };
+	ASSERT_TRUE( wide_writer.Get_Size() == sizeof( expected_wide ) );
+	ASSERT_TRUE( memcmp( wide_writer.Get_Buffer().data(), expected_wide, sizeof( expected_wide ) ) == 0 );
+
+	std::wstring wide_result;
+	Binary::CBinaryReader wide_reader( wide_writer.Get_Buffer().data(), wide_writer.Get_Size() );
+	CSerializationRegistrar::Get_Binary_Serializer< std::wstring >()->Read_From_Binary( wide_reader, &wide_result );
+
+	ASSERT_TRUE( wide_reader.Is_Finished() );
+	ASSERT_TRUE( wide_result == wide_source );
+
+	// an overlong encoding of '/'
+	const uint8_t overlong_wide[] = { 2, 0xC0, 0xAF };
+	std::wstring overlong_result( L"untouched" );
+	Binary::CBinaryReader overlong_reader( overlong_wide, sizeof( overlong_wide ) );
+	CSerializationRegistrar::Get_Binary_Serializer< std::wstring >()->Read_From_Binary( overlong_reader, &overlong_result );
+
+	ASSERT_TRUE( overlong_reader.Has_Failed() );
+	ASSERT_TRUE( overlong_result.empty() );
+
+	// bools are a single byte that must be 0 or 1
+	bool bool_source = true;
+	Binary::CBinaryWriter bool_writer;
+	CSerializationRegistrar::Get_Binary_Serializer< bool >()->Write_To_Binary( &bool_source, bool_writer );
+
+	ASSERT_TRUE( bool_writer.Get_Size() == 1 && bool_writer.Get_Buffer()[ 0 ] == 1 );
+
+	const uint8_t bad_bool[] = { 2 };
+	bool bool_result = true;
+	Binary::CBinaryReader bool_reader( bad_bool, sizeof( bad_bool ) );
+	CSerializationRegistrar::Get_Binary_Serializer< bool >()->Read_From_Binary( bool_reader, &bool_result );
+
+	ASSERT_TRUE( bool_reader.Has_Failed() );
+	ASSERT_FALSE( bool_result );
+}
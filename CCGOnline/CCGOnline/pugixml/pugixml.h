@@ -16,7 +16,12 @@
 
 #include "pugiconfig.h"
 
-#ifndef PUGIXML_NO_STL
+#if !defined(PUGIXML_NO_STL) && defined(__GNUC__)
+// libstdc++ declares basic_string inside an inline namespace, so it cannot be forward declared here
+#	include <iterator>
+#	include <iosfwd>
+#	include <string>
+#elif !defined(PUGIXML_NO_STL)
 namespace std
 {
 	struct bidirectional_iterator_tag;